@@ -184,6 +184,8 @@ use constant CFGOPT_ARCHIVE_TIMEOUT                                 => 'archive-
     push @EXPORT, qw(CFGOPT_ARCHIVE_TIMEOUT);
 use constant CFGOPT_BUFFER_SIZE                                     => 'buffer-size';
     push @EXPORT, qw(CFGOPT_BUFFER_SIZE);
+use constant CFGOPT_CACHE_DROP                                      => 'cache-drop';
+    push @EXPORT, qw(CFGOPT_CACHE_DROP);
 use constant CFGOPT_DB_TIMEOUT                                      => 'db-timeout';
     push @EXPORT, qw(CFGOPT_DB_TIMEOUT);
 use constant CFGOPT_COMPRESS                                        => 'compress';
@@ -192,6 +194,18 @@ use constant CFGOPT_COMPRESS_LEVEL                                  => 'compress
     push @EXPORT, qw(CFGOPT_COMPRESS_LEVEL);
 use constant CFGOPT_COMPRESS_LEVEL_NETWORK                          => 'compress-level-network';
     push @EXPORT, qw(CFGOPT_COMPRESS_LEVEL_NETWORK);
+use constant CFGOPT_COMPRESS_THREAD                                 => 'compress-thread';
+    push @EXPORT, qw(CFGOPT_COMPRESS_THREAD);
+use constant CFGOPT_COMPRESS_TYPE                                   => 'compress-type';
+    push @EXPORT, qw(CFGOPT_COMPRESS_TYPE);
+use constant CFGOPT_DIRECT_IO                                       => 'direct-io';
+    push @EXPORT, qw(CFGOPT_DIRECT_IO);
+use constant CFGOPT_FILTER_STAT                                     => 'filter-stat';
+    push @EXPORT, qw(CFGOPT_FILTER_STAT);
+use constant CFGOPT_FILTER_THREAD                                   => 'filter-thread';
+    push @EXPORT, qw(CFGOPT_FILTER_THREAD);
+use constant CFGOPT_IO_QUEUE_DEPTH                                  => 'io-queue-depth';
+    push @EXPORT, qw(CFGOPT_IO_QUEUE_DEPTH);
 use constant CFGOPT_NEUTRAL_UMASK                                   => 'neutral-umask';
     push @EXPORT, qw(CFGOPT_NEUTRAL_UMASK);
 use constant CFGOPT_PROTOCOL_TIMEOUT                                => 'protocol-timeout';
@@ -316,8 +330,16 @@ use constant CFGOPT_ARCHIVE_COPY                                    => 'archive-
     push @EXPORT, qw(CFGOPT_ARCHIVE_COPY);
 use constant CFGOPT_BACKUP_STANDBY                                  => 'backup-standby';
     push @EXPORT, qw(CFGOPT_BACKUP_STANDBY);
+use constant CFGOPT_BLOCK_INCR                                      => 'block-incr';
+    push @EXPORT, qw(CFGOPT_BLOCK_INCR);
+use constant CFGOPT_CHECKSUM_FAST                                   => 'checksum-fast';
+    push @EXPORT, qw(CFGOPT_CHECKSUM_FAST);
 use constant CFGOPT_CHECKSUM_PAGE                                   => 'checksum-page';
     push @EXPORT, qw(CFGOPT_CHECKSUM_PAGE);
+use constant CFGOPT_COMPRESS_DICT                                   => 'compress-dict';
+    push @EXPORT, qw(CFGOPT_COMPRESS_DICT);
+use constant CFGOPT_COMPRESS_LEVEL_AUTO                             => 'compress-level-auto';
+    push @EXPORT, qw(CFGOPT_COMPRESS_LEVEL_AUTO);
 use constant CFGOPT_EXCLUDE                                         => 'exclude';
     push @EXPORT, qw(CFGOPT_EXCLUDE);
 use constant CFGOPT_MANIFEST_SAVE_THRESHOLD                         => 'manifest-save-threshold';
@@ -328,6 +350,8 @@ use constant CFGOPT_START_FAST                                      => 'start-fa
     push @EXPORT, qw(CFGOPT_START_FAST);
 use constant CFGOPT_STOP_AUTO                                       => 'stop-auto';
     push @EXPORT, qw(CFGOPT_STOP_AUTO);
+use constant CFGOPT_ZERO_ELIDE                                      => 'zero-elide';
+    push @EXPORT, qw(CFGOPT_ZERO_ELIDE);
 
 # Restore options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -400,6 +424,15 @@ use constant CFGOPTVAL_BACKUP_TYPE_DIFF                             => 'diff';
 use constant CFGOPTVAL_BACKUP_TYPE_INCR                             => 'incr';
     push @EXPORT, qw(CFGOPTVAL_BACKUP_TYPE_INCR);
 
+# Compress type
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPTVAL_COMPRESS_TYPE_GZ                             => 'gz';
+    push @EXPORT, qw(CFGOPTVAL_COMPRESS_TYPE_GZ);
+use constant CFGOPTVAL_COMPRESS_TYPE_LZ4                            => 'lz4';
+    push @EXPORT, qw(CFGOPTVAL_COMPRESS_TYPE_LZ4);
+use constant CFGOPTVAL_COMPRESS_TYPE_ZST                            => 'zst';
+    push @EXPORT, qw(CFGOPTVAL_COMPRESS_TYPE_ZST);
+
 # Repo type
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPTVAL_REPO_TYPE_CIFS                               => 'cifs';
@@ -415,6 +448,8 @@ use constant CFGOPTVAL_REPO_CIPHER_TYPE_NONE                        => 'none';
     push @EXPORT, qw(CFGOPTVAL_REPO_CIPHER_TYPE_NONE);
 use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                 => 'aes-256-cbc';
     push @EXPORT, qw(CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC);
+use constant CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM                 => 'aes-256-gcm';
+    push @EXPORT, qw(CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM);
 
 # Info output
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -458,6 +493,8 @@ use constant CFGDEF_DEFAULT_BUFFER_SIZE_MIN                         => 16384;
 
 use constant CFGDEF_DEFAULT_COMPRESS_LEVEL_MIN                      => 0;
 use constant CFGDEF_DEFAULT_COMPRESS_LEVEL_MAX                      => 9;
+# Largest maximum of all compress types -- the range for the configured type is checked when the config is loaded
+use constant CFGDEF_DEFAULT_COMPRESS_LEVEL_TYPE_MAX                 => 19;
 
 use constant CFGDEF_DEFAULT_CONFIG_PATH                             => '/etc/' . PROJECT_EXE;
 use constant CFGDEF_DEFAULT_CONFIG                                  => CFGDEF_DEFAULT_CONFIG_PATH . '/' . PROJECT_CONF;
@@ -1229,6 +1266,20 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_CACHE_DROP =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_REMOTE => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
     &CFGOPT_DB_TIMEOUT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1285,7 +1336,7 @@ my %hConfigDefine =
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
         &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
         &CFGDEF_DEFAULT => 6,
-        &CFGDEF_ALLOW_RANGE => [CFGDEF_DEFAULT_COMPRESS_LEVEL_MIN, CFGDEF_DEFAULT_COMPRESS_LEVEL_MAX],
+        &CFGDEF_ALLOW_RANGE => [CFGDEF_DEFAULT_COMPRESS_LEVEL_MIN, CFGDEF_DEFAULT_COMPRESS_LEVEL_TYPE_MAX],
         &CFGDEF_COMMAND =>
         {
             &CFGCMD_ARCHIVE_GET => {},
@@ -1329,6 +1380,89 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_COMPRESS_THREAD =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 1,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
+    &CFGOPT_COMPRESS_TYPE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => CFGOPTVAL_COMPRESS_TYPE_GZ,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_COMPRESS_TYPE_GZ,
+            &CFGOPTVAL_COMPRESS_TYPE_LZ4,
+            &CFGOPTVAL_COMPRESS_TYPE_ZST,
+        ],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
+    &CFGOPT_DIRECT_IO =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_REMOTE => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
+    &CFGOPT_FILTER_STAT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_GET_ASYNC => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_REMOTE => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
+    &CFGOPT_FILTER_THREAD =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_GET_ASYNC => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_REMOTE => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
     &CFGOPT_NEUTRAL_UMASK =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1497,7 +1631,7 @@ my %hConfigDefine =
         &CFGDEF_DEPEND =>
         {
             &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_CIPHER_TYPE,
-            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC],
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC, CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM],
         },
         &CFGDEF_NAME_ALT =>
         {
@@ -1517,6 +1651,7 @@ my %hConfigDefine =
         [
             &CFGOPTVAL_REPO_CIPHER_TYPE_NONE,
             &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC,
+            &CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM,
         ],
         &CFGDEF_NAME_ALT =>
         {
@@ -2012,6 +2147,21 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_IO_QUEUE_DEPTH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 1,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_REMOTE => {},
+            &CFGCMD_RESTORE => {},
+        }
+    },
+
     &CFGOPT_PROCESS_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2260,6 +2410,28 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_BLOCK_INCR =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
+    &CFGOPT_CHECKSUM_FAST =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
     &CFGOPT_CHECKSUM_PAGE =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2271,6 +2443,38 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_COMPRESS_DICT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_COMPRESS_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_COMPRESS_TYPE_ZST],
+        },
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
+    &CFGOPT_COMPRESS_LEVEL_AUTO =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_COMPRESS,
+            &CFGDEF_DEPEND_LIST => [true],
+        },
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
     &CFGOPT_EXCLUDE =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2327,6 +2531,17 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_ZERO_ELIDE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        }
+    },
+
     # Restore options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_DB_INCLUDE =>
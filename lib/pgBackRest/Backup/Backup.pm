@@ -93,8 +93,11 @@ sub resumeClean
     # Build manifest for aborted backup path
     my $hFile = $oStorageRepo->manifest(STORAGE_REPO_BACKUP . "/${strBackupLabel}");
 
-    # Get compress flag
+    # Get compress flag and the length of the compression extension to remove
     my $bCompressed = $oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);
+    my $iCompressExtSize =
+        length($oAbortedManifest->get(
+            MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ)) + 1;
 
     if (!$bDelta)
     {
@@ -111,7 +114,7 @@ sub resumeClean
             foreach my $strName (sort(keys(%{$hFile})))
             {
                 # Ignore files that will never be in the manifest but should be preserved
-                if ($strName eq FILE_MANIFEST_COPY ||
+                if ($strName eq FILE_MANIFEST_COPY || $strName eq FILE_COMPRESS_DICT ||
                     $strName eq '.')
                 {
                     next;
@@ -124,7 +127,7 @@ sub resumeClean
 
                     if ($bCompressed)
                     {
-                        $strFile = substr($strFile, 0, length($strFile) - 3);
+                        $strFile = substr($strFile, 0, length($strFile) - $iCompressExtSize);
                     }
 
                     # To be preserved the file must exist in the new manifest and not be a reference to a previous backup and must
@@ -152,7 +155,7 @@ sub resumeClean
     foreach my $strName (sort(keys(%{$hFile})))
     {
         # Ignore files that will never be in the manifest but should be preserved
-        if ($strName eq FILE_MANIFEST_COPY ||
+        if ($strName eq FILE_MANIFEST_COPY || $strName eq FILE_COMPRESS_DICT ||
             $strName eq '.')
         {
             next;
@@ -177,15 +180,19 @@ sub resumeClean
 
             if ($bCompressed)
             {
-                $strFile = substr($strFile, 0, length($strFile) - 3);
+                $strFile = substr($strFile, 0, length($strFile) - $iCompressExtSize);
             }
 
             # To be preserved the file must exist in the new manifest and not be a reference to a previous backup
             if ($oManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile) &&
                 !$oManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_REFERENCE))
             {
-                # To be preserved the checksum must be defined
-                my $strChecksum = $oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, false);
+                # To be preserved the checksum must be defined. Block incrementals and files with zero pages elided are not
+                # preserved since the checksum is for the reassembled file and cannot be used to verify the file in the repo.
+                my $strChecksum =
+                    $oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN) ||
+                    $oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_ZERO_ELIDE) ? undef :
+                        $oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, false);
 
                 # If the size and timestamp match OR if the size matches and the delta option is set, then keep the file.
                 # In the latter case, if the timestamp had changed then rather than removing and recopying the file, the file
@@ -200,6 +207,27 @@ sub resumeClean
                 {
                     $oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksum);
 
+                    # Copy the fast checksum if it exists
+                    my $strChecksumFast =
+                        $oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_FAST, false);
+
+                    if (defined($strChecksumFast))
+                    {
+                        $oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_FAST, $strChecksumFast);
+                    }
+
+                    # Copy the compress bypass flag if it exists
+                    if ($oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_BYPASS))
+                    {
+                        $oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);
+                    }
+
+                    # Copy the compress dictionary flag if it exists
+                    if ($oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_DICT))
+                    {
+                        $oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_DICT, true);
+                    }
+
                     # Also copy page checksum results if they exist
                     my $bChecksumPage =
                         $oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_PAGE, false);
@@ -270,10 +298,13 @@ sub processManifest
         $strType,
         $strDbVersion,
         $bCompress,
+        $strCompressType,
+        $bCompressDict,
         $bHardLink,
         $oBackupManifest,
         $strBackupLabel,
         $strLsnStart,
+        $oLastManifest,
     ) =
         logDebugParam
     (
@@ -283,10 +314,13 @@ sub processManifest
         {name => 'strType'},
         {name => 'strDbVersion'},
         {name => 'bCompress'},
+        {name => 'strCompressType'},
+        {name => 'bCompressDict'},
         {name => 'bHardLink'},
         {name => 'oBackupManifest'},
         {name => 'strBackupLabel'},
         {name => 'strLsnStart', required => false},
+        {name => 'oLastManifest', required => false},
     );
 
     # Start backup test point
@@ -336,6 +370,42 @@ sub processManifest
         }
     }
 
+    # Tune the compression level in each process when requested
+    my $bCompressLevelAuto = $bCompress && cfgOption(CFGOPT_COMPRESS_LEVEL_AUTO, false) ? true : false;
+
+    # Record fast checksums and use them to compare files when they were recorded by a prior backup
+    my $bChecksumFast = cfgOption(CFGOPT_CHECKSUM_FAST, false) ? true : false;
+
+    # Store only changed pages of relation files when the prior backup recorded the LSN where it started on the same timeline
+    my $lBlockIncrLsn = 0;
+
+    if (cfgOption(CFGOPT_BLOCK_INCR, false) && cfgOption(CFGOPT_CHECKSUM_PAGE) && defined($oLastManifest))
+    {
+        $lBlockIncrLsn = backupBlockIncrLsn($oLastManifest, $oBackupManifest);
+    }
+
+    # Omit all-zero pages from relation files that are not stored as block incrementals
+    my $bZeroElide = cfgOption(CFGOPT_ZERO_ELIDE, false) ? true : false;
+
+    # Block incremental chain for each file that will be stored as a block incremental
+    my $hBlockIncrChain = {};
+
+    # Were zero pages elided where the chain begins (or from the file itself when there is no chain)?
+    my $hZeroElide = {};
+
+    # Train the compression dictionary unless it already exists in a resumed backup
+    if ($bCompressDict &&
+        !storageRepo()->exists(STORAGE_REPO_BACKUP . "/${strBackupLabel}/" . FILE_COMPRESS_DICT))
+    {
+        $bCompressDict = $self->processCompressDict($strDbCopyPath, $oBackupManifest, $strBackupLabel);
+
+        # Relation files will be compressed without a dictionary if training failed
+        if (!$bCompressDict)
+        {
+            $oBackupManifest->remove(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT);
+        }
+    }
+
     # Iterate all files in the manifest
     foreach my $strRepoFile (
         sort {sprintf("%016d-%s", $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE), $b) cmp
@@ -388,6 +458,37 @@ sub processManifest
         # Increment file total and size
         my $lSize = $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);
 
+        # A relation file can be stored as a block incremental when it was stored in the prior backup without a dictionary. The new
+        # chain is the chain of the prior file followed by the backup where the prior file is stored.
+        my $lFileBlockIncrLsn = 0;
+
+        if ($lBlockIncrLsn != 0 && isChecksumPage($strRepoFile) &&
+            $oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE, false, 0) > 0 &&
+            !$oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT))
+        {
+            $lFileBlockIncrLsn = $lBlockIncrLsn;
+
+            $hBlockIncrChain->{$strRepoFile} =
+            [
+                @{$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, false, [])},
+                $oLastManifest->get(
+                    MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE, false,
+                    $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL)),
+            ];
+
+            $hZeroElide->{$strRepoFile} = $oLastManifest->boolTest(
+                MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE, true) ? true : false;
+        }
+
+        # Elide zero pages from relation files that are not block incrementals. The dictionary is not used for these files since
+        # block incrementals are restored without one.
+        my $bFileZeroElide = $bZeroElide && isChecksumPage($strRepoFile) && $lFileBlockIncrLsn == 0 ? true : false;
+
+        if ($bFileZeroElide)
+        {
+            $hZeroElide->{$strRepoFile} = true;
+        }
+
         $lFileTotal++;
         $lSizeTotal += $lSize;
 
@@ -396,16 +497,21 @@ sub processManifest
             $iHostConfigIdx, $strQueueKey, $strRepoFile, OP_BACKUP_FILE,
             [$strDbFile, $bIgnoreMissing, $lSize,
                 $oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, false),
+                $bChecksumFast ?
+                    $oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST, false) : undef,
                 cfgOption(CFGOPT_CHECKSUM_PAGE) ? isChecksumPage($strRepoFile) : false,
                 defined($strLsnStart) ? hex((split('/', $strLsnStart))[0]) : 0xFFFFFFFF,
                 defined($strLsnStart) ? hex((split('/', $strLsnStart))[1]) : 0xFFFFFFFF,
-                $strRepoFile, defined($strReference) ? true : false, $bCompress, cfgOption(CFGOPT_COMPRESS_LEVEL),
-                $strBackupLabel, cfgOption(CFGOPT_DELTA)],
+                $strRepoFile, defined($strReference) ? true : false, $bCompress ? $strCompressType : 'none',
+                cfgOption(CFGOPT_COMPRESS_LEVEL), cfgOption(CFGOPT_COMPRESS_THREAD), $bCompressLevelAuto,
+                $bCompressDict && isChecksumPage($strRepoFile) && $lFileBlockIncrLsn == 0 && !$bFileZeroElide ? true : false,
+                $strBackupLabel, cfgOption(CFGOPT_DELTA), $bChecksumFast, $lFileBlockIncrLsn, $bFileZeroElide],
             {rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});
 
         # Size and checksum will be removed and then verified later as a sanity check
         $oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);
         $oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM);
+        $oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST);
     }
 
     # pg_control should always be in the backup (unless this is an offline backup)
@@ -442,9 +548,9 @@ sub processManifest
         {
             ($lSizeCurrent, $lManifestSaveCurrent) = backupManifestUpdate(
                 $oBackupManifest, cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $hJob->{iHostConfigIdx}), false),
-                $hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],
-                @{$hJob->{rParam}}[4], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize,
-                $lManifestSaveCurrent);
+                $hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[8], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],
+                @{$hJob->{rParam}}[5], @{$hJob->{rResult}}, $hBlockIncrChain->{@{$hJob->{rParam}}[8]},
+                $hZeroElide->{@{$hJob->{rParam}}[8]}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize, $lManifestSaveCurrent);
         }
 
         # A keep-alive is required here because if there are a large number of resumed files that need to be checksummed
@@ -452,6 +558,9 @@ sub processManifest
         protocolKeepAlive();
     }
 
+    # Log IO statistics gathered from the local processes
+    $oBackupProcess->ioStatLog();
+
     foreach my $strFile ($oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE))
     {
         # If the file has a reference, then it was not copied since it can be retrieved from the referenced backup. However, if
@@ -466,8 +575,8 @@ sub processManifest
                 &log(DETAIL, "hardlink ${strFile} to ${strReference}");
 
                 storageRepo()->linkCreate(
-                    STORAGE_REPO_BACKUP . "/${strReference}/${strFile}" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),
-                    STORAGE_REPO_BACKUP . "/${strBackupLabel}/${strFile}" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),
+                    STORAGE_REPO_BACKUP . "/${strReference}/${strFile}" . ($bCompress ? qw{.} . $strCompressType : ''),
+                    STORAGE_REPO_BACKUP . "/${strBackupLabel}/${strFile}" . ($bCompress ? qw{.} . $strCompressType : ''),
                     {bHard => true});
             }
             # Else log the reference. With delta, it is possible that references may have been removed if a file needed to be
@@ -490,6 +599,75 @@ sub processManifest
     );
 }
 
+####################################################################################################################################
+# processCompressDict
+#
+# Train a compression dictionary on a sample of relation files and store it in the backup.  Returns false when a dictionary could
+# not be trained so relation files can be compressed without one.
+####################################################################################################################################
+sub processCompressDict
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my
+    (
+        $strOperation,
+        $strDbCopyPath,
+        $oBackupManifest,
+        $strBackupLabel,
+    ) =
+        logDebugParam
+    (
+        __PACKAGE__ . '->processCompressDict', \@_,
+        {name => 'strDbCopyPath'},
+        {name => 'oBackupManifest'},
+        {name => 'strBackupLabel'},
+    );
+
+    # Sample the largest relation files since they are the most representative of the data that will be compressed
+    my @stryDbFile;
+
+    foreach my $strRepoFile (
+        sort {$oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE) <=>
+              $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $a, MANIFEST_SUBKEY_SIZE) || $a cmp $b}
+        (grep {isChecksumPage($_)} $oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE, INI_SORT_NONE)))
+    {
+        last if @stryDbFile >= BACKUP_DICT_SAMPLE_FILE_MAX ||
+            $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE) == 0;
+
+        push(@stryDbFile, $oBackupManifest->dbPathGet($strDbCopyPath, $strRepoFile));
+    }
+
+    my $bResult = false;
+
+    if (@stryDbFile > 0)
+    {
+        # Train on a single local process since the sample is small
+        my $oDictProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);
+        $oDictProcess->hostAdd($self->{iCopyRemoteIdx}, 1);
+
+        $oDictProcess->queueJob(
+            $self->{iCopyRemoteIdx}, MANIFEST_TARGET_PGDATA, FILE_COMPRESS_DICT, OP_BACKUP_DICT, [\@stryDbFile, $strBackupLabel],
+            {rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});
+
+        while (my $hyJob = $oDictProcess->process())
+        {
+            foreach my $hJob (@{$hyJob})
+            {
+                $bResult = @{$hJob->{rResult}}[0] ? true : false;
+            }
+        }
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'bResult', value => $bResult}
+    );
+}
+
 ####################################################################################################################################
 # process
 #
@@ -511,6 +689,8 @@ sub process
     # Store local type, compress, and hardlink options since they can be modified by the process
     my $strType = cfgOption(CFGOPT_TYPE);
     my $bCompress = cfgOption(CFGOPT_COMPRESS);
+    my $strCompressType = cfgOption(CFGOPT_COMPRESS_TYPE);
+    my $bCompressDict = $bCompress && cfgOption(CFGOPT_COMPRESS_DICT, false) ? true : false;
     my $bHardLink = cfgOption(CFGOPT_REPO_HARDLINK);
 
     # Load the backup.info
@@ -594,6 +774,17 @@ sub process
                 $bCompress = $oLastManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);
             }
 
+            # Warn if compress-type option changed (manifests without the option were compressed with gz)
+            my $strCompressTypeLast = $oLastManifest->get(
+                MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ);
+
+            if ($bCompress && $strCompressType ne $strCompressTypeLast)
+            {
+                &log(WARN, "${strType} backup cannot alter compress-type option to '${strCompressType}', reset to value in" .
+                           " ${strBackupLastPath}");
+                $strCompressType = $strCompressTypeLast;
+            }
+
             # Warn if hardlink option changed
             if (!$oLastManifest->boolTest(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, $bHardLink))
             {
@@ -682,6 +873,26 @@ sub process
                         $strValueNew = cfgOption(CFGOPT_COMPRESS);
                         $strValueAborted = $oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);
                     }
+                    # Check compression type
+                    elsif ($bCompress &&
+                           $oAbortedManifest->get(
+                               MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false,
+                               CFGOPTVAL_COMPRESS_TYPE_GZ) ne $strCompressType)
+                    {
+                        $strKey = MANIFEST_KEY_COMPRESS_TYPE;
+                        $strValueNew = $strCompressType;
+                        $strValueAborted = $oAbortedManifest->get(
+                            MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ);
+                    }
+                    # Check compression dictionary
+                    elsif ($oAbortedManifest->boolGet(
+                               MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, false, false) != $bCompressDict)
+                    {
+                        $strKey = MANIFEST_KEY_COMPRESS_DICT;
+                        $strValueNew = $bCompressDict;
+                        $strValueAborted = $oAbortedManifest->boolGet(
+                            MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, false, false);
+                    }
                     # Check hardlink
                     elsif ($oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK) !=
                            cfgOption(CFGOPT_REPO_HARDLINK))
@@ -776,6 +987,19 @@ sub process
         MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_LEVEL, undef, cfgOption(CFGOPT_COMPRESS_LEVEL));
     $oBackupManifest->numericSet(
         MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_LEVEL_NETWORK, undef, cfgOption(CFGOPT_COMPRESS_LEVEL_NETWORK));
+
+    # Only store compress-type when it is not gz so manifests remain readable by prior versions whenever possible
+    if ($bCompress && $strCompressType ne CFGOPTVAL_COMPRESS_TYPE_GZ)
+    {
+        $oBackupManifest->set(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, $strCompressType);
+    }
+
+    # Only store compress-dict when it is enabled so manifests remain readable by prior versions whenever possible
+    if ($bCompressDict)
+    {
+        $oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, true);
+    }
+
     $oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, $bHardLink);
     $oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_ONLINE, undef, cfgOption(CFGOPT_ONLINE));
     $oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_ARCHIVE_COPY, undef,
@@ -941,8 +1165,8 @@ sub process
     # Perform the backup
     my $lBackupSizeTotal =
         $self->processManifest(
-            $strDbMasterPath, $strDbCopyPath, $strType, $strDbVersion, $bCompress, $bHardLink, $oBackupManifest, $strBackupLabel,
-            $strLsnStart);
+            $strDbMasterPath, $strDbCopyPath, $strType, $strDbVersion, $bCompress, $strCompressType, $bCompressDict, $bHardLink,
+            $oBackupManifest, $strBackupLabel, $strLsnStart, $oLastManifest);
     &log(INFO, "${strType} backup size = " . fileSizeFormat($lBackupSizeTotal));
 
     # Master file object no longer needed
@@ -973,13 +1197,15 @@ sub process
                 {
                     push(
                         @{$rhyFilter},
-                        {strClass => STORAGE_FILTER_GZIP, rxyParam => [STORAGE_COMPRESS, false, cfgOption(CFGOPT_COMPRESS_LEVEL)]});
+                        compressFilter(
+                            $strCompressType, STORAGE_COMPRESS, cfgOption(CFGOPT_COMPRESS_LEVEL),
+                            cfgOption(CFGOPT_COMPRESS_THREAD)));
                 }
 
                 # If the backups are encrypted, then the passphrase for the backup set from the manifest file is required to access
                 # the file in the repo
                 my $oDestinationFileIo = $oStorageRepo->openWrite(
-                    STORAGE_REPO_BACKUP . "/${strBackupLabel}/${strFile}" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),
+                    STORAGE_REPO_BACKUP . "/${strBackupLabel}/${strFile}" . ($bCompress ? qw{.} . $strCompressType : ''),
                     {rhyFilter => $rhyFilter,
                     strCipherPass => defined($strCipherPassBackupSet) ? $strCipherPassBackupSet : undef});
 
@@ -1031,14 +1257,29 @@ sub process
                 logDebugMisc($strOperation, "archive: ${strArchive} (${strArchiveFile})");
 
                 # Copy the log file from the archive repo to the backup
-                my $bArchiveCompressed = $strArchiveFile =~ ('^.*\.' . COMPRESS_EXT . '\$');
+                my $strArchiveCompressType = compressTypeFromFile($strArchiveFile);
+                my $strBackupCompressType = $bCompress ? $strCompressType : undef;
+
+                # Recompress when the archive compression type does not match the backup
+                my $rhyFilterRead;
+                my $rhyFilterWrite;
+
+                if (($strArchiveCompressType // '') ne ($strBackupCompressType // ''))
+                {
+                    $rhyFilterRead = defined($strArchiveCompressType) ?
+                        [compressFilter($strArchiveCompressType, STORAGE_DECOMPRESS)] : undef;
+                    $rhyFilterWrite = defined($strBackupCompressType) ?
+                        [compressFilter(
+                            $strBackupCompressType, STORAGE_COMPRESS, cfgOption(CFGOPT_COMPRESS_LEVEL),
+                            cfgOption(CFGOPT_COMPRESS_THREAD))] : undef;
+                }
 
                 $oStorageRepo->copy(
                     $oStorageRepo->openRead(STORAGE_REPO_ARCHIVE . "/${strArchiveId}/${strArchiveFile}",
-                        {strCipherPass => $oArchiveInfo->cipherPassSub()}),
+                        {strCipherPass => $oArchiveInfo->cipherPassSub(), rhyFilter => $rhyFilterRead}),
                     $oStorageRepo->openWrite(STORAGE_REPO_BACKUP . "/${strBackupLabel}/" . MANIFEST_TARGET_PGDATA . qw{/} .
-                        $oBackupManifest->walPath() . "/${strArchive}" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),
-                        {bPathCreate => true, strCipherPass => $strCipherPassBackupSet})
+                        $oBackupManifest->walPath() . "/${strArchive}" . ($bCompress ? qw{.} . $strCompressType : ''),
+                        {bPathCreate => true, strCipherPass => $strCipherPassBackupSet, rhyFilter => $rhyFilterWrite})
                     );
 
                 # Add the archive file to the manifest so it can be part of the restore and checked in validation
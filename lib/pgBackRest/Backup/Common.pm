@@ -25,6 +25,13 @@ use pgBackRest::Manifest;
 use constant LINK_LATEST                                            => 'latest';
     push @EXPORT, qw(LINK_LATEST);
 
+####################################################################################################################################
+# Maximum number of relation files sampled to train the compression dictionary (the C side reads at most 128KiB from each file and
+# 4MiB in total)
+####################################################################################################################################
+use constant BACKUP_DICT_SAMPLE_FILE_MAX                            => 32;
+    push @EXPORT, qw(BACKUP_DICT_SAMPLE_FILE_MAX);
+
 ####################################################################################################################################
 # backupRegExpGet
 #
@@ -246,4 +253,51 @@ sub backupLabel
 
 push @EXPORT, qw(backupLabel);
 
+####################################################################################################################################
+# backupBlockIncrLsn
+#
+# Get the LSN cutoff for block incrementals based on the prior backup. Any page changed since the prior backup started must have an
+# LSN at least as high, but only on the same timeline of the same system. After a timeline switch the new timeline may have reused
+# LSNs above the cutoff for different changes, so 0 is returned and all pages are stored.
+####################################################################################################################################
+sub backupBlockIncrLsn
+{
+    # Assign function parameters, defaults, and log debug info
+    my
+    (
+        $strOperation,
+        $oLastManifest,
+        $oBackupManifest,
+    ) =
+        logDebugParam
+        (
+            __PACKAGE__ . '::backupBlockIncrLsn', \@_,
+            {name => 'oLastManifest', trace => true},
+            {name => 'oBackupManifest', trace => true},
+        );
+
+    my $lBlockIncrLsn = 0;
+
+    if ($oLastManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LSN_START) &&
+        $oLastManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START) &&
+        $oBackupManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START) &&
+        substr($oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START), 0, 8) eq
+            substr($oBackupManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START), 0, 8) &&
+        $oLastManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID) eq
+            $oBackupManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID))
+    {
+        my ($strLsnHi, $strLsnLo) = split('/', $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LSN_START));
+        $lBlockIncrLsn = hex($strLsnHi) << 32 | hex($strLsnLo);
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'lBlockIncrLsn', value => $lBlockIncrLsn, trace => true}
+    );
+}
+
+push @EXPORT, qw(backupBlockIncrLsn);
+
 1;
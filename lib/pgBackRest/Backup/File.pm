@@ -37,6 +37,26 @@ use constant BACKUP_FILE_SKIP                                       => 3;
 use constant BACKUP_FILE_NOOP                                       => 4;
     push @EXPORT, qw(BACKUP_FILE_NOOP);
 
+####################################################################################################################################
+# backupManifestChecksumFastSet
+####################################################################################################################################
+sub backupManifestChecksumFastSet
+{
+    my $oManifest = shift;
+    my $strRepoFile = shift;
+    my $strChecksumFast = shift;
+
+    # Store the fast checksum when one was calculated, else remove it so a stale checksum is never compared
+    if (defined($strChecksumFast))
+    {
+        $oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST, $strChecksumFast);
+    }
+    else
+    {
+        $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST);
+    }
+}
+
 ####################################################################################################################################
 # backupManifestUpdate
 ####################################################################################################################################
@@ -59,6 +79,12 @@ sub backupManifestUpdate
         $lSizeRepo,
         $strChecksumCopy,
         $rExtra,
+        $bCompressBypass,
+        $bCompressDict,
+        $strChecksumFastCopy,
+        $bBlockIncr,
+        $rstryBlockIncrChain,
+        $bZeroElide,
         $lSizeTotal,
         $lSizeCurrent,
         $lManifestSaveSize,
@@ -84,6 +110,16 @@ sub backupManifestUpdate
             {name => 'lSizeRepo', required => false, trace => true},
             {name => 'strChecksumCopy', required => false, trace => true},
             {name => 'rExtra', required => false, trace => true},
+            {name => 'bCompressBypass', required => false, trace => true},
+            {name => 'bCompressDict', required => false, trace => true},
+            {name => 'strChecksumFastCopy', required => false, trace => true},
+            {name => 'bBlockIncr', required => false, trace => true},
+
+            # Block incremental chain used when the file was stored as a block incremental
+            {name => 'rstryBlockIncrChain', required => false, trace => true},
+
+            # Were zero pages elided where the chain begins (or from the file itself when there is no chain)?
+            {name => 'bZeroElide', required => false, trace => true},
 
             # Accumulators
             {name => 'lSizeTotal', trace => true},
@@ -101,6 +137,7 @@ sub backupManifestUpdate
         # File copy was not needed so just restore the size and checksum to the manifest
         $oManifest->numericSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE, $lSizeCopy);
         $oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksumCopy);
+        backupManifestChecksumFastSet($oManifest, $strRepoFile, $strChecksumFastCopy);
 
         &log(DETAIL,
             'match file from prior backup ' . (defined($strHost) ? "${strHost}:" : '') . "${strDbFile} (" .
@@ -145,10 +182,50 @@ sub backupManifestUpdate
                 $oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksumCopy);
             }
 
-            # If the file was copied, then remove any reference to the file's existence in a prior backup.
+            backupManifestChecksumFastSet($oManifest, $strRepoFile, $lSizeCopy > 0 ? $strChecksumFastCopy : undef);
+
+            # If the file was copied, then remove any reference to the file's existence in a prior backup and record whether
+            # compression was bypassed, whether the compression dictionary was used, and the block incremental chain
             if ($iCopyResult == BACKUP_FILE_COPY || $iCopyResult == BACKUP_FILE_RECOPY)
             {
                 $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE);
+
+                if ($bCompressBypass)
+                {
+                    $oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);
+                }
+                else
+                {
+                    $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_BYPASS);
+                }
+
+                if ($bCompressDict)
+                {
+                    $oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT, true);
+                }
+                else
+                {
+                    $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT);
+                }
+
+                if ($bBlockIncr && defined($rstryBlockIncrChain))
+                {
+                    $oManifest->set(
+                        MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, $rstryBlockIncrChain);
+                }
+                else
+                {
+                    $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN);
+                }
+
+                if ($bBlockIncr && $bZeroElide)
+                {
+                    $oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE, true);
+                }
+                else
+                {
+                    $oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE);
+                }
             }
 
             # If the file had page checksums calculated during the copy
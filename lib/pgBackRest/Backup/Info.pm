@@ -478,6 +478,13 @@ sub add
             $lBackupSizeDelta += $lFileSize;
             $lBackupRepoSizeDelta += $lRepoSize;
         }
+
+        # Block incrementals also depend on the backups in their chain
+        foreach my $strChainReference (
+            @{$oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFileKey, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, false, [])})
+        {
+            $$oReferenceHash{$strChainReference} = true;
+        }
     }
 
     # Set backup size info
@@ -11,6 +11,10 @@ sub libcAutoConstant
 {
     return
     {
+        CFGOPTVAL_COMPRESS_TYPE_GZ                                       => 'gz',
+        CFGOPTVAL_COMPRESS_TYPE_LZ4                                      => 'lz4',
+        CFGOPTVAL_COMPRESS_TYPE_ZST                                      => 'zst',
+
         CFGOPTVAL_INFO_OUTPUT_TEXT                                       => 'text',
         CFGOPTVAL_INFO_OUTPUT_JSON                                       => 'json',
 
@@ -19,6 +23,7 @@ sub libcAutoConstant
 
         CFGOPTVAL_REPO_CIPHER_TYPE_NONE                                  => 'none',
         CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                           => 'aes-256-cbc',
+        CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM                           => 'aes-256-gcm',
 
         CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL                       => 'full',
         CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF                       => 'diff',
@@ -83,12 +88,16 @@ sub libcAutoExportTag
 
         config =>
         [
+            'CFGOPTVAL_COMPRESS_TYPE_GZ',
+            'CFGOPTVAL_COMPRESS_TYPE_LZ4',
+            'CFGOPTVAL_COMPRESS_TYPE_ZST',
             'CFGOPTVAL_INFO_OUTPUT_TEXT',
             'CFGOPTVAL_INFO_OUTPUT_JSON',
             'CFGOPTVAL_LS_OUTPUT_TEXT',
             'CFGOPTVAL_LS_OUTPUT_JSON',
             'CFGOPTVAL_REPO_CIPHER_TYPE_NONE',
             'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC',
+            'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR',
@@ -142,24 +151,35 @@ sub libcAutoExportTag
             'CFGOPT_ARCHIVE_PUSH_QUEUE_MAX',
             'CFGOPT_ARCHIVE_TIMEOUT',
             'CFGOPT_BACKUP_STANDBY',
+            'CFGOPT_BLOCK_INCR',
             'CFGOPT_BUFFER_SIZE',
             'CFGOPT_C',
+            'CFGOPT_CACHE_DROP',
+            'CFGOPT_CHECKSUM_FAST',
             'CFGOPT_CHECKSUM_PAGE',
             'CFGOPT_CMD_SSH',
             'CFGOPT_COMMAND',
             'CFGOPT_COMPRESS',
+            'CFGOPT_COMPRESS_DICT',
             'CFGOPT_COMPRESS_LEVEL',
+            'CFGOPT_COMPRESS_LEVEL_AUTO',
             'CFGOPT_COMPRESS_LEVEL_NETWORK',
+            'CFGOPT_COMPRESS_THREAD',
+            'CFGOPT_COMPRESS_TYPE',
             'CFGOPT_CONFIG',
             'CFGOPT_CONFIG_INCLUDE_PATH',
             'CFGOPT_CONFIG_PATH',
             'CFGOPT_DB_INCLUDE',
             'CFGOPT_DB_TIMEOUT',
             'CFGOPT_DELTA',
+            'CFGOPT_DIRECT_IO',
             'CFGOPT_EXCLUDE',
             'CFGOPT_FILTER',
+            'CFGOPT_FILTER_STAT',
+            'CFGOPT_FILTER_THREAD',
             'CFGOPT_FORCE',
             'CFGOPT_HOST_ID',
+            'CFGOPT_IO_QUEUE_DEPTH',
             'CFGOPT_LINK_ALL',
             'CFGOPT_LINK_MAP',
             'CFGOPT_LOCK_PATH',
@@ -303,6 +323,7 @@ sub libcAutoExportTag
             'CFGOPT_TEST_DELAY',
             'CFGOPT_TEST_POINT',
             'CFGOPT_TYPE',
+            'CFGOPT_ZERO_ELIDE',
             'cfgCommandName',
             'cfgOptionIndex',
             'cfgOptionIndexTotal',
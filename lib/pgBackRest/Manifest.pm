@@ -32,6 +32,8 @@ use constant FILE_MANIFEST                                          => 'backup.m
     push @EXPORT, qw(FILE_MANIFEST);
 use constant FILE_MANIFEST_COPY                                     => FILE_MANIFEST . INI_COPY_EXT;
     push @EXPORT, qw(FILE_MANIFEST_COPY);
+use constant FILE_COMPRESS_DICT                                     => 'compress.dict';
+    push @EXPORT, qw(FILE_COMPRESS_DICT);
 
 ####################################################################################################################################
 # Default match factor
@@ -109,10 +111,14 @@ use constant MANIFEST_KEY_CHECKSUM_PAGE                             => 'option-'
     push @EXPORT, qw(MANIFEST_KEY_CHECKSUM_PAGE);
 use constant MANIFEST_KEY_COMPRESS                                  => 'option-' . cfgOptionName(CFGOPT_COMPRESS);
     push @EXPORT, qw(MANIFEST_KEY_COMPRESS);
+use constant MANIFEST_KEY_COMPRESS_DICT                             => 'option-' . cfgOptionName(CFGOPT_COMPRESS_DICT);
+    push @EXPORT, qw(MANIFEST_KEY_COMPRESS_DICT);
 use constant MANIFEST_KEY_COMPRESS_LEVEL                            => 'option-' . cfgOptionName(CFGOPT_COMPRESS_LEVEL);
     push @EXPORT, qw(MANIFEST_KEY_COMPRESS_LEVEL);
 use constant MANIFEST_KEY_COMPRESS_LEVEL_NETWORK                    => 'option-' . cfgOptionName(CFGOPT_COMPRESS_LEVEL_NETWORK);
     push @EXPORT, qw(MANIFEST_KEY_COMPRESS_LEVEL_NETWORK);
+use constant MANIFEST_KEY_COMPRESS_TYPE                             => 'option-' . cfgOptionName(CFGOPT_COMPRESS_TYPE);
+    push @EXPORT, qw(MANIFEST_KEY_COMPRESS_TYPE);
 use constant MANIFEST_KEY_ONLINE                                    => 'option-' . cfgOptionName(CFGOPT_ONLINE);
     push @EXPORT, qw(MANIFEST_KEY_ONLINE);
 use constant MANIFEST_KEY_DELTA                                     => 'option-' . cfgOptionName(CFGOPT_DELTA);
@@ -135,12 +141,20 @@ use constant MANIFEST_KEY_DB_VERSION                                => 'db-versi
     push @EXPORT, qw(MANIFEST_KEY_DB_VERSION);
 
 # Subkeys used for path/file/link info
+use constant MANIFEST_SUBKEY_BLOCK_INCR_CHAIN                       => 'block-incr-chain';
+    push @EXPORT, qw(MANIFEST_SUBKEY_BLOCK_INCR_CHAIN);
 use constant MANIFEST_SUBKEY_CHECKSUM                               => 'checksum';
     push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM);
+use constant MANIFEST_SUBKEY_CHECKSUM_FAST                          => 'checksum-fast';
+    push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_FAST);
 use constant MANIFEST_SUBKEY_CHECKSUM_PAGE                          => 'checksum-page';
     push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_PAGE);
 use constant MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR                    => 'checksum-page-error';
     push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR);
+use constant MANIFEST_SUBKEY_COMPRESS_BYPASS                        => 'compress-bypass';
+    push @EXPORT, qw(MANIFEST_SUBKEY_COMPRESS_BYPASS);
+use constant MANIFEST_SUBKEY_COMPRESS_DICT                          => 'compress-dict';
+    push @EXPORT, qw(MANIFEST_SUBKEY_COMPRESS_DICT);
 use constant MANIFEST_SUBKEY_DESTINATION                            => 'destination';
     push @EXPORT, qw(MANIFEST_SUBKEY_DESTINATION);
 use constant MANIFEST_SUBKEY_FILE                                   => 'file';
@@ -171,6 +185,8 @@ use constant MANIFEST_SUBKEY_TABLESPACE_NAME                        => 'tablespa
     push @EXPORT, qw(MANIFEST_SUBKEY_TABLESPACE_NAME);
 use constant MANIFEST_SUBKEY_USER                                   => 'user';
     push @EXPORT, qw(MANIFEST_SUBKEY_USER);
+use constant MANIFEST_SUBKEY_ZERO_ELIDE                             => 'zero-elide';
+    push @EXPORT, qw(MANIFEST_SUBKEY_ZERO_ELIDE);
 
 ####################################################################################################################################
 # Database locations for important files/paths
@@ -1190,6 +1206,13 @@ sub build
                                $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM));
                 }
 
+                # Copy the fast checksum from previous manifest (if it exists)
+                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST))
+                {
+                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST,
+                               $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST));
+                }
+
                 # Copy repo size from the previous manifest (if it exists)
                 if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE))
                 {
@@ -1197,6 +1220,32 @@ sub build
                         $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE));
                 }
 
+                # Copy compress bypass flag from the previous manifest (if it exists)
+                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_BYPASS))
+                {
+                    $self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);
+                }
+
+                # Copy compress dictionary flag from the previous manifest (if it exists)
+                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_DICT))
+                {
+                    $self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_DICT, true);
+                }
+
+                # Copy block incremental chain from the previous manifest (if it exists)
+                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN))
+                {
+                    $self->set(
+                        MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN,
+                        $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN));
+                }
+
+                # Copy zero elide flag from the previous manifest (if it exists)
+                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_ZERO_ELIDE))
+                {
+                    $self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_ZERO_ELIDE, true);
+                }
+
                 # Copy master flag from the previous manifest (if it exists)
                 if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER))
                 {
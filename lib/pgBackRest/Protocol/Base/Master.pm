@@ -25,6 +25,8 @@ use constant OP_NOOP                                                => 'noop';
     push @EXPORT, qw(OP_NOOP);
 use constant OP_EXIT                                                => 'exit';
     push @EXPORT, qw(OP_EXIT);
+use constant OP_IO_STAT                                             => 'ioStat';
+    push @EXPORT, qw(OP_IO_STAT);
 
 ####################################################################################################################################
 # CONSTRUCTOR
@@ -19,6 +19,8 @@ use pgBackRest::Version;
 # Operation constants
 ####################################################################################################################################
 # Backup module
+use constant OP_BACKUP_DICT                                          => 'backupDict';
+    push @EXPORT, qw(OP_BACKUP_DICT);
 use constant OP_BACKUP_FILE                                          => 'backupFile';
     push @EXPORT, qw(OP_BACKUP_FILE);
 
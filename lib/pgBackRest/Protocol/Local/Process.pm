@@ -14,7 +14,9 @@ use IO::Select;
 
 use pgBackRest::Common::Exception;
 use pgBackRest::Common::Log;
+use pgBackRest::Common::String;
 use pgBackRest::Config::Config;
+use pgBackRest::Protocol::Base::Master;
 use pgBackRest::Protocol::Local::Master;
 use pgBackRest::Version;
 
@@ -49,6 +51,9 @@ sub new
     $self->{hHostMap} = {};
     $self->{hyHost} = undef;
 
+    # IO statistics totals gathered from local processes
+    $self->{hIoStat} = {};
+
     # Reset module variables to get ready for queueing
     $self->reset();
 
@@ -450,6 +455,12 @@ sub process
                     # Remove input handle from the map
                     delete($self->{hLocalMap}{$hLocal->{hndIn}});
 
+                    # Add IO statistics from the local process to the totals before it exits
+                    if (cfgOptionValid(CFGOPT_FILTER_STAT) && cfgOption(CFGOPT_FILTER_STAT))
+                    {
+                        $self->ioStatAdd($hLocal->{oLocal}->cmdExecute(OP_IO_STAT));
+                    }
+
                     # Close the local process
                     $hLocal->{oLocal}->close(true);
 
@@ -491,6 +502,52 @@ sub process
     return \@hyResult;
 }
 
+####################################################################################################################################
+# ioStatAdd
+#
+# Add IO statistics from a local process to the totals.  Statistics with the same name are summed.
+####################################################################################################################################
+sub ioStatAdd
+{
+    my $self = shift;
+    my $hIoStat = shift;
+
+    foreach my $strName (keys(%{$hIoStat}))
+    {
+        foreach my $strKey (keys(%{$hIoStat->{$strName}}))
+        {
+            $self->{hIoStat}{$strName}{$strKey} += $hIoStat->{$strName}{$strKey};
+        }
+    }
+}
+
+####################################################################################################################################
+# ioStatLog
+#
+# Log the IO statistics totals in the same format as the C code and reset them.
+####################################################################################################################################
+sub ioStatLog
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my ($strOperation) = logDebugParam(__PACKAGE__ . '->ioStatLog');
+
+    foreach my $strName (sort(keys(%{$self->{hIoStat}})))
+    {
+        my $hIoStat = $self->{hIoStat}{$strName};
+
+        &log(INFO, sprintf(
+            'filter stat %s: cpu %.3fs, wall %.3fs, in %s, out %s', $strName, $hIoStat->{cpu} / 1000000,
+            $hIoStat->{wall} / 1000000, fileSizeFormat($hIoStat->{in}), fileSizeFormat($hIoStat->{out})));
+    }
+
+    $self->{hIoStat} = {};
+
+    # Return from function and log return values if any
+    return logDebugReturn($strOperation);
+}
+
 ####################################################################################################################################
 # queueJob
 #
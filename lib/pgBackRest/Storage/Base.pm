@@ -44,6 +44,8 @@ use constant STORAGE_DECRYPT                                        => 'decrypt'
     push @EXPORT, qw(STORAGE_DECRYPT);
 use constant CIPHER_MAGIC                                           => 'Salted__';
     push @EXPORT, qw(CIPHER_MAGIC);
+use constant CIPHER_MAGIC_CHUNK                                     => 'GcmChunk';
+    push @EXPORT, qw(CIPHER_MAGIC_CHUNK);
 
 ####################################################################################################################################
 # Filter constants
@@ -52,6 +54,10 @@ use constant STORAGE_FILTER_CIPHER_BLOCK                            => 'pgBackRe
     push @EXPORT, qw(STORAGE_FILTER_CIPHER_BLOCK);
 use constant STORAGE_FILTER_GZIP                                    => 'pgBackRest::Storage::Filter::Gzip';
     push @EXPORT, qw(STORAGE_FILTER_GZIP);
+use constant STORAGE_FILTER_LZ4                                     => 'pgBackRest::Storage::Filter::Lz4';
+    push @EXPORT, qw(STORAGE_FILTER_LZ4);
+use constant STORAGE_FILTER_ZST                                     => 'pgBackRest::Storage::Filter::Zst';
+    push @EXPORT, qw(STORAGE_FILTER_ZST);
 use constant STORAGE_FILTER_SHA                                     => 'pgBackRest::Storage::Filter::Sha';
     push @EXPORT, qw(STORAGE_FILTER_SHA);
 
@@ -22,6 +22,15 @@ use pgBackRest::Version;
 ####################################################################################################################################
 use constant COMPRESS_EXT                                           => 'gz';
     push @EXPORT, qw(COMPRESS_EXT);
+use constant COMPRESS_EXT_LZ4                                       => 'lz4';
+    push @EXPORT, qw(COMPRESS_EXT_LZ4);
+use constant COMPRESS_EXT_ZST                                       => 'zst';
+    push @EXPORT, qw(COMPRESS_EXT_ZST);
+
+# Match any compression extension (the extension is the same as the compress-type option value)
+use constant COMPRESS_EXT_LIST                                      => join('|', COMPRESS_EXT, COMPRESS_EXT_LZ4, COMPRESS_EXT_ZST);
+use constant COMPRESS_EXT_REGEXP                                    => '(\\.(' . COMPRESS_EXT_LIST . ')){0,1}';
+    push @EXPORT, qw(COMPRESS_EXT_REGEXP);
 
 ####################################################################################################################################
 # Temp file extension
@@ -50,4 +59,47 @@ sub storageLocal
 
 push @EXPORT, qw(storageLocal);
 
+####################################################################################################################################
+# compressFilter - get the compress/decompress filter for a compression type
+#
+# The compression type is the same as the file extension so the type of a compressed file can be passed directly from its name.
+####################################################################################################################################
+sub compressFilter
+{
+    my $strCompressType = shift;
+    my $strMode = shift;
+    my $iLevel = shift;
+    my $iThread = shift;
+
+    if ($strCompressType eq COMPRESS_EXT_LZ4)
+    {
+        return {strClass => STORAGE_FILTER_LZ4, rxyParam => [$strMode, defined($iLevel) ? $iLevel : 0]};
+    }
+
+    if ($strCompressType eq COMPRESS_EXT_ZST)
+    {
+        return {
+            strClass => STORAGE_FILTER_ZST,
+            rxyParam => [$strMode, defined($iLevel) ? $iLevel : 3, defined($iThread) ? $iThread : 1]};
+    }
+
+    return {strClass => STORAGE_FILTER_GZIP, rxyParam => [$strMode, false, defined($iLevel) ? $iLevel : 6]};
+}
+
+push @EXPORT, qw(compressFilter);
+
+####################################################################################################################################
+# compressTypeFromFile - get the compression type from a file name (undef when the file is not compressed)
+####################################################################################################################################
+sub compressTypeFromFile
+{
+    my $strFile = shift;
+
+    my ($strCompressType) = $strFile =~ ('\.(' . COMPRESS_EXT_LIST . ')$');
+
+    return $strCompressType;
+}
+
+push @EXPORT, qw(compressTypeFromFile);
+
 1;
@@ -1004,7 +1004,8 @@ sub encrypted
         my $lSizeRead = $oFileIo->read(\$tMagicSignature, length(CIPHER_MAGIC));
         $oFileIo->close();
 
-        if (substr($tMagicSignature, 0, length(CIPHER_MAGIC)) eq CIPHER_MAGIC)
+        if (substr($tMagicSignature, 0, length(CIPHER_MAGIC)) eq CIPHER_MAGIC ||
+            substr($tMagicSignature, 0, length(CIPHER_MAGIC_CHUNK)) eq CIPHER_MAGIC_CHUNK)
         {
             $bEncrypted = true;
         }
@@ -6,8 +6,7 @@ Archive Get File
 #include "command/archive/get/file.h"
 #include "command/archive/common.h"
 #include "command/control/common.h"
-#include "common/compress/gzip/common.h"
-#include "common/compress/gzip/decompress.h"
+#include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
 #include "common/io/filter/group.h"
@@ -158,9 +157,11 @@ archiveGetFile(
             }
 
             // If file is compressed then add the decompression filter
-            if (strEndsWithZ(archiveGetCheckResult.archiveFileActual, "." GZIP_EXT))
+            CompressType compressType = compressTypeFromName(archiveGetCheckResult.archiveFileActual);
+
+            if (compressType != compressTypeNone)
             {
-                ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), gzipDecompressNew(false));
+                ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), decompressFilter(compressType, NULL));
                 compressible = false;
             }
 
@@ -364,7 +364,8 @@ cmdArchivePush(void)
                 String *warning = archivePushFile(
                     walFile, archiveInfo.archiveId, archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
                     cipherType(cfgOptionStr(cfgOptRepoCipherType)), archiveInfo.archiveCipherPass,
-                    cfgOptionBool(cfgOptCompress), cfgOptionInt(cfgOptCompressLevel));
+                    cfgOptionBool(cfgOptCompress) ? compressTypeEnum(cfgOptionStr(cfgOptCompressType)) : compressTypeNone,
+                    cfgOptionInt(cfgOptCompressLevel), cfgOptionUInt(cfgOptCompressThread));
 
                 // If a warning was returned then log it
                 if (warning != NULL)
@@ -389,8 +390,9 @@ typedef struct ArchivePushAsyncData
     const StringList *walFileList;                                  // List of wal files to process
     unsigned int walFileIdx;                                        // Current index in the list to be processed
     CipherType cipherType;                                          // Cipher type
-    bool compress;                                                  // Compress wal files
+    CompressType compressType;                                      // Type to compress wal files
     int compressLevel;                                              // Compression level for wal files
+    unsigned int compressThread;                                    // Compression threads for wal files
     ArchivePushCheckResult archiveInfo;                             // Archive info
 } ArchivePushAsyncData;
 
@@ -420,8 +422,9 @@ static ProtocolParallelJob *archivePushAsyncCallback(void *data, unsigned int cl
         protocolCommandParamAdd(command, VARSTR(walFile));
         protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
         protocolCommandParamAdd(command, VARSTR(jobData->archiveInfo.archiveCipherPass));
-        protocolCommandParamAdd(command, VARBOOL(jobData->compress));
+        protocolCommandParamAdd(command, VARUINT(jobData->compressType));
         protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+        protocolCommandParamAdd(command, VARUINT(jobData->compressThread));
 
         FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
     }
@@ -447,8 +450,10 @@ cmdArchivePushAsync(void)
         ArchivePushAsyncData jobData =
         {
             .walPath = strLstGet(commandParam, 0),
-            .compress = cfgOptionBool(cfgOptCompress),
+            .compressType =
+                cfgOptionBool(cfgOptCompress) ? compressTypeEnum(cfgOptionStr(cfgOptCompressType)) : compressTypeNone,
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .compressThread = cfgOptionUInt(cfgOptCompressThread),
         };
 
         TRY_BEGIN()
@@ -0,0 +1,348 @@
+/***********************************************************************************************************************************
+Block Incremental Filter
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+#include <unistd.h>
+
+#include "command/backup/blockIncr.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "postgres/pageChecksum.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(BLOCK_INCR_FILTER_TYPE_STR,                           BLOCK_INCR_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct BlockIncr
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    size_t pageSize;                                                // Page size
+    uint64_t lsnPrior;                                              // Start LSN of the prior backup (0 if none)
+
+    Buffer *page;                                                   // Page being collected from the input
+    unsigned int pageNo;                                            // Page number of the page being collected
+    unsigned int pageTotal;                                         // Total pages stored
+
+    Buffer *record;                                                 // Record waiting to be output
+    size_t recordOffset;                                            // Bytes of the record already output
+
+    size_t inputOffset;                                             // Bytes of the input already processed
+    bool inputSame;                                                 // Is the same input required on the next process call?
+} BlockIncr;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+blockIncrToLog(const BlockIncr *this)
+{
+    return strNewFmt(
+        "{pageNo: %u, pageTotal: %u, inputSame: %s}", this->pageNo, this->pageTotal, cvtBoolToConstZ(this->inputSame));
+}
+
+#define FUNCTION_LOG_BLOCK_INCR_TYPE                                                                                               \
+    BlockIncr *
+#define FUNCTION_LOG_BLOCK_INCR_FORMAT(value, buffer, bufferSize)                                                                  \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, blockIncrToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Create a record for the collected page if it should be stored. Partial pages are always stored since they can only be at the end of
+the file and there is no reliable LSN to check. When there is no prior backup all pages are stored except those that are all zero.
+***********************************************************************************************************************************/
+static void
+blockIncrPage(BlockIncr *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_INCR, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(bufUsed(this->page) > 0);
+    ASSERT(bufUsed(this->record) == 0);
+
+    bool store = true;
+
+    if (bufFull(this->page))
+    {
+        if (this->lsnPrior == 0)
+            store = !bufZero(this->page);
+        else
+        {
+            uint64_t lsn = pageLsn(bufPtr(this->page));
+            store = lsn == 0 || lsn >= this->lsnPrior;
+        }
+    }
+
+    if (store)
+    {
+        unsigned char pageNo[BLOCK_INCR_PAGE_NO_SIZE] =
+        {
+            (unsigned char)(this->pageNo >> 24), (unsigned char)(this->pageNo >> 16), (unsigned char)(this->pageNo >> 8),
+            (unsigned char)this->pageNo,
+        };
+
+        bufCatC(this->record, pageNo, 0, sizeof(pageNo));
+        bufCat(this->record, this->page);
+        this->recordOffset = 0;
+        this->pageTotal++;
+    }
+
+    bufUsedZero(this->page);
+    this->pageNo++;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Output as much of the waiting record as will fit. Returns true when there is no more of the record to output.
+***********************************************************************************************************************************/
+static bool
+blockIncrRecordOutput(BlockIncr *this, Buffer *output)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_INCR, this);
+        FUNCTION_TEST_PARAM(BUFFER, output);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(output != NULL);
+
+    if (bufUsed(this->record) > 0)
+    {
+        size_t outputSize = bufUsed(this->record) - this->recordOffset;
+
+        if (outputSize > bufRemains(output))
+            outputSize = bufRemains(output);
+
+        bufCatSub(output, this->record, this->recordOffset, outputSize);
+        this->recordOffset += outputSize;
+
+        if (this->recordOffset == bufUsed(this->record))
+            bufUsedZero(this->record);
+    }
+
+    FUNCTION_TEST_RETURN(bufUsed(this->record) == 0);
+}
+
+/***********************************************************************************************************************************
+Collect pages from the input and output records for the pages that should be stored
+***********************************************************************************************************************************/
+static void
+blockIncrProcess(THIS_VOID, const Buffer *input, Buffer *output)
+{
+    THIS(BlockIncr);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BLOCK_INCR, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+        FUNCTION_LOG_PARAM(BUFFER, output);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(output != NULL);
+
+    this->inputSame = false;
+
+    // Output the rest of a record that did not fit in the last output buffer
+    if (blockIncrRecordOutput(this, output))
+    {
+        // Collect pages from the input
+        if (input != NULL)
+        {
+            while (this->inputOffset < bufUsed(input))
+            {
+                size_t copySize = bufUsed(input) - this->inputOffset;
+
+                if (copySize > bufRemains(this->page))
+                    copySize = bufRemains(this->page);
+
+                bufCatSub(this->page, input, this->inputOffset, copySize);
+                this->inputOffset += copySize;
+
+                if (bufFull(this->page))
+                {
+                    blockIncrPage(this);
+
+                    if (!blockIncrRecordOutput(this, output))
+                        break;
+                }
+            }
+        }
+        // Else store the partial page at the end of the file, if any
+        else if (bufUsed(this->page) > 0)
+        {
+            blockIncrPage(this);
+            blockIncrRecordOutput(this, output);
+        }
+    }
+
+    // If there is still output waiting then the same input is required again
+    if (input != NULL)
+    {
+        this->inputSame = bufUsed(this->record) > 0;
+
+        if (!this->inputSame)
+            this->inputOffset = 0;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is the filter done?
+***********************************************************************************************************************************/
+static bool
+blockIncrDone(const THIS_VOID)
+{
+    THIS(const BlockIncr);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_INCR, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(bufUsed(this->page) == 0 && bufUsed(this->record) == 0);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+blockIncrInputSame(const THIS_VOID)
+{
+    THIS(const BlockIncr);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_INCR, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+Return the total pages stored
+***********************************************************************************************************************************/
+static Variant *
+blockIncrResult(THIS_VOID)
+{
+    THIS(BlockIncr);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BLOCK_INCR, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewUInt(this->pageTotal));
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+blockIncrNew(size_t pageSize, uint64_t lsnPrior)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SIZE, pageSize);
+        FUNCTION_LOG_PARAM(UINT64, lsnPrior);
+    FUNCTION_LOG_END();
+
+    ASSERT(pageSize > 0);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("BlockIncr")
+    {
+        BlockIncr *driver = memNew(sizeof(BlockIncr));
+
+        *driver = (BlockIncr)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .pageSize = pageSize,
+            .lsnPrior = lsnPrior,
+            .page = bufNew(pageSize),
+            .record = bufNew(BLOCK_INCR_PAGE_NO_SIZE + pageSize),
+        };
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt64(pageSize));
+        varLstAdd(paramList, varNewUInt64(lsnPrior));
+
+        this = ioFilterNewP(
+            BLOCK_INCR_FILTER_TYPE_STR, driver, paramList, .done = blockIncrDone, .inOut = blockIncrProcess,
+            .inputSame = blockIncrInputSame, .result = blockIncrResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+blockIncrNewVar(const VariantList *paramList)
+{
+    return blockIncrNew((size_t)varUInt64Force(varLstGet(paramList, 0)), varUInt64Force(varLstGet(paramList, 1)));
+}
+
+/**********************************************************************************************************************************/
+void
+blockIncrApply(IoRead *read, size_t pageSize, int fd, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(SIZE, pageSize);
+        FUNCTION_LOG_PARAM(INT, fd);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(pageSize > 0);
+    ASSERT(fd != -1);
+    ASSERT(file != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Buffer *pageNo = bufNew(BLOCK_INCR_PAGE_NO_SIZE);
+        Buffer *page = bufNew(pageSize);
+
+        // Read records until the end of the block incremental
+        while (ioRead(read, pageNo) > 0)
+        {
+            if (!bufFull(pageNo))
+                THROW_FMT(FormatError, "block incremental for '%s' ends in a page number", strPtr(file));
+
+            ioRead(read, page);
+
+            if (bufUsed(page) == 0)
+                THROW_FMT(FormatError, "block incremental for '%s' is missing a page", strPtr(file));
+
+            // Write the page to its position in the file
+            off_t offset =
+                (off_t)((unsigned int)bufPtr(pageNo)[0] << 24 | (unsigned int)bufPtr(pageNo)[1] << 16 |
+                (unsigned int)bufPtr(pageNo)[2] << 8 | (unsigned int)bufPtr(pageNo)[3]) * (off_t)pageSize;
+
+            THROW_ON_SYS_ERROR_FMT(
+                pwrite(fd, bufPtr(page), bufUsed(page), offset) != (ssize_t)bufUsed(page), FileWriteError,
+                "unable to write '%s'", strPtr(file));
+
+            bufUsedZero(pageNo);
+            bufUsedZero(page);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -0,0 +1,46 @@
+/***********************************************************************************************************************************
+Block Incremental Filter
+
+Store only the pages of a relation file that have changed since a prior backup. A page is stored when its LSN is greater than or
+equal to the start LSN of the prior backup, since any change made after the prior backup started must have been WAL-logged and
+updated the LSN. New pages (LSN 0) and a trailing partial page are always stored.
+
+When the prior LSN is zero there is no prior backup and every page is stored except those that are all zero, which are common at
+the end of relation segments after bulk loads. These pages are never compressed or encrypted, and on restore they are left as holes.
+
+The output is a sequence of records, each consisting of the page number in the file (four bytes, big-endian) followed by the page.
+Only the last record may contain a partial page. The output is compressed and encrypted like any other repo file. To restore, the
+file is first restored from the oldest backup in its chain and then the records from each block incremental are written in order.
+When the oldest backup stores only the non-zero pages its records are written to an empty file.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_BLOCK_INCR_H
+#define COMMAND_BACKUP_BLOCK_INCR_H
+
+#include "common/io/filter/filter.h"
+#include "common/io/read.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define BLOCK_INCR_FILTER_TYPE                                      "blockIncr"
+    STRING_DECLARE(BLOCK_INCR_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Size of the page number that precedes each page
+***********************************************************************************************************************************/
+#define BLOCK_INCR_PAGE_NO_SIZE                                     4
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+IoFilter *blockIncrNew(size_t pageSize, uint64_t lsnPrior);
+IoFilter *blockIncrNewVar(const VariantList *paramList);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Write the pages in a block incremental to their positions in a file. The read must already be open and the file descriptor must
+// be writable without direct io since pages are written from unaligned buffers. The file name is used for error messages.
+void blockIncrApply(IoRead *read, size_t pageSize, int fd, const String *file);
+
+#endif
@@ -0,0 +1,196 @@
+/***********************************************************************************************************************************
+Backup Checksum Filter
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/backup/checksum.h"
+#include "command/backup/pageChecksum.h"
+#include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/io/filter/size.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/keyValue.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(BACKUP_CHECKSUM_FILTER_TYPE_STR,                      BACKUP_CHECKSUM_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Size of the chunks that each input buffer is split into. This should fit easily in the L2 cache so the data is still cached when
+the next checksum reads it, and must be a multiple of all valid PostgreSQL page sizes so pages are never split between chunks.
+***********************************************************************************************************************************/
+#define BACKUP_CHECKSUM_CHUNK_SIZE                                  ((size_t)64 * 1024)
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct BackupChecksum
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    IoFilter *sha1;                                                 // SHA1 checksum filter (if requested)
+    IoFilter *fast;                                                 // Fast checksum filter (if requested)
+    IoFilter *pageChecksum;                                         // Page checksum filter (if requested)
+    uint64_t size;                                                  // Total size of input
+} BackupChecksum;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_BACKUP_CHECKSUM_TYPE                                                                                          \
+    BackupChecksum *
+#define FUNCTION_LOG_BACKUP_CHECKSUM_FORMAT(value, buffer, bufferSize)                                                             \
+    objToLog(value, "BackupChecksum", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Process each cache-sized chunk of the input with all the checksums before moving on to the next chunk
+***********************************************************************************************************************************/
+static void
+backupChecksumProcess(THIS_VOID, const Buffer *input)
+{
+    THIS(BackupChecksum);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BACKUP_CHECKSUM, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    for (size_t chunkOffset = 0; chunkOffset < bufUsed(input); chunkOffset += BACKUP_CHECKSUM_CHUNK_SIZE)
+    {
+        size_t chunkSize = bufUsed(input) - chunkOffset;
+
+        if (chunkSize > BACKUP_CHECKSUM_CHUNK_SIZE)
+            chunkSize = BACKUP_CHECKSUM_CHUNK_SIZE;
+
+        const Buffer *chunk = BUF(bufPtr(input) + chunkOffset, chunkSize);
+
+        if (this->sha1 != NULL)
+            ioFilterProcessIn(this->sha1, chunk);
+
+        if (this->fast != NULL)
+            ioFilterProcessIn(this->fast, chunk);
+
+        if (this->pageChecksum != NULL)
+            ioFilterProcessIn(this->pageChecksum, chunk);
+    }
+
+    this->size += bufUsed(input);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Return filter result
+***********************************************************************************************************************************/
+static Variant *
+backupChecksumResultAll(THIS_VOID)
+{
+    THIS(BackupChecksum);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BACKUP_CHECKSUM, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    KeyValue *result = kvNew();
+
+    if (this->sha1 != NULL)
+        kvPut(result, VARSTR(CRYPTO_HASH_FILTER_TYPE_STR), ioFilterResult(this->sha1));
+
+    if (this->fast != NULL)
+        kvPut(result, VARSTR(XXHASH_FILTER_TYPE_STR), ioFilterResult(this->fast));
+
+    if (this->pageChecksum != NULL)
+        kvPut(result, VARSTR(PAGE_CHECKSUM_FILTER_TYPE_STR), ioFilterResult(this->pageChecksum));
+
+    kvPut(result, VARSTR(SIZE_FILTER_TYPE_STR), varNewUInt64(this->size));
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewKv(result));
+}
+
+/**********************************************************************************************************************************/
+const Variant *
+backupChecksumResult(const Variant *filterResult, const String *filterType)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VARIANT, filterResult);
+        FUNCTION_TEST_PARAM(STRING, filterType);
+    FUNCTION_TEST_END();
+
+    ASSERT(filterResult != NULL);
+    ASSERT(filterType != NULL);
+
+    FUNCTION_TEST_RETURN(kvGet(varKv(filterResult), VARSTR(filterType)));
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+backupChecksumNew(
+    bool sha1, bool fast, bool pageChecksum, unsigned int segmentNo, unsigned int segmentPageTotal, size_t pageSize,
+    uint64_t lsnLimit)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BOOL, sha1);
+        FUNCTION_LOG_PARAM(BOOL, fast);
+        FUNCTION_LOG_PARAM(BOOL, pageChecksum);
+        FUNCTION_LOG_PARAM(UINT, segmentNo);
+        FUNCTION_LOG_PARAM(UINT, segmentPageTotal);
+        FUNCTION_LOG_PARAM(SIZE, pageSize);
+        FUNCTION_LOG_PARAM(UINT64, lsnLimit);
+    FUNCTION_LOG_END();
+
+    ASSERT(!pageChecksum || (pageSize > 0 && BACKUP_CHECKSUM_CHUNK_SIZE % pageSize == 0));
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("BackupChecksum")
+    {
+        BackupChecksum *driver = memNew(sizeof(BackupChecksum));
+        driver->memContext = memContextCurrent();
+
+        if (sha1)
+            driver->sha1 = cryptoHashNew(HASH_TYPE_SHA1_STR);
+
+        if (fast)
+            driver->fast = xxHashNew();
+
+        if (pageChecksum)
+            driver->pageChecksum = pageChecksumNew(segmentNo, segmentPageTotal, pageSize, lsnLimit);
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewBool(sha1));
+        varLstAdd(paramList, varNewBool(fast));
+        varLstAdd(paramList, varNewBool(pageChecksum));
+        varLstAdd(paramList, varNewUInt(segmentNo));
+        varLstAdd(paramList, varNewUInt(segmentPageTotal));
+        varLstAdd(paramList, varNewUInt64(pageSize));
+        varLstAdd(paramList, varNewUInt64(lsnLimit));
+
+        this = ioFilterNewP(
+            BACKUP_CHECKSUM_FILTER_TYPE_STR, driver, paramList, .in = backupChecksumProcess, .result = backupChecksumResultAll);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+backupChecksumNewVar(const VariantList *paramList)
+{
+    return backupChecksumNew(
+        varBool(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), varBool(varLstGet(paramList, 2)),
+        varUIntForce(varLstGet(paramList, 3)), varUIntForce(varLstGet(paramList, 4)),
+        (size_t)varUInt64Force(varLstGet(paramList, 5)), varUInt64Force(varLstGet(paramList, 6)));
+}
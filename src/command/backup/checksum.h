@@ -0,0 +1,33 @@
+/***********************************************************************************************************************************
+Backup Checksum Filter
+
+Calculate the SHA1 checksum, fast checksum, size, and page checksums of a file in a single pass. Each input buffer is processed in
+chunks small enough to stay in cache so the data is read from memory once rather than once per filter. Results are returned in a
+KeyValue indexed by the filter type that would calculate each result separately, e.g. CRYPTO_HASH_FILTER_TYPE.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_CHECKSUM_H
+#define COMMAND_BACKUP_CHECKSUM_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define BACKUP_CHECKSUM_FILTER_TYPE                                 "backupChecksum"
+    STRING_DECLARE(BACKUP_CHECKSUM_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+IoFilter *backupChecksumNew(
+    bool sha1, bool fast, bool pageChecksum, unsigned int segmentNo, unsigned int segmentPageTotal, size_t pageSize,
+    uint64_t lsnLimit);
+IoFilter *backupChecksumNewVar(const VariantList *paramList);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Get a result from the filter results by the type of filter that would calculate it separately
+const Variant *backupChecksumResult(const Variant *filterResult, const String *filterType);
+
+#endif
@@ -6,6 +6,7 @@ Common Functions and Definitions for Backup and Expire Commands
 #include "command/backup/common.h"
 #include "common/debug.h"
 #include "common/log.h"
+#include "config/config.h"
 
 /***********************************************************************************************************************************
 Constants
@@ -140,3 +141,30 @@ const String *backupTypeStr(BackupType type)
 
     FUNCTION_TEST_RETURN(result);
 }
+
+/***********************************************************************************************************************************
+Get the cipher type used to encrypt and decrypt repo files
+
+The cipher passphrase is only sent when the repo is encrypted. Fall back to aes-256-cbc when the repo cipher type is not available
+to the local process. The type must be passed to decryption as well so files encrypted with aes-256-cbc are rejected when the repo
+is configured for aes-256-gcm.
+***********************************************************************************************************************************/
+CipherType
+backupCipherType(const String *cipherPass)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_TEST_END();
+
+    CipherType result = cipherTypeNone;
+
+    if (cipherPass != NULL)
+    {
+        result = cipherTypeAes256Cbc;
+
+        if (cfgOptionTest(cfgOptRepoCipherType) && cipherType(cfgOptionStr(cfgOptRepoCipherType)) != cipherTypeNone)
+            result = cipherType(cfgOptionStr(cfgOptRepoCipherType));
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -6,6 +6,7 @@ Common Functions and Definitions for Backup and Expire Commands
 
 #include <stdbool.h>
 
+#include "common/crypto/common.h"
 #include "common/type/string.h"
 
 /***********************************************************************************************************************************
@@ -46,4 +47,9 @@ Convert text backup type to an enum and back
 BackupType backupType(const String *type);
 const String *backupTypeStr(BackupType type);
 
+/***********************************************************************************************************************************
+Get the cipher type used to encrypt and decrypt repo files
+***********************************************************************************************************************************/
+CipherType backupCipherType(const String *cipherPass);
+
 #endif
@@ -0,0 +1,216 @@
+/***********************************************************************************************************************************
+Backup Compression Dictionary
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/backup/dict.h"
+#include "common/compress/zst/dict.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/debug.h"
+#include "common/io/filter/group.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/list.h"
+#include "info/manifest.h"
+#include "postgres/interface.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Local variables
+***********************************************************************************************************************************/
+typedef struct BackupDictCache
+{
+    const String *backupLabel;                                      // Label of the backup the dictionary was loaded from
+    const Buffer *dict;                                             // Compression dictionary
+} BackupDictCache;
+
+static struct
+{
+    MemContext *memContext;                                         // Mem context
+    List *cacheList;                                                // Dictionaries loaded so far
+} backupDictLocal;
+
+/***********************************************************************************************************************************
+Path to the dictionary in the repo
+***********************************************************************************************************************************/
+static String *
+backupDictFile(const String *backupLabel)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, backupLabel);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_COMPRESS_DICT_FILE, strPtr(backupLabel)));
+}
+
+/**********************************************************************************************************************************/
+bool
+backupDictCreate(const StringList *pgFileList, const String *backupLabel, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, pgFileList);                // Database files to sample
+        FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to encrypt the dictionary
+    FUNCTION_LOG_END();
+
+    ASSERT(pgFileList != NULL);
+    ASSERT(backupLabel != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    bool result = false;
+
+#ifdef HAVE_LIBZSTD
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read the start of each file until the sample is full. Files may be removed by PostgreSQL while the sample is collected so
+        // missing files are ignored.
+        Buffer *sample = bufNew(BACKUP_DICT_SAMPLE_SIZE);
+        Buffer *fileSample = bufNew(BACKUP_DICT_SAMPLE_FILE_SIZE);
+        unsigned int fileTotal = 0;
+
+        for (unsigned int pgFileIdx = 0; pgFileIdx < strLstSize(pgFileList) && !bufFull(sample); pgFileIdx++)
+        {
+            IoRead *read = storageReadIo(storageNewReadP(storagePg(), strLstGet(pgFileList, pgFileIdx), .ignoreMissing = true));
+
+            if (ioReadOpen(read))
+            {
+                bufUsedZero(fileSample);
+                bufLimitSet(fileSample, bufRemains(sample) < bufSize(fileSample) ? bufRemains(sample) : bufSize(fileSample));
+
+                ioRead(read, fileSample);
+                ioReadClose(read);
+
+                // Only whole pages are useful for training
+                bufUsedSet(fileSample, bufUsed(fileSample) / PG_PAGE_SIZE_DEFAULT * PG_PAGE_SIZE_DEFAULT);
+                bufCat(sample, fileSample);
+                fileTotal++;
+            }
+        }
+
+        LOG_DETAIL("train compression dictionary with %zu bytes from %u file(s)", bufUsed(sample), fileTotal);
+
+        // Train the dictionary and store it in the backup path
+        Buffer *dict = zstDictTrain(sample, PG_PAGE_SIZE_DEFAULT, ZST_DICT_SIZE_DEFAULT);
+
+        if (dict != NULL)
+        {
+            StorageWrite *write = storageNewWriteNP(storageRepoWrite(), backupDictFile(backupLabel));
+
+            if (cipherType != cipherTypeNone)
+            {
+                ioFilterGroupAdd(
+                    ioWriteFilterGroup(storageWriteIo(write)),
+                    cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
+            }
+
+            storagePutNP(write, dict);
+            result = true;
+        }
+        else
+            LOG_WARN("unable to train compression dictionary, relation files will be compressed without a dictionary");
+    }
+    MEM_CONTEXT_TEMP_END();
+#else
+    (void)pgFileList;
+    (void)backupLabel;
+    (void)cipherType;
+    (void)cipherPass;
+#endif
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+backupDictLoad(const String *backupLabel, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of the backup that contains the dictionary
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to decrypt the dictionary
+    FUNCTION_LOG_END();
+
+    ASSERT(backupLabel != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StorageRead *read = storageNewReadNP(storageRepo(), backupDictFile(backupLabel));
+
+        if (cipherType != cipherTypeNone)
+        {
+            ioFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)), cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
+        }
+
+        result = bufMove(storageGetNP(read), MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+const Buffer *
+backupDictGet(const String *backupLabel, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of the backup that contains the dictionary
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to decrypt the dictionary
+    FUNCTION_LOG_END();
+
+    ASSERT(backupLabel != NULL);
+
+    const Buffer *result = NULL;
+
+    if (backupDictLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            backupDictLocal.memContext = memContextNew("BackupDictLocal");
+
+            MEM_CONTEXT_BEGIN(backupDictLocal.memContext)
+            {
+                backupDictLocal.cacheList = lstNew(sizeof(BackupDictCache));
+            }
+            MEM_CONTEXT_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Search the cache. There will only be a few entries (one per backup in the set) so a linear search is fine.
+    for (unsigned int cacheIdx = 0; cacheIdx < lstSize(backupDictLocal.cacheList); cacheIdx++)
+    {
+        const BackupDictCache *cache = lstGet(backupDictLocal.cacheList, cacheIdx);
+
+        if (strEq(cache->backupLabel, backupLabel))
+        {
+            result = cache->dict;
+            break;
+        }
+    }
+
+    // Load the dictionary if it was not found
+    if (result == NULL)
+    {
+        MEM_CONTEXT_BEGIN(backupDictLocal.memContext)
+        {
+            BackupDictCache cache =
+            {
+                .backupLabel = strDup(backupLabel),
+                .dict = backupDictLoad(backupLabel, cipherType, cipherPass),
+            };
+
+            lstAdd(backupDictLocal.cacheList, &cache);
+            result = cache.dict;
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, result);
+}
@@ -0,0 +1,35 @@
+/***********************************************************************************************************************************
+Backup Compression Dictionary
+
+A zst dictionary is trained from the first pages of a sample of relation files at the start of the backup and stored in the backup
+path. All relation files in the backup are then compressed with the dictionary, which must be loaded again to restore them.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_DICT_H
+#define COMMAND_BACKUP_DICT_H
+
+#include "common/crypto/common.h"
+#include "common/type/buffer.h"
+#include "common/type/stringList.h"
+
+/***********************************************************************************************************************************
+Sample limits. Only the start of each file is sampled since that is enough to capture the common page structure and reading whole
+files would delay the start of the backup.
+***********************************************************************************************************************************/
+#define BACKUP_DICT_SAMPLE_FILE_SIZE                                ((size_t)128 * 1024)
+#define BACKUP_DICT_SAMPLE_SIZE                                     ((size_t)4 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Train a dictionary from a sample of pg files and store it in the backup path. Returns false when there is not enough data to
+// train a dictionary, in which case no dictionary is stored and relation files should be compressed without one.
+bool backupDictCreate(const StringList *pgFileList, const String *backupLabel, CipherType cipherType, const String *cipherPass);
+
+// Load the dictionary stored in the backup path
+Buffer *backupDictLoad(const String *backupLabel, CipherType cipherType, const String *cipherPass);
+
+// Get the dictionary for a backup, loading it only the first time it is requested. This is used by the protocol handlers since
+// every relation file in a backup (and possibly other backups it references) will need a dictionary.
+const Buffer *backupDictGet(const String *backupLabel, CipherType cipherType, const String *cipherPass);
+
+#endif
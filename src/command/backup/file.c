@@ -5,13 +5,15 @@ Backup File
 
 #include <string.h>
 
+#include "command/backup/blockIncr.h"
+#include "command/backup/checksum.h"
 #include "command/backup/file.h"
 #include "command/backup/pageChecksum.h"
-#include "common/compress/gzip/common.h"
-#include "common/compress/gzip/compress.h"
-#include "common/compress/gzip/decompress.h"
+#include "common/compress/adaptive.h"
+#include "common/compress/levelAuto.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
 #include "common/debug.h"
 #include "common/io/filter/group.h"
 #include "common/io/filter/size.h"
@@ -36,28 +38,90 @@ segmentNumber(const String *pgFile)
     FUNCTION_TEST_RETURN(regExpMatchOne(STRDEF("\\.[0-9]+$"), pgFile) ? cvtZToUInt(strrchr(strPtr(pgFile), '.') + 1) : 0);
 }
 
+// Add filter to checksum a file. SHA1 is only needed when there is no fast checksum to compare.
+static void
+backupFileChecksumFilterAdd(IoFilterGroup *filterGroup, const String *pgFileChecksumFast, bool checksumFast)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, filterGroup);
+        FUNCTION_TEST_PARAM(STRING, pgFileChecksumFast);
+        FUNCTION_TEST_PARAM(BOOL, checksumFast);
+    FUNCTION_TEST_END();
+
+    ioFilterGroupAdd(
+        filterGroup, backupChecksumNew(pgFileChecksumFast == NULL, pgFileChecksumFast != NULL || checksumFast, false, 0, 0, 0, 0));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Does the file match the expected size and checksum? Compare the fast checksum when there is one, in which case the SHA1 is
+// taken from the expected checksum since it was not calculated.
+static bool
+backupFileChecksumMatch(
+    const IoFilterGroup *filterGroup, uint64_t pgFileSize, const String *pgFileChecksum, const String *pgFileChecksumFast,
+    BackupFileResult *result)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, filterGroup);
+        FUNCTION_TEST_PARAM(UINT64, pgFileSize);
+        FUNCTION_TEST_PARAM(STRING, pgFileChecksum);
+        FUNCTION_TEST_PARAM(STRING, pgFileChecksumFast);
+        FUNCTION_TEST_PARAM_P(VOID, result);
+    FUNCTION_TEST_END();
+
+    const Variant *checksumResult = ioFilterGroupResult(filterGroup, BACKUP_CHECKSUM_FILTER_TYPE_STR);
+    const String *checksum =
+        pgFileChecksumFast == NULL ? varStr(backupChecksumResult(checksumResult, CRYPTO_HASH_FILTER_TYPE_STR)) : pgFileChecksum;
+    const Variant *checksumFast = backupChecksumResult(checksumResult, XXHASH_FILTER_TYPE_STR);
+    uint64_t size = varUInt64Force(backupChecksumResult(checksumResult, SIZE_FILTER_TYPE_STR));
+
+    bool match =
+        pgFileSize == size &&
+        (pgFileChecksumFast == NULL ? strEq(pgFileChecksum, checksum) : strEq(pgFileChecksumFast, varStr(checksumFast)));
+
+    // Store the size and checksums in the result if they match
+    if (match)
+    {
+        result->copySize = size;
+        result->copyChecksum = strDup(checksum);
+        result->copyChecksumFast = checksumFast == NULL ? NULL : strDup(varStr(checksumFast));
+    }
+
+    FUNCTION_TEST_RETURN(match);
+}
+
 /***********************************************************************************************************************************
 Copy a file from the PostgreSQL data directory to the repository
 ***********************************************************************************************************************************/
 BackupFileResult
 backupFile(
-    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum, bool pgFileChecksumPage,
-    uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference, bool repoFileCompress,
-    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass)
+    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum,
+    const String *pgFileChecksumFast, bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, uint64_t pgFileBlockIncrLsn,
+    bool pgFileZeroElide, const String *repoFile, bool repoFileHasReference, CompressType repoFileCompressType,
+    unsigned int repoFileCompressLevel, unsigned int repoFileCompressThread, bool repoFileCompressLevelAuto,
+    const Buffer *repoFileCompressDict, const String *backupLabel, bool delta, bool checksumFast, CipherType cipherType,
+    const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, pgFile);                         // Database file to copy to the repo
         FUNCTION_LOG_PARAM(BOOL, pgFileIgnoreMissing);              // Is it OK if the database file is missing?
         FUNCTION_LOG_PARAM(UINT64, pgFileSize);                     // Size of the database file
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);                 // Checksum to verify the database file
+        FUNCTION_LOG_PARAM(STRING, pgFileChecksumFast);             // Fast checksum to verify the database file (if recorded)
         FUNCTION_LOG_PARAM(BOOL, pgFileChecksumPage);               // Should page checksums be validated
         FUNCTION_LOG_PARAM(UINT64, pgFileChecksumPageLsnLimit);     // Upper LSN limit to which page checksums must be valid
+        FUNCTION_LOG_PARAM(UINT64, pgFileBlockIncrLsn);             // Store only pages changed since this LSN (0 for all pages)
+        FUNCTION_LOG_PARAM(BOOL, pgFileZeroElide);                  // Store only pages that are not all zero (if no LSN)
         FUNCTION_LOG_PARAM(STRING, repoFile);                       // Destination in the repo to copy the pg file
         FUNCTION_LOG_PARAM(BOOL, repoFileHasReference);             // Does the repo file exists in a prior backup in the set?
-        FUNCTION_LOG_PARAM(BOOL, repoFileCompress);                 // Compress destination file
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for destination file
         FUNCTION_LOG_PARAM(UINT, repoFileCompressLevel);            // Compression level for destination file
+        FUNCTION_LOG_PARAM(UINT, repoFileCompressThread);           // Compression threads for destination file
+        FUNCTION_LOG_PARAM(BOOL, repoFileCompressLevelAuto);        // Tune the compression level from measured throughput?
+        FUNCTION_LOG_PARAM(BUFFER, repoFileCompressDict);           // Compression dictionary for destination file
         FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
+        FUNCTION_LOG_PARAM(BOOL, checksumFast);                     // Should a fast checksum be recorded?
         FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
     FUNCTION_LOG_END();
@@ -65,6 +129,9 @@ backupFile(
     ASSERT(pgFile != NULL);
     ASSERT(repoFile != NULL);
     ASSERT(backupLabel != NULL);
+    ASSERT(pgFileChecksumFast == NULL || pgFileChecksum != NULL);
+    ASSERT(repoFileCompressDict == NULL || repoFileCompressType == compressTypeZst);
+    ASSERT((pgFileBlockIncrLsn == 0 && !pgFileZeroElide) || repoFileCompressDict == NULL);
     ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
 
     // Backup file results
@@ -74,7 +141,8 @@ backupFile(
     {
         // Generate complete repo path and add compression extension if needed
         const String *repoPathFile = strNewFmt(
-            STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(backupLabel), strPtr(repoFile), repoFileCompress ? "." GZIP_EXT : "");
+            STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(backupLabel), strPtr(repoFile),
+            compressExtZ(repoFileCompressType));
 
         // If checksum is defined then the file needs to be checked. If delta option then check the DB and possibly the repo, else
         // just check the repo.
@@ -89,31 +157,20 @@ backupFile(
             {
                 // Generate checksum/size for the pg file
                 IoRead *read = storageReadIo(storageNewReadP(storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing));
-                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-                ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+                backupFileChecksumFilterAdd(ioReadFilterGroup(read), pgFileChecksumFast, checksumFast);
 
                 // If the pg file exists check the checksum/size
                 if (ioReadDrain(read))
                 {
-                    const String *pgTestChecksum = varStr(
-                        ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
-                    uint64_t pgTestSize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
-
                     // Does the pg file match?
-                    if (pgFileSize == pgTestSize && strEq(pgFileChecksum, pgTestChecksum))
-                    {
-                        pgFileMatch = true;
-
-                        // If it matches and is a reference to a previous backup then no need to copy the file
-                        if (repoFileHasReference)
-                        {
-                            memContextSwitch(MEM_CONTEXT_OLD());
-                            result.backupCopyResult = backupCopyResultNoOp;
-                            result.copySize = pgTestSize;
-                            result.copyChecksum = strDup(pgTestChecksum);
-                            memContextSwitch(MEM_CONTEXT_TEMP());
-                        }
-                    }
+                    memContextSwitch(MEM_CONTEXT_OLD());
+                    pgFileMatch = backupFileChecksumMatch(
+                        ioReadFilterGroup(read), pgFileSize, pgFileChecksum, pgFileChecksumFast, &result);
+                    memContextSwitch(MEM_CONTEXT_TEMP());
+
+                    // If it matches and is a reference to a previous backup then no need to copy the file
+                    if (pgFileMatch && repoFileHasReference)
+                        result.backupCopyResult = backupCopyResultNoOp;
                 }
                 // Else the source file is missing from the database so skip this file
                 else
@@ -142,28 +199,21 @@ backupFile(
                             ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
                     }
 
-                    if (repoFileCompress)
-                        ioFilterGroupAdd(ioReadFilterGroup(read), gzipDecompressNew(false));
+                    if (repoFileCompressType != compressTypeNone)
+                        ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilter(repoFileCompressType, repoFileCompressDict));
 
-                    ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-                    ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+                    backupFileChecksumFilterAdd(ioReadFilterGroup(read), pgFileChecksumFast, checksumFast);
 
                     ioReadDrain(read);
 
-                    // Test checksum/size
-                    const String *pgTestChecksum = varStr(
-                        ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
-                    uint64_t pgTestSize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
-
                     // No need to recopy if checksum/size match
-                    if (pgFileSize == pgTestSize && strEq(pgFileChecksum, pgTestChecksum))
-                    {
-                        memContextSwitch(MEM_CONTEXT_OLD());
+                    memContextSwitch(MEM_CONTEXT_OLD());
+                    bool repoFileMatch = backupFileChecksumMatch(
+                        ioReadFilterGroup(read), pgFileSize, pgFileChecksum, pgFileChecksumFast, &result);
+                    memContextSwitch(MEM_CONTEXT_TEMP());
+
+                    if (repoFileMatch)
                         result.backupCopyResult = backupCopyResultChecksum;
-                        result.copySize = pgTestSize;
-                        result.copyChecksum = strDup(pgTestChecksum);
-                        memContextSwitch(MEM_CONTEXT_TEMP());
-                    }
                     // Else recopy when repo file is not as expected
                     else
                         result.backupCopyResult = backupCopyResultReCopy;
@@ -175,25 +225,40 @@ backupFile(
         if (result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy)
         {
             // Is the file compressible during the copy?
-            bool compressible = !repoFileCompress && cipherType == cipherTypeNone;
+            bool compressible = repoFileCompressType == compressTypeNone && cipherType == cipherTypeNone;
 
             // Setup pg file for read
             StorageRead *read = storageNewReadP(
                 storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing, .compressible = compressible);
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), ioSizeNew());
 
-            // Add page checksum filter
-            if (pgFileChecksumPage)
+            // Add checksum filter that calculates SHA1, size, and (optionally) fast and page checksums in a single pass
+            ioFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)),
+                backupChecksumNew(
+                    true, checksumFast, pgFileChecksumPage, pgFileChecksumPage ? segmentNumber(pgFile) : 0, PG_SEGMENT_PAGE_DEFAULT,
+                    PG_PAGE_SIZE_DEFAULT, pgFileChecksumPageLsnLimit));
+
+            // Store only the pages that changed since the prior backup when requested, or else only the pages that are not all
+            // zero. Zero pages are dropped before compression and encryption so no time is spent on them. The checksums above are
+            // still calculated on the entire file so they can be used to verify the file after it has been reassembled on restore.
+            if (pgFileBlockIncrLsn != 0 || pgFileZeroElide)
             {
                 ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), pageChecksumNew(segmentNumber(pgFile), PG_SEGMENT_PAGE_DEFAULT,
-                    PG_PAGE_SIZE_DEFAULT, pgFileChecksumPageLsnLimit));
+                    ioReadFilterGroup(storageReadIo(read)), blockIncrNew(PG_PAGE_SIZE_DEFAULT, pgFileBlockIncrLsn));
+                result.blockIncr = true;
             }
 
-            // Add compression
-            if (repoFileCompress)
-                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), gzipCompressNew((int)repoFileCompressLevel, false));
+            // Add compression. Compression is bypassed when the data does not appear to be compressible.
+            if (repoFileCompressType != compressTypeNone)
+            {
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(storageReadIo(read)),
+                    compressAdaptiveNew(
+                        repoFileCompressType,
+                        repoFileCompressLevelAuto ?
+                            compressLevelAutoGet(repoFileCompressType, (int)repoFileCompressLevel) : (int)repoFileCompressLevel,
+                        repoFileCompressThread, repoFileCompressDict));
+            }
 
             // If there is a cipher then add the encrypt filter
             if (cipherType != cipherTypeNone)
@@ -210,21 +275,44 @@ backupFile(
             // Open the source and destination and copy the file
             if (storageCopy(read, write))
             {
+                const Variant *checksumResult = ioFilterGroupResult(
+                    ioReadFilterGroup(storageReadIo(read)), BACKUP_CHECKSUM_FILTER_TYPE_STR);
+
                 memContextSwitch(MEM_CONTEXT_OLD());
 
                 // Get sizes and checksum
-                result.copySize = varUInt64Force(
-                    ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), SIZE_FILTER_TYPE_STR));
-                result.copyChecksum = strDup(
-                    varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_FILTER_TYPE_STR)));
+                result.copySize = varUInt64Force(backupChecksumResult(checksumResult, SIZE_FILTER_TYPE_STR));
+                result.copyChecksum = strDup(varStr(backupChecksumResult(checksumResult, CRYPTO_HASH_FILTER_TYPE_STR)));
                 result.repoSize =
                     varUInt64Force(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(write)), SIZE_FILTER_TYPE_STR));
 
+                if (checksumFast)
+                    result.copyChecksumFast = strDup(varStr(backupChecksumResult(checksumResult, XXHASH_FILTER_TYPE_STR)));
+
+                // Was compression bypassed? The dictionary is used either way.
+                if (repoFileCompressType != compressTypeNone)
+                {
+                    const KeyValue *compressResult = varKv(
+                        ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), COMPRESS_ADAPTIVE_FILTER_TYPE_STR));
+
+                    result.compressBypass = varBool(kvGet(compressResult, COMPRESS_ADAPTIVE_RESULT_BYPASS_VAR));
+                    result.compressDict = repoFileCompressDict != NULL;
+
+                    // Tune the level for the next file by comparing compression with the time spent waiting on the source and repo
+                    // drivers. Skip bypassed files since their timing says nothing about the level.
+                    if (repoFileCompressLevelAuto && !result.compressBypass)
+                    {
+                        compressLevelAutoUpdate(
+                            repoFileCompressType, result.copySize,
+                            varUInt64(kvGet(compressResult, COMPRESS_ADAPTIVE_RESULT_TIME_VAR)),
+                            ioReadStat(storageReadIo(read))->timeWall + ioWriteStat(storageWriteIo(write))->timeWall);
+                    }
+                }
+
                 // Get results of page checksum validation
                 if (pgFileChecksumPage)
                 {
-                    result.pageChecksumResult = kvDup(
-                        varKv(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), PAGE_CHECKSUM_FILTER_TYPE_STR)));
+                    result.pageChecksumResult = kvDup(varKv(backupChecksumResult(checksumResult, PAGE_CHECKSUM_FILTER_TYPE_STR)));
                 }
 
                 memContextSwitch(MEM_CONTEXT_TEMP());
@@ -4,6 +4,7 @@ Backup File
 #ifndef COMMAND_BACKUP_FILE_H
 #define COMMAND_BACKUP_FILE_H
 
+#include "common/compress/helper.h"
 #include "common/crypto/common.h"
 #include "common/type/keyValue.h"
 
@@ -27,14 +28,21 @@ typedef struct BackupFileResult
     BackupCopyResult backupCopyResult;
     uint64_t copySize;
     String *copyChecksum;
+    String *copyChecksumFast;
     uint64_t repoSize;
+    bool compressBypass;
+    bool compressDict;
+    bool blockIncr;
     KeyValue *pageChecksumResult;
 } BackupFileResult;
 
 BackupFileResult backupFile(
-    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum, bool pgFileChecksumPage,
-    uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference, bool repoFileCompress,
-    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass);
+    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum,
+    const String *pgFileChecksumFast, bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, uint64_t pgFileBlockIncrLsn,
+    bool pgFileZeroElide, const String *repoFile, bool repoFileHasReference, CompressType repoFileCompressType,
+    unsigned int repoFileCompressLevel, unsigned int repoFileCompressThread, bool repoFileCompressLevelAuto,
+    const Buffer *repoFileCompressDict, const String *backupLabel, bool delta, bool checksumFast, CipherType cipherType,
+    const String *cipherPass);
 
 /***********************************************************************************************************************************
 Macros for function logging
@@ -3,6 +3,8 @@ Backup Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/backup/common.h"
+#include "command/backup/dict.h"
 #include "command/backup/file.h"
 #include "command/backup/protocol.h"
 #include "common/debug.h"
@@ -15,6 +17,7 @@ Backup Protocol Handler
 /***********************************************************************************************************************************
 Constants
 ***********************************************************************************************************************************/
+STRING_EXTERN(PROTOCOL_COMMAND_BACKUP_DICT_STR,                     PROTOCOL_COMMAND_BACKUP_DICT);
 STRING_EXTERN(PROTOCOL_COMMAND_BACKUP_FILE_STR,                     PROTOCOL_COMMAND_BACKUP_FILE);
 
 /***********************************************************************************************************************************
@@ -38,15 +41,23 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
     {
         if (strEq(command, PROTOCOL_COMMAND_BACKUP_FILE_STR))
         {
+            const String *backupLabel = varStr(varLstGet(paramList, 15));
+            const String *cipherPass = varLstSize(paramList) == 21 ? varStr(varLstGet(paramList, 20)) : NULL;
+            CipherType cipherType = backupCipherType(cipherPass);
+
             // Backup the file
             BackupFileResult result = backupFile(
                 varStr(varLstGet(paramList, 0)), varBoolForce(varLstGet(paramList, 1)), varUInt64(varLstGet(paramList, 2)),
-                varStr(varLstGet(paramList, 3)), varBoolForce(varLstGet(paramList, 4)),
-                varUInt64(varLstGet(paramList, 5)) << 32 | varUInt64(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)),
-                varBoolForce(varLstGet(paramList, 8)), varBoolForce(varLstGet(paramList, 9)),
-                varUIntForce(varLstGet(paramList, 10)), varStr(varLstGet(paramList, 11)), varBoolForce(varLstGet(paramList, 12)),
-                varLstSize(paramList) == 14 ? cipherTypeAes256Cbc : cipherTypeNone,
-                varLstSize(paramList) == 14 ? varStr(varLstGet(paramList, 13)) : NULL);
+                varStr(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)), varBoolForce(varLstGet(paramList, 5)),
+                varUInt64(varLstGet(paramList, 6)) << 32 | varUInt64(varLstGet(paramList, 7)),
+                varUInt64Force(varLstGet(paramList, 18)), varBoolForce(varLstGet(paramList, 19)), varStr(varLstGet(paramList, 8)),
+                varBoolForce(varLstGet(paramList, 9)),
+                compressTypeEnum(varStr(varLstGet(paramList, 10))),
+                varUIntForce(varLstGet(paramList, 11)), varUIntForce(varLstGet(paramList, 12)),
+                varBoolForce(varLstGet(paramList, 13)),
+                varBoolForce(varLstGet(paramList, 14)) ? backupDictGet(backupLabel, cipherType, cipherPass) : NULL,
+                backupLabel, varBoolForce(varLstGet(paramList, 16)), varBoolForce(varLstGet(paramList, 17)), cipherType,
+                cipherPass);
 
             // Return backup result
             VariantList *resultList = varLstNew();
@@ -55,9 +66,24 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
             varLstAdd(resultList, varNewUInt64(result.repoSize));
             varLstAdd(resultList, varNewStr(result.copyChecksum));
             varLstAdd(resultList, result.pageChecksumResult != NULL ? varNewKv(result.pageChecksumResult) : NULL);
+            varLstAdd(resultList, varNewBool(result.compressBypass));
+            varLstAdd(resultList, varNewBool(result.compressDict));
+            varLstAdd(resultList, result.copyChecksumFast != NULL ? varNewStr(result.copyChecksumFast) : NULL);
+            varLstAdd(resultList, varNewBool(result.blockIncr));
 
             protocolServerResponse(server, varNewVarLst(resultList));
         }
+        else if (strEq(command, PROTOCOL_COMMAND_BACKUP_DICT_STR))
+        {
+            // Train the compression dictionary
+            protocolServerResponse(
+                server,
+                VARBOOL(
+                    backupDictCreate(
+                        strLstNewVarLst(varVarLst(varLstGet(paramList, 0))), varStr(varLstGet(paramList, 1)),
+                        backupCipherType(varLstSize(paramList) == 3 ? varStr(varLstGet(paramList, 2)) : NULL),
+                        varLstSize(paramList) == 3 ? varStr(varLstGet(paramList, 2)) : NULL)));
+        }
         else
             found = false;
     }
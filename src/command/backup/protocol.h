@@ -11,6 +11,8 @@ Backup Protocol Handler
 /***********************************************************************************************************************************
 Constants
 ***********************************************************************************************************************************/
+#define PROTOCOL_COMMAND_BACKUP_DICT                               "backupDict"
+    STRING_DECLARE(PROTOCOL_COMMAND_BACKUP_DICT_STR);
 #define PROTOCOL_COMMAND_BACKUP_FILE                               "backupFile"
     STRING_DECLARE(PROTOCOL_COMMAND_BACKUP_FILE_STR);
 
@@ -4,38 +4,395 @@ Restore File
 #include "build.auto.h"
 
 #include <fcntl.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
+#include "command/backup/blockIncr.h"
+#include "command/backup/common.h"
 #include "command/restore/file.h"
-#include "common/compress/gzip/common.h"
-#include "common/compress/gzip/decompress.h"
+#include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
 #include "common/debug.h"
 #include "common/io/filter/group.h"
-#include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
 #include "config/config.h"
+#include "postgres/interface.h"
 #include "storage/helper.h"
+#include "storage/posix/storage.h"
+
+/***********************************************************************************************************************************
+Open a file in the repo for read with the filters required to decrypt and decompress it. The read is not opened so more filters can
+be added.
+***********************************************************************************************************************************/
+static IoRead *
+restoreFileRepoRead(
+    const String *repoFile, const String *backupLabel, CompressType repoFileCompressType, const Buffer *repoFileCompressDict,
+    const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(STRING, backupLabel);
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(BUFFER, repoFileCompressDict);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    // The file is compressible during transfer from a remote repo if it is neither encrypted nor compressed
+    IoRead *result = storageReadIo(
+        storageNewReadP(
+            storageRepo(),
+            strNewFmt(
+                STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(backupLabel), strPtr(repoFile), compressExtZ(repoFileCompressType)),
+            .compressible = cipherPass == NULL && repoFileCompressType == compressTypeNone));
+
+    // Add decryption filter
+    if (cipherPass != NULL)
+    {
+        ioFilterGroupAdd(
+            ioReadFilterGroup(result), cipherBlockNew(cipherModeDecrypt, backupCipherType(cipherPass), BUFSTR(cipherPass), NULL));
+    }
+
+    // Add decompression filter
+    if (repoFileCompressType != compressTypeNone)
+        ioFilterGroupAdd(ioReadFilterGroup(result), decompressFilter(repoFileCompressType, repoFileCompressDict));
+
+    FUNCTION_LOG_RETURN(IO_READ, result);
+}
+
+/***********************************************************************************************************************************
+Write a run of blocks at the specified offset. Zero blocks are punched out of the file when the filesystem supports it, otherwise
+they are written like any other block.
+***********************************************************************************************************************************/
+typedef enum
+{
+    restoreFileBlockSkip,                                           // Block is already correct in the file
+    restoreFileBlockWrite,                                          // Block must be written
+    restoreFileBlockZero,                                           // Block is all zeros and must be zeroed in the file
+} RestoreFileBlockAction;
+
+static void
+restoreFileBlockRun(
+    int handle, RestoreFileBlockAction action, const unsigned char *run, size_t runSize, uint64_t offset, const String *pgFile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+        FUNCTION_TEST_PARAM(ENUM, action);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, run);
+        FUNCTION_TEST_PARAM(SIZE, runSize);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(STRING, pgFile);
+    FUNCTION_TEST_END();
+
+#ifdef FALLOC_FL_PUNCH_HOLE
+    if (action == restoreFileBlockZero)
+    {
+        if (fallocate(handle, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t)offset, (off_t)runSize) == 0)
+            action = restoreFileBlockSkip;
+        else
+            THROW_ON_SYS_ERROR_FMT(errno != EOPNOTSUPP, FileWriteError, "unable to punch hole in '%s'", strPtr(pgFile));
+    }
+#endif
+
+    if (action != restoreFileBlockSkip)
+    {
+        THROW_ON_SYS_ERROR_FMT(
+            pwrite(handle, run, runSize, (off_t)offset) != (ssize_t)runSize, FileWriteError, "unable to write '%s'",
+            strPtr(pgFile));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write the file read from the repo one page-sized block at a time. Blocks that are all zero are not written to a new file so they
+are left as holes, which saves both the writes and the space for preallocated relation extents. When an existing file is updated
+only the blocks that differ are written, and differing blocks that are all zero are punched out. The caller must set the final size
+of the file since trailing blocks may not have been written.
+***********************************************************************************************************************************/
+static void
+restoreFileBlock(IoRead *read, int handle, bool existing, const String *pgFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(INT, handle);
+        FUNCTION_LOG_PARAM(BOOL, existing);
+        FUNCTION_LOG_PARAM(STRING, pgFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(handle != -1);
+    ASSERT(pgFile != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read whole blocks so they can be compared with the same blocks in the existing file
+        size_t bufferSize = ioBufferSize() / PG_PAGE_SIZE_DEFAULT * PG_PAGE_SIZE_DEFAULT;
+        Buffer *buffer = bufNew(bufferSize < PG_PAGE_SIZE_DEFAULT ? PG_PAGE_SIZE_DEFAULT : bufferSize);
+        Buffer *bufferExisting = existing ? bufNew(bufSize(buffer)) : NULL;
+        uint64_t offset = 0;
+
+        do
+        {
+            ioRead(read, buffer);
+
+            size_t existingSize = 0;
+
+            if (existing)
+            {
+                ssize_t readSize = pread(handle, bufPtr(bufferExisting), bufUsed(buffer), (off_t)offset);
+                THROW_ON_SYS_ERROR_FMT(readSize == -1, FileReadError, "unable to read '%s'", strPtr(pgFile));
+
+                existingSize = (size_t)readSize;
+            }
+
+            // Combine adjacent blocks that need the same action into runs
+            RestoreFileBlockAction runAction = restoreFileBlockSkip;
+            size_t runBegin = 0;
+
+            for (size_t blockBegin = 0; blockBegin < bufUsed(buffer); blockBegin += PG_PAGE_SIZE_DEFAULT)
+            {
+                size_t blockSize = bufUsed(buffer) - blockBegin;
+
+                if (blockSize > PG_PAGE_SIZE_DEFAULT)
+                    blockSize = PG_PAGE_SIZE_DEFAULT;
+
+                const unsigned char *block = bufPtr(buffer) + blockBegin;
+                RestoreFileBlockAction blockAction;
+
+                // Skip blocks that are the same in the existing file
+                if (existing && blockBegin + blockSize <= existingSize &&
+                    memcmp(block, bufPtr(bufferExisting) + blockBegin, blockSize) == 0)
+                {
+                    blockAction = restoreFileBlockSkip;
+                }
+                // Else zero blocks are holes in a new file or punched out of an existing file
+                else if (bufZero(BUF(block, blockSize)))
+                    blockAction = existing ? restoreFileBlockZero : restoreFileBlockSkip;
+                // Else write the block
+                else
+                    blockAction = restoreFileBlockWrite;
+
+                if (blockAction != runAction)
+                {
+                    restoreFileBlockRun(
+                        handle, runAction, bufPtr(buffer) + runBegin, blockBegin - runBegin, offset + runBegin, pgFile);
+
+                    runAction = blockAction;
+                    runBegin = blockBegin;
+                }
+            }
+
+            restoreFileBlockRun(
+                handle, runAction, bufPtr(buffer) + runBegin, bufUsed(buffer) - runBegin, offset + runBegin, pgFile);
+
+            offset += bufUsed(buffer);
+            bufUsedZero(buffer);
+        }
+        while (!ioReadEof(read));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the handle of a file opened for write so blocks can be written to it directly. Direct io is disabled on the handle since the
+blocks are written from unaligned buffers at any offset.
+***********************************************************************************************************************************/
+static int
+restoreFileWriteHandle(IoWrite *write, const String *pgFile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, write);
+        FUNCTION_TEST_PARAM(STRING, pgFile);
+    FUNCTION_TEST_END();
+
+    ASSERT(write != NULL);
+    ASSERT(pgFile != NULL);
+
+    int result = ioWriteHandle(write);
+
+    if (storagePosixDirect())
+        storagePosixDirectDisable(result, pgFile);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Reassemble a file stored as page records. The file is restored from the oldest backup in the chain and then the changed pages from
+each block incremental are written in order, ending with the block incremental in the referenced backup. When zero pages were elided
+from the oldest backup its records are written to the empty file instead, which leaves the elided pages as holes.
+***********************************************************************************************************************************/
+static void
+restoreFileBlockIncr(
+    const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType,
+    const StringList *repoFileBlockIncrChain, bool repoFileZeroElide, const String *pgFile, const String *pgFileChecksum,
+    uint64_t pgFileSize, StorageWrite *pgFileWrite, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(STRING, repoFileReference);
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(STRING_LIST, repoFileBlockIncrChain);
+        FUNCTION_LOG_PARAM(BOOL, repoFileZeroElide);
+        FUNCTION_LOG_PARAM(STRING, pgFile);
+        FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
+        FUNCTION_LOG_PARAM(UINT64, pgFileSize);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, pgFileWrite);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT((repoFileBlockIncrChain != NULL && strLstSize(repoFileBlockIncrChain) > 0) || repoFileZeroElide);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoWrite *write = storageWriteIo(pgFileWrite);
+        ioWriteOpen(write);
+
+        int handle = restoreFileWriteHandle(write, pgFile);
+        unsigned int chainSize = repoFileBlockIncrChain == NULL ? 0 : strLstSize(repoFileBlockIncrChain);
+
+        for (unsigned int chainIdx = 0; chainIdx <= chainSize; chainIdx++)
+        {
+            IoRead *read = restoreFileRepoRead(
+                repoFile, chainIdx < chainSize ? strLstGet(repoFileBlockIncrChain, chainIdx) : repoFileReference,
+                repoFileCompressType, NULL, cipherPass);
+            ioReadOpen(read);
+
+            // Copy the entire file from the oldest backup unless zero pages were elided
+            if (chainIdx == 0 && !repoFileZeroElide)
+                restoreFileBlock(read, handle, false, pgFile);
+            // Else write the stored pages
+            else
+                blockIncrApply(read, PG_PAGE_SIZE_DEFAULT, handle, pgFile);
+
+            ioReadClose(read);
+        }
+
+        // Set the final size since the file may have been truncated or extended since the oldest backup
+        THROW_ON_SYS_ERROR_FMT(
+            ftruncate(handle, (off_t)pgFileSize) == -1, FileWriteError, "unable to truncate '%s'", strPtr(pgFile));
+
+        ioWriteClose(write);
+
+        // Validate checksum of the reassembled file
+        IoRead *read = storageReadIo(storageNewReadNP(storagePgWrite(), pgFile));
+        ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+        ioReadDrain(read);
+
+        const String *checksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+
+        if (!strEq(pgFileChecksum, checksum))
+        {
+            THROW_FMT(
+                ChecksumError, "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strPtr(pgFile),
+                strPtr(checksum), strPtr(pgFileChecksum));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Update an existing file in place by comparing it block by block with the file in the repo and writing only the blocks that differ.
+Large files with only a few changed blocks, e.g. relation segments on a standby that has fallen behind, are not rewritten entirely.
+***********************************************************************************************************************************/
+static void
+restoreFileDelta(
+    const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType, const Buffer *repoFileCompressDict,
+    const String *pgFile, const String *pgFileChecksum, uint64_t pgFileSize, time_t pgFileModified, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(STRING, repoFileReference);
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(BUFFER, repoFileCompressDict);
+        FUNCTION_LOG_PARAM(STRING, pgFile);
+        FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
+        FUNCTION_LOG_PARAM(UINT64, pgFileSize);
+        FUNCTION_LOG_PARAM(INT64, pgFileModified);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open the repo file
+        IoRead *read = restoreFileRepoRead(repoFile, repoFileReference, repoFileCompressType, repoFileCompressDict, cipherPass);
+        ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+        ioReadOpen(read);
+
+        // Open the existing file for read and write
+        const String *pgFilePath = storagePath(storagePg(), pgFile);
+        int handle = open(strPtr(pgFilePath), O_RDWR, 0);
+        THROW_ON_SYS_ERROR_FMT(handle == -1, FileOpenError, "unable to open file '%s' for write", strPtr(pgFilePath));
+
+        TRY_BEGIN()
+        {
+            restoreFileBlock(read, handle, true, pgFilePath);
+            ioReadClose(read);
+
+            // Remove blocks past the end of the file in the repo
+            THROW_ON_SYS_ERROR_FMT(
+                ftruncate(handle, (off_t)pgFileSize) == -1, FileWriteError, "unable to truncate '%s'", strPtr(pgFilePath));
+
+            THROW_ON_SYS_ERROR_FMT(fsync(handle) == -1, FileSyncError, "unable to sync file '%s' after write", strPtr(pgFilePath));
+
+            // Drop the file from the page cache now that the data is clean
+            storagePosixCacheDropRange(handle, 0, 0);
+        }
+        FINALLY()
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                close(handle) == -1, FileCloseError, "unable to close file '%s' after write", strPtr(pgFilePath));
+        }
+        TRY_END();
+
+        // Set the time to the backup time as it would be for a copied file
+        THROW_ON_SYS_ERROR_FMT(
+            utime(strPtr(pgFilePath), &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
+            FileInfoError, "unable to set time for '%s'", strPtr(pgFilePath));
+
+        // Validate checksum of the repo file
+        const String *checksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+
+        if (!strEq(pgFileChecksum, checksum))
+        {
+            THROW_FMT(
+                ChecksumError, "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strPtr(pgFile),
+                strPtr(checksum), strPtr(pgFileChecksum));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
 
 /***********************************************************************************************************************************
 Copy a file from the backup to the specified destination
 ***********************************************************************************************************************************/
 bool
 restoreFile(
-    const String *repoFile, const String *repoFileReference, bool repoFileCompressed, const String *pgFile,
-    const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
+    const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType, const Buffer *repoFileCompressDict,
+    const StringList *repoFileBlockIncrChain, bool repoFileZeroElide, const String *pgFile, const String *pgFileChecksum,
+    const String *pgFileChecksumFast, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
     const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
     const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, repoFile);
         FUNCTION_LOG_PARAM(STRING, repoFileReference);
-        FUNCTION_LOG_PARAM(BOOL, repoFileCompressed);
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(BUFFER, repoFileCompressDict);
+        FUNCTION_LOG_PARAM(STRING_LIST, repoFileBlockIncrChain);
+        FUNCTION_LOG_PARAM(BOOL, repoFileZeroElide);
         FUNCTION_LOG_PARAM(STRING, pgFile);
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
+        FUNCTION_LOG_PARAM(STRING, pgFileChecksumFast);
         FUNCTION_LOG_PARAM(BOOL, pgFileZero);
         FUNCTION_LOG_PARAM(UINT64, pgFileSize);
         FUNCTION_LOG_PARAM(INT64, pgFileModified);
@@ -51,12 +408,13 @@ restoreFile(
     ASSERT(repoFile != NULL);
     ASSERT(repoFileReference != NULL);
     ASSERT(pgFile != NULL);
+    ASSERT((repoFileBlockIncrChain == NULL && !repoFileZeroElide) || repoFileCompressDict == NULL);
 
     // Was the file copied?
     bool result = true;
 
-    // Is the file compressible during the copy?
-    bool compressible = true;
+    // Can an existing file be updated by writing only the blocks that differ?
+    bool deltaBlock = false;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
@@ -68,6 +426,9 @@ restoreFile(
 
             if (info.exists)
             {
+                // If the file needs to be copied then update the existing file in place unless it is empty
+                deltaBlock = info.size != 0 && pgFileSize != 0 && repoFileBlockIncrChain == NULL && !repoFileZeroElide;
+
                 // If force then use size/timestamp delta
                 if (deltaForce)
                 {
@@ -81,20 +442,27 @@ restoreFile(
                     // Only continue delta if the file size is as expected
                     if (info.size == pgFileSize)
                     {
-                        // Generate checksum for the file if size is not zero
+                        // Generate checksum for the file if size is not zero. Use the fast checksum when one was recorded.
                         IoRead *read = NULL;
 
                         if (info.size != 0)
                         {
                             read = storageReadIo(storageNewReadNP(storagePgWrite(), pgFile));
-                            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+                            ioFilterGroupAdd(
+                                ioReadFilterGroup(read),
+                                pgFileChecksumFast != NULL ? xxHashNew() : cryptoHashNew(HASH_TYPE_SHA1_STR));
                             ioReadDrain(read);
                         }
 
                         // If size and checksum are equal then no need to copy the file
                         if (pgFileSize == 0 ||
-                            strEq(
-                                pgFileChecksum, varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR))))
+                            (pgFileChecksumFast != NULL ?
+                                strEq(
+                                    pgFileChecksumFast,
+                                    varStr(ioFilterGroupResult(ioReadFilterGroup(read), XXHASH_FILTER_TYPE_STR))) :
+                                strEq(
+                                    pgFileChecksum,
+                                    varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR)))))
                         {
                             // Even if hash/size are the same set the time back to backup time.  This helps with unit testing, but
                             // also presents a pristine version of the database after restore.
@@ -140,48 +508,56 @@ restoreFile(
 
                 ioWriteClose(storageWriteIo(pgFileWrite));
             }
+            // Else reassemble the file when it is stored as page records
+            else if (repoFileBlockIncrChain != NULL || repoFileZeroElide)
+            {
+                restoreFileBlockIncr(
+                    repoFile, repoFileReference, repoFileCompressType, repoFileBlockIncrChain, repoFileZeroElide, pgFile,
+                    pgFileChecksum, pgFileSize, pgFileWrite, cipherPass);
+            }
+            // Else write only the blocks that differ from the existing file
+            else if (deltaBlock)
+            {
+                restoreFileDelta(
+                    repoFile, repoFileReference, repoFileCompressType, repoFileCompressDict, pgFile, pgFileChecksum, pgFileSize,
+                    pgFileModified, cipherPass);
+            }
             // Else perform the copy
             else
             {
-                IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(pgFileWrite));
+                // Open the repo file
+                IoRead *read = restoreFileRepoRead(
+                    repoFile, repoFileReference, repoFileCompressType, repoFileCompressDict, cipherPass);
+                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+                ioReadOpen(read);
 
-                // Add decryption filter
-                if (cipherPass != NULL)
-                {
-                    ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
-                    compressible = false;
-                }
+                // Copy the file in the kernel when the repo file is a plain copy on posix storage. This is cheaper than leaving
+                // zero blocks as holes and the extents are shared when the filesystem supports it. Else write the file, leaving
+                // zero blocks as holes.
+                IoWrite *write = storageWriteIo(pgFileWrite);
+                ioWriteOpen(write);
 
-                // Add decompression filter
-                if (repoFileCompressed)
-                {
-                    ioFilterGroupAdd(filterGroup, gzipDecompressNew(false));
-                    compressible = false;
-                }
+                if (!storageWriteCopy(pgFileWrite, read))
+                    restoreFileBlock(read, restoreFileWriteHandle(write, pgFile), false, pgFile);
 
-                // Add sha1 filter
-                ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
+                ioReadClose(read);
 
-                // Add size filter
-                ioFilterGroupAdd(filterGroup, ioSizeNew());
+                // Set the size since trailing zero blocks were not written
+                THROW_ON_SYS_ERROR_FMT(
+                    ftruncate(ioWriteHandle(write), (off_t)pgFileSize) == -1, FileWriteError, "unable to truncate '%s'",
+                    strPtr(pgFile));
 
-                // Copy file
-                storageCopyNP(
-                    storageNewReadP(
-                        storageRepo(),
-                        strNewFmt(
-                            STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(repoFileReference), strPtr(repoFile),
-                            repoFileCompressed ? "." GZIP_EXT : ""),
-                        .compressible = compressible),
-                    pgFileWrite);
+                ioWriteClose(write);
 
                 // Validate checksum
-                if (!strEq(pgFileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+                const String *checksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+
+                if (!strEq(pgFileChecksum, checksum))
                 {
                     THROW_FMT(
                         ChecksumError,
                         "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strPtr(pgFile),
-                        strPtr(varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))), strPtr(pgFileChecksum));
+                        strPtr(checksum), strPtr(pgFileChecksum));
                 }
             }
         }
@@ -4,16 +4,19 @@ Restore File
 #ifndef COMMAND_RESTORE_FILE_H
 #define COMMAND_RESTORE_FILE_H
 
+#include "common/compress/helper.h"
 #include "common/crypto/common.h"
 #include "common/type/string.h"
+#include "common/type/stringList.h"
 #include "storage/storage.h"
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 bool restoreFile(
-    const String *repoFile, const String *repoFileReference, bool repoFileCompressed, const String *pgFile,
-    const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
+    const String *repoFile, const String *repoFileReference, CompressType repoFileCompressType, const Buffer *repoFileCompressDict,
+    const StringList *repoFileBlockIncrChain, bool repoFileZeroElide, const String *pgFile, const String *pgFileChecksum,
+    const String *pgFileChecksumFast, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
     const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
     const String *cipherPass);
 
@@ -3,6 +3,8 @@ Restore Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/backup/common.h"
+#include "command/backup/dict.h"
 #include "command/restore/file.h"
 #include "command/restore/protocol.h"
 #include "common/debug.h"
@@ -41,17 +43,25 @@ restoreProtocol(const String *command, const VariantList *paramList, ProtocolSer
     {
         if (strEq(command, PROTOCOL_COMMAND_RESTORE_FILE_STR))
         {
+            const String *repoFileReference = varStr(varLstGet(paramList, 1));
+            const String *cipherPass = varStr(varLstGet(paramList, 16));
+
             protocolServerResponse(
                 server,
                 VARBOOL(
                     restoreFile(
-                        varStr(varLstGet(paramList, 0)), varStr(varLstGet(paramList, 1)), varBoolForce(varLstGet(paramList, 2)),
-                        varStr(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)), varBoolForce(varLstGet(paramList, 5)),
-                        varUInt64(varLstGet(paramList, 6)), (time_t)varInt64Force(varLstGet(paramList, 7)),
-                        cvtZToUIntBase(strPtr(varStr(varLstGet(paramList, 8))), 8), varStr(varLstGet(paramList, 9)),
-                        varStr(varLstGet(paramList, 10)), (time_t)varInt64Force(varLstGet(paramList, 11)),
-                        varBoolForce(varLstGet(paramList, 12)), varBoolForce(varLstGet(paramList, 13)),
-                        varStr(varLstGet(paramList, 14)))));
+                        varStr(varLstGet(paramList, 0)), repoFileReference, compressTypeEnum(varStr(varLstGet(paramList, 2))),
+                        varBoolForce(varLstGet(paramList, 3)) ?
+                            backupDictGet(repoFileReference, backupCipherType(cipherPass), cipherPass) :
+                            NULL,
+                        varLstGet(paramList, 17) != NULL ? strLstNewVarLst(varVarLst(varLstGet(paramList, 17))) : NULL,
+                        varBoolForce(varLstGet(paramList, 18)),
+                        varStr(varLstGet(paramList, 4)), varStr(varLstGet(paramList, 5)), varStr(varLstGet(paramList, 6)),
+                        varBoolForce(varLstGet(paramList, 7)), varUInt64(varLstGet(paramList, 8)),
+                        (time_t)varInt64Force(varLstGet(paramList, 9)), cvtZToUIntBase(strPtr(varStr(varLstGet(paramList, 10))), 8),
+                        varStr(varLstGet(paramList, 11)), varStr(varLstGet(paramList, 12)),
+                        (time_t)varInt64Force(varLstGet(paramList, 13)), varBoolForce(varLstGet(paramList, 14)),
+                        varBoolForce(varLstGet(paramList, 15)), cipherPass)));
         }
         else
             found = false;
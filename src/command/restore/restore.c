@@ -10,7 +10,9 @@ Restore Command
 
 #include "command/restore/protocol.h"
 #include "command/restore/restore.h"
+#include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/xxHash.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/regExp.h"
@@ -1761,6 +1763,7 @@ typedef struct RestoreJobData
     List *queueList;                                                // List of processing queues
     RegExp *zeroExp;                                                // Identify files that should be sparse zeroed
     const String *cipherSubPass;                                    // Passphrase used to decrypt files in the backup
+    CompressType compressType;                                      // Compression type used for files in the backup
 } RestoreJobData;
 
 // Helper to caculate the next queue to scan based on the client index
@@ -1821,9 +1824,12 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 protocolCommandParamAdd(
                     command, file->reference != NULL ?
                         VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
-                protocolCommandParamAdd(command, VARBOOL(manifestData(jobData->manifest)->backupOptionCompress));
+                protocolCommandParamAdd(command, VARSTR(compressTypeStr(jobData->compressType)));
+                protocolCommandParamAdd(command, VARBOOL(file->compressDict));
                 protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
                 protocolCommandParamAdd(command, VARSTRZ(file->checksumSha1));
+                protocolCommandParamAdd(
+                    command, file->checksumFast[0] != '\0' && xxHashPresent() ? VARSTRZ(file->checksumFast) : NULL);
                 protocolCommandParamAdd(command, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
                 protocolCommandParamAdd(command, VARUINT64(file->size));
                 protocolCommandParamAdd(command, VARUINT64((uint64_t)file->timestamp));
@@ -1834,6 +1840,9 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta) || cfgOptionBool(cfgOptForce)));
                 protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptForce)));
                 protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
+                protocolCommandParamAdd(
+                    command, file->blockIncrChain != NULL ? varNewVarLst(varLstNewStrLst(file->blockIncrChain)) : NULL);
+                protocolCommandParamAdd(command, VARBOOL(file->zeroElide));
 
                 // Remove job from the queue
                 lstRemoveIdx(queue, 0);
@@ -1895,6 +1904,14 @@ cmdRestore(void)
         // Get the cipher subpass used to decrypt files in the backup
         jobData.cipherSubPass = manifestCipherSubPass(jobData.manifest);
 
+        // Get the compression type used for files in the backup. Manifests without a compression type were compressed with gzip.
+        if (manifestData(jobData.manifest)->backupOptionCompress)
+        {
+            jobData.compressType =
+                manifestData(jobData.manifest)->backupOptionCompressType == NULL ?
+                    compressTypeGzip : compressTypeEnum(varStr(manifestData(jobData.manifest)->backupOptionCompressType));
+        }
+
         // Validate the manifest
         restoreManifestValidate(jobData.manifest, backupSet);
 
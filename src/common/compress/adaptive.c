@@ -0,0 +1,325 @@
+/***********************************************************************************************************************************
+Adaptive Compress
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/compress/adaptive.h"
+#include "common/compress/gzip/common.h"
+#include "common/compress/gzip/engine.h"
+#include "common/compress/zst/dict.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/time.h"
+#include "common/type/keyValue.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(COMPRESS_ADAPTIVE_FILTER_TYPE_STR,                    COMPRESS_ADAPTIVE_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Filter result keys
+***********************************************************************************************************************************/
+VARIANT_STRDEF_EXTERN(COMPRESS_ADAPTIVE_RESULT_BYPASS_VAR,          COMPRESS_ADAPTIVE_RESULT_BYPASS);
+VARIANT_STRDEF_EXTERN(COMPRESS_ADAPTIVE_RESULT_TIME_VAR,            COMPRESS_ADAPTIVE_RESULT_TIME);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define COMPRESS_ADAPTIVE_TYPE                                      CompressAdaptive
+#define COMPRESS_ADAPTIVE_PREFIX                                    compressAdaptive
+
+typedef struct CompressAdaptive
+{
+    MemContext *memContext;                                         // Context to store data
+    CompressType type;                                              // Compression type
+    int level;                                                      // Compression level when the data is compressible
+    unsigned int thread;                                            // Compression threads
+    Buffer *dict;                                                   // Dictionary to pass to the compression filter
+
+    Buffer *sample;                                                 // Input collected before the filter was selected
+    IoFilter *filter;                                               // Selected compression filter
+    bool bypass;                                                    // Was compression bypassed?
+    TimeUSec time;                                                  // Time spent estimating and compressing
+    bool inputSame;                                                 // Is the same input required on the next process call?
+} CompressAdaptive;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+compressAdaptiveToLog(const CompressAdaptive *this)
+{
+    return strNewFmt(
+        "{type: %s, level: %d, thread: %u, bypass: %s, inputSame: %s}", strPtr(compressTypeStr(this->type)), this->level,
+        this->thread, cvtBoolToConstZ(this->bypass), cvtBoolToConstZ(this->inputSame));
+}
+
+#define FUNCTION_LOG_COMPRESS_ADAPTIVE_TYPE                                                                                        \
+    CompressAdaptive *
+#define FUNCTION_LOG_COMPRESS_ADAPTIVE_FORMAT(value, buffer, bufferSize)                                                           \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, compressAdaptiveToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Estimate constants
+***********************************************************************************************************************************/
+#define ESTIMATE_LEVEL                                              1
+#define ESTIMATE_MEM_LEVEL                                          8
+
+/***********************************************************************************************************************************
+Level used when compression is bypassed. Level 0 for gzip writes stored blocks. There is no stored level for the other types so the
+fastest level is used -- they already write incompressible blocks without compression.
+***********************************************************************************************************************************/
+static int
+compressAdaptiveLevelBypass(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(type == compressTypeGzip ? 0 : 1);
+}
+
+/***********************************************************************************************************************************
+Is the sample compressible? A fast deflate of the sample is used as an estimate for all compression types since it is cheap and
+reliably detects data that has already been compressed.
+***********************************************************************************************************************************/
+static bool
+compressAdaptiveCompressible(const Buffer *sample)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, sample);
+    FUNCTION_TEST_END();
+
+    ASSERT(sample != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        size_t sampleSize = bufUsed(sample) < COMPRESS_ADAPTIVE_SAMPLE_SIZE ? bufUsed(sample) : COMPRESS_ADAPTIVE_SAMPLE_SIZE;
+
+        z_stream stream = {0};
+        gzipError(deflateInit2(&stream, ESTIMATE_LEVEL, Z_DEFLATED, gzipWindowBits(true), ESTIMATE_MEM_LEVEL, Z_DEFAULT_STRATEGY));
+
+        Buffer *estimate = bufNew(deflateBound(&stream, sampleSize));
+
+        stream.next_in = bufPtr(sample);
+        stream.avail_in = (unsigned int)sampleSize;
+        stream.next_out = bufPtr(estimate);
+        stream.avail_out = (unsigned int)bufSize(estimate);
+
+        // The output buffer is large enough to hold the entire compressed sample so this always finishes in a single call
+        int error = deflate(&stream, Z_FINISH);
+        deflateEnd(&stream);
+
+        CHECK(error == Z_STREAM_END);
+
+        // The sample is compressible if it shrank by at least the minimum gain
+        result = (uint64_t)stream.total_out * 100 < (uint64_t)sampleSize * (100 - COMPRESS_ADAPTIVE_GAIN_MIN);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static void
+compressAdaptiveProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(CompressAdaptive);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(COMPRESS_ADAPTIVE, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(compressed != NULL);
+
+    TimeUSec timeBegin = timeUSec();
+
+    // Collect input until there is enough to estimate compressibility or the input is complete
+    if (this->filter == NULL)
+    {
+        if (uncompressed != NULL)
+            bufCat(this->sample, uncompressed);
+
+        if (uncompressed == NULL || bufUsed(this->sample) >= COMPRESS_ADAPTIVE_SAMPLE_SIZE)
+        {
+            // Bypass compression only when a full sample is not compressible. Smaller streams are not worth the check.
+            this->bypass =
+                bufUsed(this->sample) >= COMPRESS_ADAPTIVE_SAMPLE_SIZE && !compressAdaptiveCompressible(this->sample);
+
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->filter = compressFilter(
+                    this->type, this->bypass ? compressAdaptiveLevelBypass(this->type) : this->level, this->thread, this->dict);
+            }
+            MEM_CONTEXT_END();
+
+            // The dictionary has been loaded by the compression filter so it is no longer needed
+            bufFree(this->dict);
+            this->dict = NULL;
+
+            // Free the sample now if there is nothing to compress
+            if (bufUsed(this->sample) == 0)
+            {
+                bufFree(this->sample);
+                this->sample = NULL;
+            }
+        }
+    }
+
+    if (this->filter != NULL)
+    {
+        // Compress the sample first. Any input passed with the sample has already been added to it.
+        if (this->sample != NULL)
+        {
+            ioFilterProcessInOut(this->filter, this->sample, compressed);
+            this->inputSame = ioFilterInputSame(this->filter);
+
+            if (!this->inputSame)
+            {
+                bufFree(this->sample);
+                this->sample = NULL;
+            }
+        }
+        // Else compress input
+        else
+        {
+            ioFilterProcessInOut(this->filter, uncompressed, compressed);
+            this->inputSame = ioFilterInputSame(this->filter);
+        }
+    }
+
+    this->time += timeUSec() - timeBegin;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is compress done?
+***********************************************************************************************************************************/
+static bool
+compressAdaptiveDone(const THIS_VOID)
+{
+    THIS(const CompressAdaptive);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(COMPRESS_ADAPTIVE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->filter != NULL && this->sample == NULL && ioFilterDone(this->filter));
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+compressAdaptiveInputSame(const THIS_VOID)
+{
+    THIS(const CompressAdaptive);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(COMPRESS_ADAPTIVE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+Return whether compression was bypassed and the time spent compressing
+***********************************************************************************************************************************/
+static Variant *
+compressAdaptiveResult(THIS_VOID)
+{
+    THIS(CompressAdaptive);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(COMPRESS_ADAPTIVE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    KeyValue *result = kvNew();
+    kvPut(result, COMPRESS_ADAPTIVE_RESULT_BYPASS_VAR, VARBOOL(this->bypass));
+    kvPut(result, COMPRESS_ADAPTIVE_RESULT_TIME_VAR, VARUINT64(this->time));
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewKv(result));
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+compressAdaptiveNew(CompressType type, int level, unsigned int thread, const Buffer *dict)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(ENUM, type);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, thread);
+        FUNCTION_LOG_PARAM(BUFFER, dict);
+    FUNCTION_LOG_END();
+
+    ASSERT(type != compressTypeNone);
+    ASSERT(thread > 0);
+    ASSERT(dict == NULL || type == compressTypeZst);
+
+    IoFilter *this = NULL;
+
+    // Error early if the type is not available rather than after the sample has been collected
+    compressTypePresent(type);
+
+    MEM_CONTEXT_NEW_BEGIN("CompressAdaptive")
+    {
+        CompressAdaptive *driver = memNew(sizeof(CompressAdaptive));
+
+        *driver = (CompressAdaptive)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .type = type,
+            .level = level,
+            .thread = thread,
+            .sample = bufNew(COMPRESS_ADAPTIVE_SAMPLE_SIZE),
+            .dict = dict == NULL ? NULL : bufDup(dict),
+        };
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(compressTypeStr(type)));
+        varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt(thread));
+        varLstAdd(paramList, zstDictToVar(dict));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            COMPRESS_ADAPTIVE_FILTER_TYPE_STR, driver, paramList, .done = compressAdaptiveDone, .inOut = compressAdaptiveProcess,
+            .inputSame = compressAdaptiveInputSame, .result = compressAdaptiveResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+compressAdaptiveNewVar(const VariantList *paramList)
+{
+    Buffer *dict = zstDictFromVar(varLstGet(paramList, 3));
+    IoFilter *result = compressAdaptiveNew(
+        compressTypeEnum(varStr(varLstGet(paramList, 0))), varIntForce(varLstGet(paramList, 1)),
+        varUIntForce(varLstGet(paramList, 2)), dict);
+    bufFree(dict);
+
+    return result;
+}
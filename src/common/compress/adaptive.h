@@ -0,0 +1,48 @@
+/***********************************************************************************************************************************
+Adaptive Compress
+
+Compress using the specified type and level unless a sample from the start of the stream shows that the data is not compressible,
+e.g. data that has already been compressed by PostgreSQL or by the application.  In that case the data is stored with the fastest
+level of the same type, so the output can still be read by the decompression filter for the type.  The dictionary, if any, is used
+whether or not compression is bypassed.
+
+The result of the filter is a KeyValue that reports whether compression was bypassed and the time spent compressing, so callers can
+compare it against the time spent on I/O.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_ADAPTIVE_H
+#define COMMON_COMPRESS_ADAPTIVE_H
+
+#include "common/compress/helper.h"
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define COMPRESS_ADAPTIVE_FILTER_TYPE                               "compressAdaptive"
+    STRING_DECLARE(COMPRESS_ADAPTIVE_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Filter result keys
+***********************************************************************************************************************************/
+#define COMPRESS_ADAPTIVE_RESULT_BYPASS                             "bypass"
+    VARIANT_DECLARE(COMPRESS_ADAPTIVE_RESULT_BYPASS_VAR);
+#define COMPRESS_ADAPTIVE_RESULT_TIME                               "time"
+    VARIANT_DECLARE(COMPRESS_ADAPTIVE_RESULT_TIME_VAR);
+
+/***********************************************************************************************************************************
+Size of the sample used to estimate compressibility. Streams smaller than the sample are always compressed.
+***********************************************************************************************************************************/
+#define COMPRESS_ADAPTIVE_SAMPLE_SIZE                               ((size_t)64 * 1024)
+
+/***********************************************************************************************************************************
+Minimum percentage that the sample must shrink by to be considered compressible
+***********************************************************************************************************************************/
+#define COMPRESS_ADAPTIVE_GAIN_MIN                                  5
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+IoFilter *compressAdaptiveNew(CompressType type, int level, unsigned int thread, const Buffer *dict);
+IoFilter *compressAdaptiveNewVar(const VariantList *paramList);
+
+#endif
@@ -3,9 +3,8 @@ Gzip Common
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
-#include <zlib.h>
-
 #include "common/compress/gzip/common.h"
+#include "common/compress/gzip/engine.h"
 #include "common/debug.h"
 #include "common/memContext.h"
 
@@ -4,10 +4,10 @@ Gzip Compress
 #include "build.auto.h"
 
 #include <stdio.h>
-#include <zlib.h>
 
 #include "common/compress/gzip/common.h"
 #include "common/compress/gzip/compress.h"
+#include "common/compress/gzip/engine.h"
 #include "common/debug.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/log.h"
@@ -0,0 +1,587 @@
+/***********************************************************************************************************************************
+Gzip Parallel Compress
+
+Each block is deflated as raw data primed with the last 32KiB of the prior block and ends on a byte boundary (Z_SYNC_FLUSH), except
+for the last block which is finished normally. The compressed blocks can then be concatenated behind a gzip header and followed by a
+trailer containing the combined crc32 and size. This is the same technique used by pigz.
+
+Worker threads do not use memory contexts, the stack trace, logging, or errors. Workers only run zlib on buffers that were allocated
+by the main thread and report errors back in the job.
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "common/compress/gzip/common.h"
+#include "common/compress/gzip/compressParallel.h"
+#include "common/compress/gzip/engine.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(GZIP_COMPRESS_PARALLEL_FILTER_TYPE_STR,               GZIP_COMPRESS_PARALLEL_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Compression constants
+***********************************************************************************************************************************/
+#define MEM_LEVEL                                                   9
+
+// Size of the dictionary used to prime each block (the maximum deflate window)
+#define GZIP_DICT_SIZE                                              ((size_t)32 * 1024)
+
+// Size of the gzip header and trailer
+#define GZIP_HEADER_SIZE                                            10
+#define GZIP_TRAILER_SIZE                                           8
+
+// Jobs allocated per thread so workers do not wait while completed blocks are being written
+#define GZIP_JOB_PER_THREAD                                         2
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define GZIP_COMPRESS_PARALLEL_TYPE                                 GzipCompressParallel
+#define GZIP_COMPRESS_PARALLEL_PREFIX                               gzipCompressParallel
+
+typedef enum
+{
+    gzipJobStateFree,                                               // Accepting input
+    gzipJobStateQueued,                                             // Waiting for a worker
+    gzipJobStateRunning,                                            // Being compressed by a worker
+    gzipJobStateDone,                                               // Compressed and ready to be written
+} GzipJobState;
+
+typedef struct GzipJob
+{
+    GzipJobState state;                                             // Current job state
+    bool last;                                                      // Is this the last block in the stream?
+
+    unsigned char *dict;                                            // End of the prior block used to prime compression
+    size_t dictSize;                                                // Size of dictionary
+    unsigned char *input;                                           // Uncompressed block
+    size_t inputSize;                                               // Size of uncompressed block
+    unsigned char *output;                                          // Compressed block
+    size_t outputSize;                                              // Size of compressed block
+    size_t outputOffset;                                            // Compressed bytes already written
+
+    unsigned long crc;                                              // crc32 of the uncompressed block
+    int error;                                                      // zlib result
+} GzipJob;
+
+typedef struct GzipCompressParallel
+{
+    MemContext *memContext;                                         // Context to store data
+    int level;                                                      // Compression level
+    unsigned int thread;                                            // Threads used for compression
+
+    pthread_mutex_t mutex;                                          // Protects job state shared with the workers
+    pthread_cond_t jobQueued;                                       // Signaled when a job is queued or on shutdown
+    pthread_cond_t jobDone;                                         // Signaled when a worker completes a job
+    pthread_t *threadList;                                          // Worker threads
+    unsigned int threadTotal;                                       // Worker threads started
+    bool shutdown;                                                  // Should the workers exit?
+
+    GzipJob *jobList;                                               // Ring of jobs
+    unsigned int jobTotal;                                          // Total jobs in the ring
+    unsigned int jobHead;                                           // Oldest job not yet written
+    unsigned int jobFill;                                           // Job currently accepting input
+    unsigned int jobSubmitted;                                      // Jobs queued, running, or done but not yet written
+    size_t outputMax;                                               // Maximum compressed size of a block
+
+    unsigned char *dict;                                            // End of the last submitted block
+    size_t dictSize;                                                // Size of dictionary
+
+    unsigned char pending[GZIP_HEADER_SIZE];                        // Header or trailer waiting to be written
+    size_t pendingSize;                                             // Size of header or trailer
+    size_t pendingOffset;                                           // Header or trailer bytes already written
+
+    unsigned long crc;                                              // crc32 of all blocks written
+    uint64_t size;                                                  // Uncompressed size of all blocks written
+
+    size_t inputOffset;                                             // Current offset from the start of the input buffer
+    bool inputSame;                                                 // Is the same input required on the next process call?
+    bool flushing;                                                  // Is input complete and flushing in progress?
+    bool trailer;                                                   // Has the trailer been queued?
+    bool done;                                                      // Is compression done?
+} GzipCompressParallel;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+gzipCompressParallelToLog(const GzipCompressParallel *this)
+{
+    return strNewFmt(
+        "{level: %d, thread: %u, inputSame: %s, inputOffset: %zu, flushing: %s, done: %s}", this->level, this->thread,
+        cvtBoolToConstZ(this->inputSame), this->inputOffset, cvtBoolToConstZ(this->flushing), cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_GZIP_COMPRESS_PARALLEL_TYPE                                                                                   \
+    GzipCompressParallel *
+#define FUNCTION_LOG_GZIP_COMPRESS_PARALLEL_FORMAT(value, buffer, bufferSize)                                                      \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, gzipCompressParallelToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Stop worker threads
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(GZIP_COMPRESS_PARALLEL, LOG, logLevelTrace)
+{
+    pthread_mutex_lock(&this->mutex);
+    this->shutdown = true;
+    pthread_cond_broadcast(&this->jobQueued);
+    pthread_mutex_unlock(&this->mutex);
+
+    for (unsigned int threadIdx = 0; threadIdx < this->threadTotal; threadIdx++)
+        pthread_join(this->threadList[threadIdx], NULL);
+
+    pthread_cond_destroy(&this->jobDone);
+    pthread_cond_destroy(&this->jobQueued);
+    pthread_mutex_destroy(&this->mutex);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Compress a block (runs in a worker thread)
+***********************************************************************************************************************************/
+static void
+gzipCompressParallelBlock(GzipJob *job, int level, size_t outputMax)
+{
+    z_stream stream = {.zalloc = Z_NULL};
+
+    job->crc = crc32(crc32(0L, Z_NULL, 0), job->input, (unsigned int)job->inputSize);
+
+    int result = deflateInit2(&stream, level, Z_DEFLATED, gzipWindowBits(true), MEM_LEVEL, Z_DEFAULT_STRATEGY);
+
+    if (result == Z_OK && job->dictSize > 0)
+        result = deflateSetDictionary(&stream, job->dict, (unsigned int)job->dictSize);
+
+    if (result == Z_OK)
+    {
+        stream.next_in = job->input;
+        stream.avail_in = (unsigned int)job->inputSize;
+        stream.next_out = job->output;
+        stream.avail_out = (unsigned int)outputMax;
+
+        // The output buffer is large enough for the worst case so the block must be completed in a single call
+        result = deflate(&stream, job->last ? Z_FINISH : Z_SYNC_FLUSH);
+
+        if (result == Z_STREAM_END || (result == Z_OK && !job->last && stream.avail_out > 0))
+            result = Z_OK;
+        else if (result == Z_OK)
+            result = Z_BUF_ERROR;
+
+        job->outputSize = outputMax - stream.avail_out;
+    }
+
+    // Safe to call even when initialization failed
+    deflateEnd(&stream);
+
+    job->error = result;
+}
+
+/***********************************************************************************************************************************
+Worker thread that compresses queued jobs in the order they were submitted
+***********************************************************************************************************************************/
+static void *
+gzipCompressParallelWorker(void *param)
+{
+    GzipCompressParallel *this = param;
+
+    pthread_mutex_lock(&this->mutex);
+
+    while (true)
+    {
+        GzipJob *job = NULL;
+
+        for (unsigned int jobIdx = 0; jobIdx < this->jobSubmitted; jobIdx++)
+        {
+            GzipJob *jobCheck = &this->jobList[(this->jobHead + jobIdx) % this->jobTotal];
+
+            if (jobCheck->state == gzipJobStateQueued)
+            {
+                job = jobCheck;
+                break;
+            }
+        }
+
+        // Wait for a job when none are queued
+        if (job == NULL)
+        {
+            if (this->shutdown)
+                break;
+
+            pthread_cond_wait(&this->jobQueued, &this->mutex);
+            continue;
+        }
+
+        // Compress the block without holding the lock
+        job->state = gzipJobStateRunning;
+        pthread_mutex_unlock(&this->mutex);
+
+        gzipCompressParallelBlock(job, this->level, this->outputMax);
+
+        pthread_mutex_lock(&this->mutex);
+        job->state = gzipJobStateDone;
+        pthread_cond_signal(&this->jobDone);
+    }
+
+    pthread_mutex_unlock(&this->mutex);
+
+    return NULL;
+}
+
+/***********************************************************************************************************************************
+Submit the job that is accepting input to the workers
+***********************************************************************************************************************************/
+static void
+gzipCompressParallelSubmit(GzipCompressParallel *this, bool last)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(GZIP_COMPRESS_PARALLEL, this);
+        FUNCTION_TEST_PARAM(BOOL, last);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->jobSubmitted < this->jobTotal);
+
+    GzipJob *job = &this->jobList[this->jobFill];
+    job->last = last;
+
+    // Prime the job with the end of the prior block and save the end of this block for the next job
+    memcpy(job->dict, this->dict, this->dictSize);
+    job->dictSize = this->dictSize;
+
+    this->dictSize = job->inputSize < GZIP_DICT_SIZE ? job->inputSize : GZIP_DICT_SIZE;
+    memcpy(this->dict, job->input + job->inputSize - this->dictSize, this->dictSize);
+
+    // Queue the job
+    pthread_mutex_lock(&this->mutex);
+
+    job->state = gzipJobStateQueued;
+    this->jobFill = (this->jobFill + 1) % this->jobTotal;
+    this->jobSubmitted++;
+
+    pthread_cond_signal(&this->jobQueued);
+    pthread_mutex_unlock(&this->mutex);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write the header, completed blocks, and trailer in order. Waits for up to waitTotal jobs to complete before returning, otherwise
+only jobs that are already complete are written.
+***********************************************************************************************************************************/
+static void
+gzipCompressParallelWrite(GzipCompressParallel *this, Buffer *compressed, unsigned int waitTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(GZIP_COMPRESS_PARALLEL, this);
+        FUNCTION_TEST_PARAM(BUFFER, compressed);
+        FUNCTION_TEST_PARAM(UINT, waitTotal);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(compressed != NULL);
+
+    while (!bufFull(compressed))
+    {
+        // Write the header or trailer
+        if (this->pendingOffset < this->pendingSize)
+        {
+            size_t writeSize = this->pendingSize - this->pendingOffset;
+
+            if (writeSize > bufRemains(compressed))
+                writeSize = bufRemains(compressed);
+
+            bufCatC(compressed, this->pending, this->pendingOffset, writeSize);
+            this->pendingOffset += writeSize;
+            continue;
+        }
+
+        // When all blocks have been written after input is complete then queue the trailer
+        if (this->jobSubmitted == 0)
+        {
+            if (this->flushing && !this->trailer)
+            {
+                for (unsigned int byteIdx = 0; byteIdx < 4; byteIdx++)
+                {
+                    this->pending[byteIdx] = (unsigned char)(this->crc >> (byteIdx * 8));
+                    this->pending[byteIdx + 4] = (unsigned char)(this->size >> (byteIdx * 8));
+                }
+
+                this->pendingSize = GZIP_TRAILER_SIZE;
+                this->pendingOffset = 0;
+                this->trailer = true;
+                continue;
+            }
+
+            break;
+        }
+
+        // Wait for the oldest job if requested, otherwise only write it when it is already done
+        GzipJob *job = &this->jobList[this->jobHead];
+
+        pthread_mutex_lock(&this->mutex);
+
+        while (waitTotal > 0 && job->state != gzipJobStateDone)
+            pthread_cond_wait(&this->jobDone, &this->mutex);
+
+        bool jobDone = job->state == gzipJobStateDone;
+
+        pthread_mutex_unlock(&this->mutex);
+
+        if (!jobDone)
+            break;
+
+        if (job->outputOffset == 0)
+            gzipError(job->error);
+
+        // Write as much of the block as possible
+        size_t writeSize = job->outputSize - job->outputOffset;
+
+        if (writeSize > bufRemains(compressed))
+            writeSize = bufRemains(compressed);
+
+        bufCatC(compressed, job->output, job->outputOffset, writeSize);
+        job->outputOffset += writeSize;
+
+        // If the block has been completely written then free the job
+        if (job->outputOffset == job->outputSize)
+        {
+            this->crc = crc32_combine(this->crc, job->crc, (z_off_t)job->inputSize);
+            this->size += job->inputSize;
+
+            job->inputSize = 0;
+            job->outputSize = 0;
+            job->outputOffset = 0;
+
+            pthread_mutex_lock(&this->mutex);
+
+            job->state = gzipJobStateFree;
+            this->jobHead = (this->jobHead + 1) % this->jobTotal;
+            this->jobSubmitted--;
+
+            pthread_mutex_unlock(&this->mutex);
+
+            if (waitTotal > 0)
+                waitTotal--;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static void
+gzipCompressParallelProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(GzipCompressParallel);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(GZIP_COMPRESS_PARALLEL, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->done);
+    ASSERT(compressed != NULL);
+    ASSERT(!this->flushing || uncompressed == NULL);
+
+    // Add input to jobs
+    if (uncompressed != NULL)
+    {
+        size_t inputOffset = this->inputOffset;
+
+        while (inputOffset < bufUsed(uncompressed))
+        {
+            // When all jobs are busy then wait for the oldest job to be written. If there is not enough room in the output buffer
+            // to write it then the input will need to be sent again.
+            if (this->jobSubmitted == this->jobTotal)
+            {
+                gzipCompressParallelWrite(this, compressed, 1);
+
+                if (this->jobSubmitted == this->jobTotal)
+                    break;
+            }
+
+            // Copy input into the job until the block is full
+            GzipJob *job = &this->jobList[this->jobFill];
+            size_t copySize = GZIP_COMPRESS_PARALLEL_BLOCK_SIZE - job->inputSize;
+
+            if (copySize > bufUsed(uncompressed) - inputOffset)
+                copySize = bufUsed(uncompressed) - inputOffset;
+
+            memcpy(job->input + job->inputSize, bufPtr(uncompressed) + inputOffset, copySize);
+            job->inputSize += copySize;
+            inputOffset += copySize;
+
+            if (job->inputSize == GZIP_COMPRESS_PARALLEL_BLOCK_SIZE)
+                gzipCompressParallelSubmit(this, false);
+        }
+
+        // Write any blocks that are already done
+        gzipCompressParallelWrite(this, compressed, 0);
+
+        this->inputSame = inputOffset < bufUsed(uncompressed);
+        this->inputOffset = this->inputSame ? inputOffset : 0;
+    }
+    // Else submit the last block and write everything that remains
+    else
+    {
+        if (!this->flushing)
+        {
+            if (this->jobSubmitted == this->jobTotal)
+                gzipCompressParallelWrite(this, compressed, 1);
+
+            if (this->jobSubmitted < this->jobTotal)
+            {
+                gzipCompressParallelSubmit(this, true);
+                this->flushing = true;
+            }
+        }
+
+        if (this->flushing)
+            gzipCompressParallelWrite(this, compressed, UINT_MAX);
+
+        this->done = this->trailer && this->pendingOffset == this->pendingSize;
+        this->inputSame = !this->done;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is compress done?
+***********************************************************************************************************************************/
+static bool
+gzipCompressParallelDone(const THIS_VOID)
+{
+    THIS(const GzipCompressParallel);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(GZIP_COMPRESS_PARALLEL, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+gzipCompressParallelInputSame(const THIS_VOID)
+{
+    THIS(const GzipCompressParallel);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(GZIP_COMPRESS_PARALLEL, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+gzipCompressParallelNew(int level, unsigned int thread)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, thread);
+    FUNCTION_LOG_END();
+
+    ASSERT(level >= -1 && level <= 9);
+    ASSERT(thread > 0);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("GzipCompressParallel")
+    {
+        GzipCompressParallel *driver = memNew(sizeof(GzipCompressParallel));
+
+        *driver = (GzipCompressParallel)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .level = level,
+            .thread = thread,
+            .jobTotal = thread * GZIP_JOB_PER_THREAD,
+            .dict = memNew(GZIP_DICT_SIZE),
+            .crc = crc32(0L, Z_NULL, 0),
+        };
+
+        // Get the worst case compressed size of a block, with room for the sync marker
+        z_stream stream = {.zalloc = Z_NULL};
+        gzipError(deflateInit2(&stream, level, Z_DEFLATED, gzipWindowBits(true), MEM_LEVEL, Z_DEFAULT_STRATEGY));
+        driver->outputMax = deflateBound(&stream, GZIP_COMPRESS_PARALLEL_BLOCK_SIZE) + 16;
+        deflateEnd(&stream);
+
+        // Allocate jobs
+        driver->jobList = memNew(sizeof(GzipJob) * driver->jobTotal);
+
+        for (unsigned int jobIdx = 0; jobIdx < driver->jobTotal; jobIdx++)
+        {
+            driver->jobList[jobIdx] = (GzipJob)
+            {
+                .dict = memNew(GZIP_DICT_SIZE),
+                .input = memNew(GZIP_COMPRESS_PARALLEL_BLOCK_SIZE),
+                .output = memNew(driver->outputMax),
+            };
+        }
+
+        // Write a minimal gzip header (no file name or modification time) before the first block
+        const unsigned char header[GZIP_HEADER_SIZE] = {0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, 3};
+
+        memcpy(driver->pending, header, sizeof(header));
+        driver->pendingSize = GZIP_HEADER_SIZE;
+
+        // Start worker threads. Set the free callback first so any threads already started are stopped on error.
+        pthread_mutex_init(&driver->mutex, NULL);
+        pthread_cond_init(&driver->jobQueued, NULL);
+        pthread_cond_init(&driver->jobDone, NULL);
+        driver->threadList = memNew(sizeof(pthread_t) * thread);
+
+        memContextCallbackSet(driver->memContext, gzipCompressParallelFreeResource, driver);
+
+        for (unsigned int threadIdx = 0; threadIdx < thread; threadIdx++)
+        {
+            errno = pthread_create(&driver->threadList[threadIdx], NULL, gzipCompressParallelWorker, driver);
+            THROW_ON_SYS_ERROR(errno != 0, KernelError, "unable to create compression thread");
+
+            driver->threadTotal++;
+        }
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt(thread));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            GZIP_COMPRESS_PARALLEL_FILTER_TYPE_STR, driver, paramList, .done = gzipCompressParallelDone,
+            .inOut = gzipCompressParallelProcess, .inputSame = gzipCompressParallelInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+gzipCompressParallelNewVar(const VariantList *paramList)
+{
+    return gzipCompressParallelNew(varIntForce(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)));
+}
@@ -0,0 +1,30 @@
+/***********************************************************************************************************************************
+Gzip Parallel Compress
+
+Compress a single IO stream into the gzip format using multiple threads. The input is split into fixed size blocks that are deflated
+by a pool of worker threads and then written in order as a single gzip member, so the output can be read by gzipDecompressNew() or
+any other gzip implementation.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_GZIP_COMPRESSPARALLEL_H
+#define COMMON_COMPRESS_GZIP_COMPRESSPARALLEL_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define GZIP_COMPRESS_PARALLEL_FILTER_TYPE                          "gzipCompressParallel"
+    STRING_DECLARE(GZIP_COMPRESS_PARALLEL_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Size of the blocks compressed by each thread
+***********************************************************************************************************************************/
+#define GZIP_COMPRESS_PARALLEL_BLOCK_SIZE                           ((size_t)128 * 1024)
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+IoFilter *gzipCompressParallelNew(int level, unsigned int thread);
+IoFilter *gzipCompressParallelNewVar(const VariantList *paramList);
+
+#endif
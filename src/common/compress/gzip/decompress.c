@@ -4,10 +4,10 @@ Gzip Decompress
 #include "build.auto.h"
 
 #include <stdio.h>
-#include <zlib.h>
 
 #include "common/compress/gzip/common.h"
 #include "common/compress/gzip/decompress.h"
+#include "common/compress/gzip/engine.h"
 #include "common/debug.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/log.h"
@@ -0,0 +1,40 @@
+/***********************************************************************************************************************************
+Gzip Engine
+
+Select the deflate/inflate implementation used by the gzip filters at build time. When the zlib-ng library is available its native
+API is used since it is substantially faster than zlib (SIMD accelerated match finding and crc) while producing the same format.
+The zlib names used by the filters are mapped to the zlib-ng names so the filters only need to be written against the zlib API.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_GZIP_ENGINE_H
+#define COMMON_COMPRESS_GZIP_ENGINE_H
+
+#ifdef HAVE_LIBZ_NG
+
+#include <stdint.h>
+#include <zlib-ng.h>
+
+#define z_stream                                                    zng_stream
+
+#define deflateBound                                                zng_deflateBound
+#define deflateEnd                                                  zng_deflateEnd
+#define deflateInit2                                                zng_deflateInit2
+#define deflateSetDictionary                                        zng_deflateSetDictionary
+#define deflate                                                     zng_deflate
+
+#define inflateEnd                                                  zng_inflateEnd
+#define inflateInit2                                                zng_inflateInit2
+#define inflate                                                     zng_inflate
+
+// zlib-ng uses fixed width types for crc values so cast to match the zlib API
+#define crc32(crc, buffer, size)                                                                                                   \
+    ((unsigned long)zng_crc32((uint32_t)(crc), buffer, (uint32_t)(size)))
+#define crc32_combine(crc1, crc2, size2)                                                                                           \
+    ((unsigned long)zng_crc32_combine((uint32_t)(crc1), (uint32_t)(crc2), size2))
+
+#else
+
+#include <zlib.h>
+
+#endif
+
+#endif
@@ -0,0 +1,367 @@
+/***********************************************************************************************************************************
+Compression Helper
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/compress/gzip/common.h"
+#include "common/compress/gzip/compress.h"
+#include "common/compress/gzip/compressParallel.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/compress/helper.h"
+#include "common/compress/lz4/common.h"
+#include "common/compress/lz4/compress.h"
+#include "common/compress/lz4/decompress.h"
+#include "common/compress/zst/common.h"
+#include "common/compress/zst/compress.h"
+#include "common/compress/zst/decompress.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "version.h"
+
+/***********************************************************************************************************************************
+Compression type constants
+***********************************************************************************************************************************/
+STRING_EXTERN(COMPRESS_TYPE_NONE_STR,                               COMPRESS_TYPE_NONE);
+STRING_EXTERN(COMPRESS_TYPE_GZIP_STR,                               COMPRESS_TYPE_GZIP);
+STRING_EXTERN(COMPRESS_TYPE_LZ4_STR,                                COMPRESS_TYPE_LZ4);
+STRING_EXTERN(COMPRESS_TYPE_ZST_STR,                                COMPRESS_TYPE_ZST);
+
+/***********************************************************************************************************************************
+Default compression levels
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_DEFAULT_GZIP                                 6
+#define COMPRESS_LEVEL_DEFAULT_LZ4                                  1
+#define COMPRESS_LEVEL_DEFAULT_ZST                                  3
+
+/***********************************************************************************************************************************
+Minimum compression levels. Level 0 means no compression for gz but selects the default level for lz4 and zst so it is not allowed.
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_MIN_GZIP                                     0
+#define COMPRESS_LEVEL_MIN_LZ4                                      1
+#define COMPRESS_LEVEL_MIN_ZST                                      1
+
+/***********************************************************************************************************************************
+Maximum compression levels. Zstandard levels above 19 are "ultra" levels that need much more memory so they are not used.
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_MAX_GZIP                                     9
+#define COMPRESS_LEVEL_MAX_LZ4                                      12
+#define COMPRESS_LEVEL_MAX_ZST                                      19
+
+/**********************************************************************************************************************************/
+CompressType
+compressTypeEnum(const String *type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(type != NULL);
+
+    CompressType result = compressTypeNone;
+
+    if (strEq(type, COMPRESS_TYPE_GZIP_STR))
+        result = compressTypeGzip;
+    else if (strEq(type, COMPRESS_TYPE_LZ4_STR))
+        result = compressTypeLz4;
+    else if (strEq(type, COMPRESS_TYPE_ZST_STR))
+        result = compressTypeZst;
+    else if (!strEq(type, COMPRESS_TYPE_NONE_STR))
+        THROW_FMT(AssertError, "invalid compression type '%s'", strPtr(type));
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+const String *
+compressTypeStr(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    const String *result = NULL;
+
+    switch (type)
+    {
+        case compressTypeNone:
+        {
+            result = COMPRESS_TYPE_NONE_STR;
+            break;
+        }
+
+        case compressTypeGzip:
+        {
+            result = COMPRESS_TYPE_GZIP_STR;
+            break;
+        }
+
+        case compressTypeLz4:
+        {
+            result = COMPRESS_TYPE_LZ4_STR;
+            break;
+        }
+
+        case compressTypeZst:
+        {
+            result = COMPRESS_TYPE_ZST_STR;
+            break;
+        }
+
+        default:
+            THROW_FMT(AssertError, "invalid compression type %u", type);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+compressTypePresent(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    bool present = true;
+
+#ifndef HAVE_LIBLZ4
+    if (type == compressTypeLz4)
+        present = false;
+#endif
+
+#ifndef HAVE_LIBZSTD
+    if (type == compressTypeZst)
+        present = false;
+#endif
+
+    if (!present)
+        THROW_FMT(OptionInvalidValueError, PROJECT_NAME " not compiled with %s support", strPtr(compressTypeStr(type)));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+CompressType
+compressTypeFromName(const String *name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(name != NULL);
+
+    CompressType result = compressTypeNone;
+
+    if (strEndsWithZ(name, "." GZIP_EXT))
+        result = compressTypeGzip;
+    else if (strEndsWithZ(name, "." LZ4_EXT))
+        result = compressTypeLz4;
+    else if (strEndsWithZ(name, "." ZST_EXT))
+        result = compressTypeZst;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+int
+compressLevelDefault(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    int result = 0;
+
+    if (type == compressTypeGzip)
+        result = COMPRESS_LEVEL_DEFAULT_GZIP;
+    else if (type == compressTypeLz4)
+        result = COMPRESS_LEVEL_DEFAULT_LZ4;
+    else if (type == compressTypeZst)
+        result = COMPRESS_LEVEL_DEFAULT_ZST;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+int
+compressLevelMin(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    int result = 0;
+
+    if (type == compressTypeGzip)
+        result = COMPRESS_LEVEL_MIN_GZIP;
+    else if (type == compressTypeLz4)
+        result = COMPRESS_LEVEL_MIN_LZ4;
+    else if (type == compressTypeZst)
+        result = COMPRESS_LEVEL_MIN_ZST;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+int
+compressLevelMax(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    int result = 0;
+
+    if (type == compressTypeGzip)
+        result = COMPRESS_LEVEL_MAX_GZIP;
+    else if (type == compressTypeLz4)
+        result = COMPRESS_LEVEL_MAX_LZ4;
+    else if (type == compressTypeZst)
+        result = COMPRESS_LEVEL_MAX_ZST;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+compressFilter(CompressType type, int level, unsigned int thread, const Buffer *dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(INT, level);
+        FUNCTION_TEST_PARAM(UINT, thread);
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    ASSERT(thread > 0);
+    ASSERT(dict == NULL || type == compressTypeZst);
+
+    IoFilter *result = NULL;
+
+    compressTypePresent(type);
+
+    switch (type)
+    {
+        case compressTypeNone:
+            break;
+
+        case compressTypeGzip:
+        {
+            result = thread > 1 ? gzipCompressParallelNew(level, thread) : gzipCompressNew(level, false);
+            break;
+        }
+
+#ifdef HAVE_LIBLZ4
+        case compressTypeLz4:
+        {
+            result = lz4CompressNew(level);
+            break;
+        }
+#endif
+
+#ifdef HAVE_LIBZSTD
+        case compressTypeZst:
+        {
+            result = zstCompressNew(level, thread, dict);
+            break;
+        }
+#endif
+
+        default:
+            THROW_FMT(AssertError, "invalid compression type %u", type);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+decompressFilter(CompressType type, const Buffer *dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    ASSERT(dict == NULL || type == compressTypeZst);
+
+    IoFilter *result = NULL;
+
+    compressTypePresent(type);
+
+    switch (type)
+    {
+        case compressTypeNone:
+            break;
+
+        case compressTypeGzip:
+        {
+            result = gzipDecompressNew(false);
+            break;
+        }
+
+#ifdef HAVE_LIBLZ4
+        case compressTypeLz4:
+        {
+            result = lz4DecompressNew();
+            break;
+        }
+#endif
+
+#ifdef HAVE_LIBZSTD
+        case compressTypeZst:
+        {
+            result = zstDecompressNew(dict);
+            break;
+        }
+#endif
+
+        default:
+            THROW_FMT(AssertError, "invalid compression type %u", type);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+const char *
+compressExtZ(CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    const char *result = NULL;
+
+    switch (type)
+    {
+        case compressTypeNone:
+        {
+            result = "";
+            break;
+        }
+
+        case compressTypeGzip:
+        {
+            result = "." GZIP_EXT;
+            break;
+        }
+
+        case compressTypeLz4:
+        {
+            result = "." LZ4_EXT;
+            break;
+        }
+
+        case compressTypeZst:
+        {
+            result = "." ZST_EXT;
+            break;
+        }
+
+        default:
+            THROW_FMT(AssertError, "invalid compression type %u", type);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
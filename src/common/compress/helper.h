@@ -0,0 +1,74 @@
+/***********************************************************************************************************************************
+Compression Helper
+
+Abstract the compression types so commands can select a compression/decompression filter and file extension without knowing the
+details of each type.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_HELPER_H
+#define COMMON_COMPRESS_HELPER_H
+
+#include "common/io/filter/filter.h"
+#include "common/type/buffer.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Compression types
+***********************************************************************************************************************************/
+typedef enum
+{
+    compressTypeNone,                                               // No compression
+    compressTypeGzip,                                               // gzip
+    compressTypeLz4,                                                // lz4
+    compressTypeZst,                                                // Zstandard
+} CompressType;
+
+#define COMPRESS_TYPE_NONE                                          "none"
+    STRING_DECLARE(COMPRESS_TYPE_NONE_STR);
+#define COMPRESS_TYPE_GZIP                                          "gz"
+    STRING_DECLARE(COMPRESS_TYPE_GZIP_STR);
+#define COMPRESS_TYPE_LZ4                                           "lz4"
+    STRING_DECLARE(COMPRESS_TYPE_LZ4_STR);
+#define COMPRESS_TYPE_ZST                                           "zst"
+    STRING_DECLARE(COMPRESS_TYPE_ZST_STR);
+
+// Regular expression that matches the extension of any compression type (the extension is the same as the type name)
+#define COMPRESS_TYPE_REGEXP                                                                                                       \
+    "(\\.(" COMPRESS_TYPE_GZIP "|" COMPRESS_TYPE_LZ4 "|" COMPRESS_TYPE_ZST "))"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Get enum from a compression type string
+CompressType compressTypeEnum(const String *type);
+
+// Get string from a compression type enum
+const String *compressTypeStr(CompressType type);
+
+// Error if the compression type was not compiled into this binary
+void compressTypePresent(CompressType type);
+
+// Get the compression type from a file name based on the extension
+CompressType compressTypeFromName(const String *name);
+
+// Default compression level for a compression type
+int compressLevelDefault(CompressType type);
+
+// Minimum compression level for a compression type
+int compressLevelMin(CompressType type);
+
+// Maximum compression level for a compression type
+int compressLevelMax(CompressType type);
+
+// Compression filter for the specified type. Returns NULL when type is compressTypeNone. Types that support compressing a single
+// stream with multiple threads will use up to the specified number of threads. A dictionary may only be specified for types that
+// support dictionaries (currently only zst).
+IoFilter *compressFilter(CompressType type, int level, unsigned int thread, const Buffer *dict);
+
+// Decompression filter for the specified type. Returns NULL when type is compressTypeNone. The dictionary must be the same one used
+// for compression, if any.
+IoFilter *decompressFilter(CompressType type, const Buffer *dict);
+
+// File extension, including the dot, for the specified type. Returns an empty string when type is compressTypeNone.
+const char *compressExtZ(CompressType type);
+
+#endif
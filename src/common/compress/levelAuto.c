@@ -0,0 +1,114 @@
+/***********************************************************************************************************************************
+Compression Level Auto-Tuning
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/compress/levelAuto.h"
+#include "common/debug.h"
+#include "common/log.h"
+
+/***********************************************************************************************************************************
+Local variables
+***********************************************************************************************************************************/
+typedef struct CompressLevelAuto
+{
+    bool init;                                                      // Has the level been initialized?
+    int level;                                                      // Current level
+    int levelMax;                                                   // Highest level that may be selected
+    unsigned int sampleTotal;                                       // Files timed at the current level
+    TimeUSec compressTime;                                          // Average compress time per MiB at the current level
+    TimeUSec ioTime;                                                // Average I/O time per MiB at the current level
+} CompressLevelAuto;
+
+static CompressLevelAuto compressLevelAutoLocal[compressTypeZst + 1];
+
+/**********************************************************************************************************************************/
+int
+compressLevelAutoGet(CompressType type, int level)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(INT, level);
+    FUNCTION_TEST_END();
+
+    ASSERT(type != compressTypeNone && type <= compressTypeZst);
+
+    CompressLevelAuto *this = &compressLevelAutoLocal[type];
+
+    if (!this->init)
+    {
+        // Start from the configured level but keep it in range, e.g. level 0 for gzip does not compress at all
+        this->level = level < COMPRESS_LEVEL_AUTO_MIN ? COMPRESS_LEVEL_AUTO_MIN : level;
+        this->level = this->level > compressLevelMax(type) ? compressLevelMax(type) : this->level;
+
+        // Do not raise the level far above the starting level
+        this->levelMax = this->level + COMPRESS_LEVEL_AUTO_RAISE_MAX;
+        this->levelMax = this->levelMax > compressLevelMax(type) ? compressLevelMax(type) : this->levelMax;
+
+        this->init = true;
+    }
+
+    FUNCTION_TEST_RETURN(this->level);
+}
+
+/**********************************************************************************************************************************/
+void
+compressLevelAutoUpdate(CompressType type, uint64_t size, TimeUSec compressTime, TimeUSec ioTime)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, type);
+        FUNCTION_LOG_PARAM(UINT64, size);
+        FUNCTION_LOG_PARAM(TIME_USEC, compressTime);
+        FUNCTION_LOG_PARAM(TIME_USEC, ioTime);
+    FUNCTION_LOG_END();
+
+    ASSERT(type != compressTypeNone && type <= compressTypeZst);
+    ASSERT(compressLevelAutoLocal[type].init);
+
+    CompressLevelAuto *this = &compressLevelAutoLocal[type];
+
+    if (size >= COMPRESS_LEVEL_AUTO_SIZE_MIN)
+    {
+        // Normalize times per MiB so large files do not outweigh small files
+        TimeUSec compressTimeMiB = compressTime * (1024 * 1024) / size;
+        TimeUSec ioTimeMiB = ioTime * (1024 * 1024) / size;
+
+        // Keep a running average of the times so a single outlier does not change the level
+        if (this->sampleTotal == 0)
+        {
+            this->compressTime = compressTimeMiB;
+            this->ioTime = ioTimeMiB;
+        }
+        else
+        {
+            this->compressTime = (this->compressTime * 3 + compressTimeMiB) / 4;
+            this->ioTime = (this->ioTime * 3 + ioTimeMiB) / 4;
+        }
+
+        this->sampleTotal++;
+
+        // Change the level when one side is taking at least 25% longer than the other
+        if (this->sampleTotal >= COMPRESS_LEVEL_AUTO_SAMPLE_MIN)
+        {
+            int level = this->level;
+
+            if (this->compressTime * 4 > this->ioTime * 5 && level > COMPRESS_LEVEL_AUTO_MIN)
+                level--;
+            else if (this->compressTime * 5 < this->ioTime * 4 && level < this->levelMax)
+                level++;
+
+            if (level != this->level)
+            {
+                LOG_DETAIL(
+                    "change %s compression level from %d to %d (compress %" PRIu64 "us/MiB, io %" PRIu64 "us/MiB)",
+                    strPtr(compressTypeStr(type)), this->level, level, this->compressTime, this->ioTime);
+
+                // Start timing again at the new level
+                this->level = level;
+                this->sampleTotal = 0;
+            }
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -0,0 +1,53 @@
+/***********************************************************************************************************************************
+Compression Level Auto-Tuning
+
+Adjust the compression level between files so the process spends about as much time compressing as it spends waiting on the
+source and destination storage drivers. When compression takes longer, the level is lowered so reads and writes are not left
+waiting. When I/O takes longer, the level is raised since the extra compression costs nothing and reduces the amount of data
+written. Other filters, e.g. checksums and encryption, are not counted on either side since they do not depend on the level.
+
+State is kept per process and compression type since each process may be reading and writing over a different path, e.g. local
+disk, a remote, or object storage.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_LEVELAUTO_H
+#define COMMON_COMPRESS_LEVELAUTO_H
+
+#include <stdint.h>
+
+#include "common/compress/helper.h"
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Minimum level that may be selected
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_AUTO_MIN                                     1
+
+/***********************************************************************************************************************************
+Maximum number of levels the level may be raised above the configured level. The level is also never raised above the maximum for
+the compression type, see compressLevelMax(). Higher levels cost far more CPU for little gain so the level is kept near the one the
+user chose.
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_AUTO_RAISE_MAX                               3
+
+/***********************************************************************************************************************************
+Files smaller than this are not timed since open/close overhead dominates and would skew the result
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_AUTO_SIZE_MIN                                ((uint64_t)1024 * 1024)
+
+/***********************************************************************************************************************************
+Number of files that must be timed at a level before the level is changed again
+***********************************************************************************************************************************/
+#define COMPRESS_LEVEL_AUTO_SAMPLE_MIN                              2
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Get the level to use for the next file. The level passed is used as the starting level the first time a type is requested and
+// also sets the highest level that may be selected (see COMPRESS_LEVEL_AUTO_RAISE_MAX).
+int compressLevelAutoGet(CompressType type, int level);
+
+// Update with the timing of a file. compressTime is the time spent in the compression filter and ioTime is the time spent in the
+// source read and destination write drivers (see ioReadStat() and ioWriteStat()).
+void compressLevelAutoUpdate(CompressType type, uint64_t size, TimeUSec compressTime, TimeUSec ioTime);
+
+#endif
@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+LZ4 Common
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_LZ4_COMMON_H
+#define COMMON_COMPRESS_LZ4_COMMON_H
+
+#include <stddef.h>
+
+/***********************************************************************************************************************************
+LZ4 extension
+***********************************************************************************************************************************/
+#define LZ4_EXT                                                     "lz4"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBLZ4
+
+size_t lz4Error(size_t error);
+
+#endif
+
+#endif
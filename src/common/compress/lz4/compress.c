@@ -0,0 +1,310 @@
+/***********************************************************************************************************************************
+LZ4 Compress
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBLZ4
+
+#include <lz4frame.h>
+#include <string.h>
+
+#include "common/compress/lz4/common.h"
+#include "common/compress/lz4/compress.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(LZ4_COMPRESS_FILTER_TYPE_STR,                         LZ4_COMPRESS_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define LZ4_COMPRESS_TYPE                                           Lz4Compress
+#define LZ4_COMPRESS_PREFIX                                         lz4Compress
+
+typedef struct Lz4Compress
+{
+    MemContext *memContext;                                         // Context to store data
+    LZ4F_compressionContext_t context;                              // LZ4 compression context
+    LZ4F_preferences_t prefs;                                       // Preferences -- compress level and content checksum
+
+    Buffer *buffer;                                                 // For when the output buffer is too small to accept all output
+    size_t bufferOffset;                                            // Offset of output not yet copied from the internal buffer
+
+    bool first;                                                     // Is this the first call to process?
+    bool inputSame;                                                 // Is the same input required on the next process call?
+    bool flushing;                                                  // Is input complete and flushing in progress?
+    bool done;                                                      // Is compression done?
+} Lz4Compress;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+lz4CompressToLog(const Lz4Compress *this)
+{
+    return strNewFmt(
+        "{level: %d, first: %s, inputSame: %s, flushing: %s, done: %s}", this->prefs.compressionLevel,
+        cvtBoolToConstZ(this->first), cvtBoolToConstZ(this->inputSame), cvtBoolToConstZ(this->flushing),
+        cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_LZ4_COMPRESS_TYPE                                                                                             \
+    Lz4Compress *
+#define FUNCTION_LOG_LZ4_COMPRESS_FORMAT(value, buffer, bufferSize)                                                                \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, lz4CompressToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free compression context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(LZ4_COMPRESS, LOG, logLevelTrace)
+{
+    LZ4F_freeCompressionContext(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Get the output buffer to write to
+
+LZ4 requires that the output buffer be large enough to hold the worst case compressed output for the given input. If the caller's
+buffer is not large enough then the internal buffer is used and drained into the caller's buffer over as many calls as needed.
+***********************************************************************************************************************************/
+static Buffer *
+lz4CompressBuffer(Lz4Compress *this, size_t required, Buffer *output)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LZ4_COMPRESS, this);
+        FUNCTION_TEST_PARAM(SIZE, required);
+        FUNCTION_TEST_PARAM(BUFFER, output);
+    FUNCTION_TEST_END();
+
+    Buffer *result = output;
+
+    // Is an internal buffer required?
+    if (bufRemains(output) < required)
+    {
+        // Allocate the internal buffer if it has not already been allocated
+        if (this->buffer == NULL)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->buffer = bufNew(required);
+            }
+            MEM_CONTEXT_END();
+        }
+        // Resize if the internal buffer is not large enough
+        else if (bufSize(this->buffer) < required)
+            bufResize(this->buffer, required);
+
+        bufUsedZero(this->buffer);
+        this->bufferOffset = 0;
+
+        result = this->buffer;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Copy as much pending output as possible from the internal buffer to the caller's buffer
+***********************************************************************************************************************************/
+static void
+lz4CompressDrain(Lz4Compress *this, Buffer *output)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LZ4_COMPRESS, this);
+        FUNCTION_TEST_PARAM(BUFFER, output);
+    FUNCTION_TEST_END();
+
+    if (this->buffer != NULL)
+    {
+        size_t size = bufUsed(this->buffer) - this->bufferOffset;
+
+        if (size > bufRemains(output))
+            size = bufRemains(output);
+
+        bufCatSub(output, this->buffer, this->bufferOffset, size);
+        this->bufferOffset += size;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is there output in the internal buffer that has not been copied to the caller's buffer?
+***********************************************************************************************************************************/
+static bool
+lz4CompressPending(const Lz4Compress *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LZ4_COMPRESS, this);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(this->buffer != NULL && this->bufferOffset < bufUsed(this->buffer));
+}
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static void
+lz4CompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(Lz4Compress);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(LZ4_COMPRESS, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->done);
+    ASSERT(compressed != NULL);
+    ASSERT(!this->flushing || uncompressed == NULL);
+
+    // Only generate more output when all prior output has been copied to the caller's buffer
+    if (!lz4CompressPending(this))
+    {
+        // Flushing
+        if (uncompressed == NULL)
+        {
+            this->flushing = true;
+
+            Buffer *output = lz4CompressBuffer(this, LZ4F_compressBound(0, &this->prefs) + LZ4F_HEADER_SIZE_MAX, compressed);
+
+            // Begin the frame if this is an empty stream
+            if (this->first)
+            {
+                bufUsedInc(
+                    output, lz4Error(LZ4F_compressBegin(this->context, bufRemainsPtr(output), bufRemains(output), &this->prefs)));
+                this->first = false;
+            }
+
+            bufUsedInc(output, lz4Error(LZ4F_compressEnd(this->context, bufRemainsPtr(output), bufRemains(output), NULL)));
+        }
+        // Else more input
+        else
+        {
+            Buffer *output = lz4CompressBuffer(
+                this, LZ4F_compressBound(bufUsed(uncompressed), &this->prefs) + (this->first ? LZ4F_HEADER_SIZE_MAX : 0),
+                compressed);
+
+            // Begin the frame on the first call
+            if (this->first)
+            {
+                bufUsedInc(
+                    output, lz4Error(LZ4F_compressBegin(this->context, bufRemainsPtr(output), bufRemains(output), &this->prefs)));
+                this->first = false;
+            }
+
+            bufUsedInc(
+                output,
+                lz4Error(
+                    LZ4F_compressUpdate(
+                        this->context, bufRemainsPtr(output), bufRemains(output), bufPtr(uncompressed), bufUsed(uncompressed),
+                        NULL)));
+        }
+    }
+
+    // Copy pending output (if any) to the caller's buffer
+    lz4CompressDrain(this, compressed);
+
+    // Is compression done?
+    if (this->flushing && !lz4CompressPending(this))
+        this->done = true;
+
+    // Is the same input required on the next call? This is true while there is pending output (or flushing is not complete).
+    this->inputSame = this->flushing ? !this->done : lz4CompressPending(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is compress done?
+***********************************************************************************************************************************/
+static bool
+lz4CompressDone(const THIS_VOID)
+{
+    THIS(const Lz4Compress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LZ4_COMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+lz4CompressInputSame(const THIS_VOID)
+{
+    THIS(const Lz4Compress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LZ4_COMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+lz4CompressNew(int level)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, level);
+    FUNCTION_LOG_END();
+
+    ASSERT(level >= 0);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("Lz4Compress")
+    {
+        Lz4Compress *driver = memNew(sizeof(Lz4Compress));
+        driver->memContext = MEM_CONTEXT_NEW();
+        driver->prefs.compressionLevel = level;
+        driver->prefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+        driver->first = true;
+
+        // Create lz4 context
+        lz4Error(LZ4F_createCompressionContext(&driver->context, LZ4F_VERSION));
+
+        // Set free callback to ensure lz4 context is freed
+        memContextCallbackSet(driver->memContext, lz4CompressFreeResource, driver);
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewInt(level));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            LZ4_COMPRESS_FILTER_TYPE_STR, driver, paramList, .done = lz4CompressDone, .inOut = lz4CompressProcess,
+            .inputSame = lz4CompressInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+lz4CompressNewVar(const VariantList *paramList)
+{
+    return lz4CompressNew(varIntForce(varLstGet(paramList, 0)));
+}
+
+#endif // HAVE_LIBLZ4
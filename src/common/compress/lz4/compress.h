@@ -0,0 +1,27 @@
+/***********************************************************************************************************************************
+LZ4 Compress
+
+Compress IO using the lz4 frame format.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_LZ4_COMPRESS_H
+#define COMMON_COMPRESS_LZ4_COMPRESS_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define LZ4_COMPRESS_FILTER_TYPE                                    "lz4Compress"
+    STRING_DECLARE(LZ4_COMPRESS_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBLZ4
+
+IoFilter *lz4CompressNew(int level);
+IoFilter *lz4CompressNewVar(const VariantList *paramList);
+
+#endif
+
+#endif
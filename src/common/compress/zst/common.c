@@ -0,0 +1,25 @@
+/***********************************************************************************************************************************
+Zstandard Common
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBZSTD
+
+#include <zstd.h>
+
+#include "common/compress/zst/common.h"
+#include "common/debug.h"
+
+/***********************************************************************************************************************************
+Process zstd errors
+***********************************************************************************************************************************/
+size_t
+zstError(size_t error)
+{
+    if (ZSTD_isError(error))
+        THROW_FMT(FormatError, "zst error: [%zd] %s", (ssize_t)error, ZSTD_getErrorName(error));
+
+    return error;
+}
+
+#endif // HAVE_LIBZSTD
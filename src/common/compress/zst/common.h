@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+Zstandard Common
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_ZST_COMMON_H
+#define COMMON_COMPRESS_ZST_COMMON_H
+
+#include <stddef.h>
+
+/***********************************************************************************************************************************
+Zstandard extension
+***********************************************************************************************************************************/
+#define ZST_EXT                                                     "zst"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBZSTD
+
+size_t zstError(size_t error);
+
+#endif
+
+#endif
@@ -0,0 +1,241 @@
+/***********************************************************************************************************************************
+Zstandard Compress
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBZSTD
+
+#include <zstd.h>
+
+#include "common/compress/zst/common.h"
+#include "common/compress/zst/compress.h"
+#include "common/compress/zst/dict.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(ZST_COMPRESS_FILTER_TYPE_STR,                         ZST_COMPRESS_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define ZST_COMPRESS_TYPE                                           ZstCompress
+#define ZST_COMPRESS_PREFIX                                         zstCompress
+
+typedef struct ZstCompress
+{
+    MemContext *memContext;                                         // Context to store data
+    ZSTD_CCtx *context;                                             // Compression context
+    int level;                                                      // Compression level
+    unsigned int thread;                                            // Threads used for compression
+    bool dict;                                                      // Was a dictionary loaded?
+
+    size_t inputOffset;                                             // Current offset from the start of the input buffer
+    bool inputSame;                                                 // Is the same input required on the next process call?
+    bool flushing;                                                  // Is input complete and flushing in progress?
+    bool done;                                                      // Is compression done?
+} ZstCompress;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+zstCompressToLog(const ZstCompress *this)
+{
+    return strNewFmt(
+        "{level: %d, thread: %u, dict: %s, inputSame: %s, inputOffset: %zu, flushing: %s, done: %s}", this->level, this->thread,
+        cvtBoolToConstZ(this->dict), cvtBoolToConstZ(this->inputSame), this->inputOffset, cvtBoolToConstZ(this->flushing),
+        cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_ZST_COMPRESS_TYPE                                                                                             \
+    ZstCompress *
+#define FUNCTION_LOG_ZST_COMPRESS_FORMAT(value, buffer, bufferSize)                                                                \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, zstCompressToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free compression context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(ZST_COMPRESS, LOG, logLevelTrace)
+{
+    ZSTD_freeCCtx(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static void
+zstCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
+{
+    THIS(ZstCompress);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(ZST_COMPRESS, this);
+        FUNCTION_LOG_PARAM(BUFFER, uncompressed);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->done);
+    ASSERT(compressed != NULL);
+    ASSERT(!this->flushing || uncompressed == NULL);
+
+    ZSTD_outBuffer output = {.dst = bufRemainsPtr(compressed), .size = bufRemains(compressed)};
+
+    // Compress input
+    if (uncompressed != NULL)
+    {
+        ZSTD_inBuffer input = {.src = bufPtr(uncompressed), .size = bufUsed(uncompressed), .pos = this->inputOffset};
+
+        // In multi-threaded mode zstd may accept part of the input without producing any output. Keep going until all input has
+        // been accepted or there is output, since the filter contract requires output when the same input will be resent. Each call
+        // either makes progress on the input or blocks until worker output can be flushed so this loop does not spin.
+        do
+        {
+            zstError(ZSTD_compressStream2(this->context, &output, &input, ZSTD_e_continue));
+        }
+        while (input.pos < input.size && output.pos == 0);
+
+        // If the input buffer was not entirely consumed then set up to reprocess it. This happens when the output buffer is full.
+        if (input.pos < input.size)
+        {
+            this->inputOffset = input.pos;
+            this->inputSame = true;
+        }
+        // Else ready for more input
+        else
+        {
+            this->inputOffset = 0;
+            this->inputSame = false;
+        }
+    }
+    // Else flush remaining output and end the frame
+    else
+    {
+        ZSTD_inBuffer input = {.src = NULL};
+
+        this->flushing = true;
+        this->done = zstError(ZSTD_compressStream2(this->context, &output, &input, ZSTD_e_end)) == 0;
+        this->inputSame = !this->done;
+    }
+
+    bufUsedInc(compressed, output.pos);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is compress done?
+***********************************************************************************************************************************/
+static bool
+zstCompressDone(const THIS_VOID)
+{
+    THIS(const ZstCompress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ZST_COMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+zstCompressInputSame(const THIS_VOID)
+{
+    THIS(const ZstCompress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ZST_COMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+zstCompressNew(int level, unsigned int thread, const Buffer *dict)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, thread);
+        FUNCTION_LOG_PARAM(BUFFER, dict);
+    FUNCTION_LOG_END();
+
+    ASSERT(level >= 0);
+    ASSERT(thread > 0);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ZstCompress")
+    {
+        ZstCompress *driver = memNew(sizeof(ZstCompress));
+        driver->memContext = MEM_CONTEXT_NEW();
+        driver->level = level;
+        driver->thread = thread;
+        driver->dict = dict != NULL;
+
+        // Create zstd context
+        driver->context = ZSTD_createCCtx();
+
+        // Set free callback to ensure zstd context is freed
+        memContextCallbackSet(driver->memContext, zstCompressFreeResource, driver);
+
+        // Set compression level and enable checksums so corruption is detected on decompression
+        zstError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_compressionLevel, level));
+        zstError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_checksumFlag, 1));
+
+        // Use worker threads when more than one thread is requested. The caller's thread only feeds input and collects output in
+        // this mode. If libzstd was built without thread support then this will fail so throw an error rather than silently
+        // compressing with a single thread.
+        if (thread > 1)
+            zstError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_nbWorkers, (int)thread));
+
+        // Load the dictionary. zstd makes an internal copy so the buffer does not need to outlive this call. The dictionary id is
+        // stored in the frame header so decompression with the wrong dictionary (or none) will fail rather than produce bad data.
+        if (dict != NULL)
+            zstError(ZSTD_CCtx_loadDictionary(driver->context, bufPtr(dict), bufUsed(dict)));
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt(thread));
+        varLstAdd(paramList, zstDictToVar(dict));
+
+        // Create filter interface
+        this = ioFilterNewP(
+            ZST_COMPRESS_FILTER_TYPE_STR, driver, paramList, .done = zstCompressDone, .inOut = zstCompressProcess,
+            .inputSame = zstCompressInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+zstCompressNewVar(const VariantList *paramList)
+{
+    // The dictionary is copied by zstd so it can be freed once the filter has been created
+    Buffer *dict = zstDictFromVar(varLstGet(paramList, 2));
+    IoFilter *result = zstCompressNew(varIntForce(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), dict);
+    bufFree(dict);
+
+    return result;
+}
+
+#endif // HAVE_LIBZSTD
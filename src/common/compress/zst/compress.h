@@ -0,0 +1,30 @@
+/***********************************************************************************************************************************
+Zstandard Compress
+
+Compress IO using the Zstandard frame format. When more than one thread is requested the compression is performed by libzstd worker
+threads so a single large file can use more than one core. An optional dictionary may be used to improve the compression ratio of
+small files with a common structure. The same dictionary must be passed to zstDecompressNew().
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_ZST_COMPRESS_H
+#define COMMON_COMPRESS_ZST_COMPRESS_H
+
+#include "common/io/filter/filter.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define ZST_COMPRESS_FILTER_TYPE                                    "zstCompress"
+    STRING_DECLARE(ZST_COMPRESS_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBZSTD
+
+IoFilter *zstCompressNew(int level, unsigned int thread, const Buffer *dict);
+IoFilter *zstCompressNewVar(const VariantList *paramList);
+
+#endif
+
+#endif
@@ -0,0 +1,203 @@
+/***********************************************************************************************************************************
+Zstandard Decompress
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBZSTD
+
+#include <zstd.h>
+
+#include "common/compress/zst/common.h"
+#include "common/compress/zst/decompress.h"
+#include "common/compress/zst/dict.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(ZST_DECOMPRESS_FILTER_TYPE_STR,                       ZST_DECOMPRESS_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define ZST_DECOMPRESS_TYPE                                         ZstDecompress
+#define ZST_DECOMPRESS_PREFIX                                       zstDecompress
+
+typedef struct ZstDecompress
+{
+    MemContext *memContext;                                         // Context to store data
+    ZSTD_DCtx *context;                                             // Decompression context
+
+    size_t inputOffset;                                             // Current offset from the start of the buffer
+    bool inputSame;                                                 // Is the same input required on the next process call?
+    bool done;                                                      // Is decompression done?
+} ZstDecompress;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+zstDecompressToLog(const ZstDecompress *this)
+{
+    return strNewFmt(
+        "{inputSame: %s, inputOffset: %zu, done: %s}", cvtBoolToConstZ(this->inputSame), this->inputOffset,
+        cvtBoolToConstZ(this->done));
+}
+
+#define FUNCTION_LOG_ZST_DECOMPRESS_TYPE                                                                                           \
+    ZstDecompress *
+#define FUNCTION_LOG_ZST_DECOMPRESS_FORMAT(value, buffer, bufferSize)                                                              \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, zstDecompressToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free decompression context
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(ZST_DECOMPRESS, LOG, logLevelTrace)
+{
+    ZSTD_freeDCtx(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Decompress data
+***********************************************************************************************************************************/
+static void
+zstDecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *decompressed)
+{
+    THIS(ZstDecompress);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(ZST_DECOMPRESS, this);
+        FUNCTION_LOG_PARAM(BUFFER, compressed);
+        FUNCTION_LOG_PARAM(BUFFER, decompressed);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(decompressed != NULL);
+
+    // When there is no more input then the frame is incomplete
+    if (compressed == NULL)
+        THROW(FormatError, "unexpected eof in compressed data");
+
+    // Decompress as much input as possible into the output buffer
+    ZSTD_inBuffer input = {.src = bufPtr(compressed), .size = bufUsed(compressed), .pos = this->inputOffset};
+    ZSTD_outBuffer output = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
+
+    this->done = zstError(ZSTD_decompressStream(this->context, &output, &input)) == 0;
+
+    bufUsedInc(decompressed, output.pos);
+
+    // If the input buffer was not entirely consumed or the output buffer is full (zstd may be holding decompressed data internally)
+    // then set up to reprocess the input
+    if (!this->done && (input.pos < input.size || bufFull(decompressed)))
+    {
+        this->inputOffset = input.pos;
+        this->inputSame = true;
+    }
+    // Else ready for more input
+    else
+    {
+        this->inputOffset = 0;
+        this->inputSame = false;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is decompress done?
+***********************************************************************************************************************************/
+static bool
+zstDecompressDone(const THIS_VOID)
+{
+    THIS(const ZstDecompress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ZST_DECOMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->done);
+}
+
+/***********************************************************************************************************************************
+Is the same input required on the next process call?
+***********************************************************************************************************************************/
+static bool
+zstDecompressInputSame(const THIS_VOID)
+{
+    THIS(const ZstDecompress);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ZST_DECOMPRESS, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->inputSame);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+zstDecompressNew(const Buffer *dict)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BUFFER, dict);
+    FUNCTION_LOG_END();
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ZstDecompress")
+    {
+        // Allocate state and set context
+        ZstDecompress *driver = memNew(sizeof(ZstDecompress));
+        driver->memContext = MEM_CONTEXT_NEW();
+
+        // Create zstd context
+        driver->context = ZSTD_createDCtx();
+
+        // Set free callback to ensure zstd context is freed
+        memContextCallbackSet(driver->memContext, zstDecompressFreeResource, driver);
+
+        // Load the dictionary used for compression
+        VariantList *paramList = NULL;
+
+        if (dict != NULL)
+        {
+            zstError(ZSTD_DCtx_loadDictionary(driver->context, bufPtr(dict), bufUsed(dict)));
+
+            // Create param list
+            paramList = varLstNew();
+            varLstAdd(paramList, zstDictToVar(dict));
+        }
+
+        // Create filter interface
+        this = ioFilterNewP(
+            ZST_DECOMPRESS_FILTER_TYPE_STR, driver, paramList, .done = zstDecompressDone, .inOut = zstDecompressProcess,
+            .inputSame = zstDecompressInputSame);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+zstDecompressNewVar(const VariantList *paramList)
+{
+    // The dictionary is copied by zstd so it can be freed once the filter has been created
+    Buffer *dict = paramList == NULL ? NULL : zstDictFromVar(varLstGet(paramList, 0));
+    IoFilter *result = zstDecompressNew(dict);
+    bufFree(dict);
+
+    return result;
+}
+
+#endif // HAVE_LIBZSTD
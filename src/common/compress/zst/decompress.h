@@ -0,0 +1,29 @@
+/***********************************************************************************************************************************
+Zstandard Decompress
+
+Decompress IO from the Zstandard frame format. If the data was compressed with a dictionary then the same dictionary must be
+provided.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_ZST_DECOMPRESS_H
+#define COMMON_COMPRESS_ZST_DECOMPRESS_H
+
+#include "common/io/filter/filter.h"
+#include "common/type/buffer.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define ZST_DECOMPRESS_FILTER_TYPE                                  "zstDecompress"
+    STRING_DECLARE(ZST_DECOMPRESS_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBZSTD
+
+IoFilter *zstDecompressNew(const Buffer *dict);
+IoFilter *zstDecompressNewVar(const VariantList *paramList);
+
+#endif
+
+#endif
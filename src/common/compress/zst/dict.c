@@ -0,0 +1,115 @@
+/***********************************************************************************************************************************
+Zstandard Dictionary
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zdict.h>
+#endif
+
+#include "common/compress/zst/dict.h"
+#include "common/debug.h"
+#include "common/encode.h"
+#include "common/log.h"
+#include "common/memContext.h"
+
+#ifdef HAVE_LIBZSTD
+
+/**********************************************************************************************************************************/
+Buffer *
+zstDictTrain(const Buffer *sample, size_t chunkSize, size_t dictSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BUFFER, sample);
+        FUNCTION_LOG_PARAM(SIZE, chunkSize);
+        FUNCTION_LOG_PARAM(SIZE, dictSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(sample != NULL);
+    ASSERT(chunkSize > 0);
+    ASSERT(dictSize > 0);
+
+    Buffer *result = NULL;
+
+    // zstd rejects samples that contain fewer chunks than this, so there is no point trying
+    unsigned int chunkTotal = (unsigned int)((bufUsed(sample) + chunkSize - 1) / chunkSize);
+
+    if (chunkTotal >= 8)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Build the list of chunk sizes required by the trainer
+            size_t *chunkSizeList = memNew(sizeof(size_t) * chunkTotal);
+
+            for (unsigned int chunkIdx = 0; chunkIdx < chunkTotal; chunkIdx++)
+            {
+                chunkSizeList[chunkIdx] =
+                    chunkIdx == chunkTotal - 1 ? bufUsed(sample) - (size_t)chunkIdx * chunkSize : chunkSize;
+            }
+
+            // Train the dictionary. An error here is not fatal -- it just means the sample was not useful for training.
+            Buffer *dict = bufNew(dictSize);
+            size_t dictUsed = ZDICT_trainFromBuffer(bufPtr(dict), dictSize, bufPtr(sample), chunkSizeList, chunkTotal);
+
+            if (ZDICT_isError(dictUsed))
+            {
+                LOG_DEBUG("unable to train zst dictionary: %s", ZDICT_getErrorName(dictUsed));
+            }
+            else
+            {
+                bufUsedSet(dict, dictUsed);
+                bufResize(dict, dictUsed);
+                result = bufMove(dict, MEM_CONTEXT_OLD());
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+#endif // HAVE_LIBZSTD
+
+/**********************************************************************************************************************************/
+Variant *
+zstDictToVar(const Buffer *dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    Variant *result = NULL;
+
+    if (dict != NULL)
+    {
+        char *dictStr = memNew(encodeToStrSize(encodeBase64, bufUsed(dict)) + 1);
+        encodeToStr(encodeBase64, bufPtr(dict), bufUsed(dict), dictStr);
+
+        result = varNewStrZ(dictStr);
+        memFree(dictStr);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+zstDictFromVar(const Variant *dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VARIANT, dict);
+    FUNCTION_TEST_END();
+
+    Buffer *result = NULL;
+
+    if (dict != NULL)
+    {
+        const char *dictStr = strPtr(varStr(dict));
+
+        result = bufNew(decodeToBinSize(encodeBase64, dictStr));
+        decodeToBin(encodeBase64, dictStr, bufPtr(result));
+        bufUsedSet(result, bufSize(result));
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -0,0 +1,34 @@
+/***********************************************************************************************************************************
+Zstandard Dictionary
+
+Train a dictionary from a sample of data that is similar to the data that will be compressed. PostgreSQL relation files are made of
+pages with a lot of common structure (page headers, line pointers, tuple headers) so a dictionary trained on a sample of pages lets
+zstd find matches from the first byte of each file rather than learning the structure again for every file.
+***********************************************************************************************************************************/
+#ifndef COMMON_COMPRESS_ZST_DICT_H
+#define COMMON_COMPRESS_ZST_DICT_H
+
+#include "common/type/buffer.h"
+#include "common/type/variant.h"
+
+/***********************************************************************************************************************************
+Default dictionary size
+***********************************************************************************************************************************/
+#define ZST_DICT_SIZE_DEFAULT                                       ((size_t)32 * 1024)
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+#ifdef HAVE_LIBZSTD
+
+// Train a dictionary from a sample that is split into chunks of chunkSize bytes (e.g. pages). The last chunk may be shorter.
+// Returns NULL when zstd is not able to train a useful dictionary from the sample, e.g. because the sample is too small.
+Buffer *zstDictTrain(const Buffer *sample, size_t chunkSize, size_t dictSize);
+
+#endif
+
+// Convert a dictionary to/from a variant so it can be passed as a filter parameter. NULL dictionaries are passed as NULL variants.
+Variant *zstDictToVar(const Buffer *dict);
+Buffer *zstDictFromVar(const Variant *dict);
+
+#endif
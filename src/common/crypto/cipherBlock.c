@@ -29,9 +29,26 @@ Header constants and sizes
 #define CIPHER_BLOCK_MAGIC                                          "Salted__"
 #define CIPHER_BLOCK_MAGIC_SIZE                                     (sizeof(CIPHER_BLOCK_MAGIC) - 1)
 
+// Magic constant for chunked encrypt.  The magic is the same size as the salted magic so the header size does not depend on the
+// cipher.  The openssl command-line tool does not support this format.
+#define CIPHER_BLOCK_CHUNK_MAGIC                                    "GcmChunk"
+
 // Total length of cipher header
 #define CIPHER_BLOCK_HEADER_SIZE                                    (CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN)
 
+/***********************************************************************************************************************************
+Chunk constants and sizes
+
+Chunked ciphers (e.g. aes-256-gcm) split the plaintext into fixed size chunks that are encrypted and authenticated independently.
+Each chunk is stored as ciphertext followed by the authentication tag. The nonce for a chunk is the initialization vector with the
+chunk index xor'd into the last eight bytes, and a single byte of additional authenticated data marks the last chunk so truncation
+is detected. Since the offset and nonce of any chunk can be calculated from the header, chunks can be decrypted in parallel or
+starting from any chunk.
+***********************************************************************************************************************************/
+#define CIPHER_BLOCK_CHUNK_SIZE                                     ((size_t)64 * 1024)
+#define CIPHER_BLOCK_CHUNK_TAG_SIZE                                 16
+#define CIPHER_BLOCK_CHUNK_NONCE_SIZE                               12
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -52,6 +69,12 @@ typedef struct CipherBlock
     const EVP_MD *digest;                                           // Message digest object
     EVP_CIPHER_CTX *cipherContext;                                  // Encrypt/decrypt context
 
+    bool chunked;                                                   // Is the cipher chunked?
+    unsigned char key[EVP_MAX_KEY_LENGTH];                          // Key used to initialize each chunk
+    unsigned char initVector[EVP_MAX_IV_LENGTH];                    // Initialization vector used to generate chunk nonces
+    uint64_t chunkIdx;                                              // Index of the next chunk
+    Buffer *chunk;                                                  // Partial chunk (plaintext on encrypt, ciphertext on decrypt)
+
     Buffer *buffer;                                                 // Internal buffer in case destination buffer isn't large enough
     bool inputSame;                                                 // Is the same input required on next process call?
     bool done;                                                      // Is processing done?
@@ -97,6 +120,14 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     // Destination size is source size plus one extra block
     size_t destinationSize = sourceSize + EVP_MAX_BLOCK_LENGTH;
 
+    // Chunked ciphers may output a buffered chunk plus a tag for each chunk. On decrypt the cipher is not known until the header
+    // has been read but nothing has been buffered yet so the output cannot be larger than the source.
+    if (this->chunked)
+    {
+        destinationSize =
+            sourceSize + CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE * (sourceSize / CIPHER_BLOCK_CHUNK_SIZE + 1);
+    }
+
     // On encrypt the header size must be included before the first block
     if (this->mode == cipherModeEncrypt && !this->saltDone)
         destinationSize += CIPHER_BLOCK_MAGIC_SIZE + PKCS5_SALT_LEN;
@@ -104,6 +135,93 @@ cipherBlockProcessSize(CipherBlock *this, size_t sourceSize)
     FUNCTION_LOG_RETURN(SIZE, destinationSize);
 }
 
+/***********************************************************************************************************************************
+Encrypt/decrypt a chunk
+***********************************************************************************************************************************/
+static size_t
+cipherBlockChunk(CipherBlock *this, const unsigned char *source, size_t sourceSize, bool last, unsigned char *destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(CIPHER_BLOCK, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, source);
+        FUNCTION_LOG_PARAM(SIZE, sourceSize);
+        FUNCTION_LOG_PARAM(BOOL, last);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->chunked);
+    ASSERT(source != NULL || sourceSize == 0);
+    ASSERT(destination != NULL);
+
+    // On decrypt the tag follows the ciphertext
+    size_t dataSize = sourceSize;
+
+    if (this->mode == cipherModeDecrypt)
+    {
+        if (sourceSize < CIPHER_BLOCK_CHUNK_TAG_SIZE)
+            THROW(CryptoError, "cipher chunk truncated");
+
+        dataSize -= CIPHER_BLOCK_CHUNK_TAG_SIZE;
+    }
+
+    // Generate the nonce from the initialization vector and chunk index
+    unsigned char nonce[CIPHER_BLOCK_CHUNK_NONCE_SIZE];
+    memcpy(nonce, this->initVector, CIPHER_BLOCK_CHUNK_NONCE_SIZE);
+
+    for (unsigned int byteIdx = 0; byteIdx < sizeof(this->chunkIdx); byteIdx++)
+        nonce[CIPHER_BLOCK_CHUNK_NONCE_SIZE - 1 - byteIdx] ^= (unsigned char)(this->chunkIdx >> (byteIdx * 8));
+
+    // Reinitialize the cipher with the chunk nonce
+    cryptoError(
+        !EVP_CipherInit_ex(this->cipherContext, NULL, NULL, this->key, nonce, this->mode == cipherModeEncrypt),
+        "unable to initialize cipher chunk");
+
+    // Authenticate the last chunk flag
+    unsigned char lastFlag = last;
+    int updateSize = 0;
+
+    cryptoError(
+        !EVP_CipherUpdate(this->cipherContext, NULL, &updateSize, &lastFlag, sizeof(lastFlag)), "unable to process cipher chunk");
+
+    // Process the data
+    if (dataSize > 0)
+    {
+        cryptoError(
+            !EVP_CipherUpdate(this->cipherContext, destination, &updateSize, source, (int)dataSize),
+            "unable to process cipher chunk");
+    }
+
+    // Set the expected tag on decrypt
+    if (this->mode == cipherModeDecrypt)
+    {
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(
+                this->cipherContext, EVP_CTRL_GCM_SET_TAG, CIPHER_BLOCK_CHUNK_TAG_SIZE, (void *)(source + dataSize)),
+            "unable to set cipher chunk tag");
+    }
+
+    // Finalize the chunk. GCM does not output any data here but a failure on decrypt means the chunk was not authenticated.
+    if (!EVP_CipherFinal_ex(this->cipherContext, destination + dataSize, &updateSize))
+        THROW(CryptoError, "cipher chunk authentication failed");
+
+    // Append the tag on encrypt
+    size_t destinationSize = dataSize;
+
+    if (this->mode == cipherModeEncrypt)
+    {
+        cryptoError(
+            !EVP_CIPHER_CTX_ctrl(this->cipherContext, EVP_CTRL_GCM_GET_TAG, CIPHER_BLOCK_CHUNK_TAG_SIZE, destination + dataSize),
+            "unable to get cipher chunk tag");
+
+        destinationSize += CIPHER_BLOCK_CHUNK_TAG_SIZE;
+    }
+
+    this->chunkIdx++;
+
+    FUNCTION_LOG_RETURN(SIZE, destinationSize);
+}
+
 /***********************************************************************************************************************************
 Encrypt/decrypt data
 ***********************************************************************************************************************************/
@@ -132,8 +250,8 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
         // On encrypt the salt is generated
         if (this->mode == cipherModeEncrypt)
         {
-            // Add magic to the destination buffer so openssl knows the file is salted
-            memcpy(destination, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
+            // Add magic to the destination buffer so openssl knows the file is salted (or so decrypt knows the file is chunked)
+            memcpy(destination, this->chunked ? CIPHER_BLOCK_CHUNK_MAGIC : CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE);
             destination += CIPHER_BLOCK_MAGIC_SIZE;
             destinationSize += CIPHER_BLOCK_MAGIC_SIZE;
 
@@ -158,9 +276,25 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
                 sourceSize -= CIPHER_BLOCK_HEADER_SIZE - this->headerSize;
 
                 // The first bytes of the file to decrypt should be equal to the magic.  If not then this is not an
-                // encrypted file, or at least not in a format we recognize.
-                if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) != 0)
+                // encrypted file, or at least not in a format we recognize.  The magic also determines the cipher so chunked files
+                // can be decrypted when the cipher type is aes-256-cbc.  The reverse is not allowed since files that are not
+                // authenticated could otherwise be substituted for authenticated files.
+                if (memcmp(this->header, CIPHER_BLOCK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                {
+                    if (this->chunked)
+                    {
+                        THROW_FMT(
+                            CryptoError, "cipher header is for '%s' but cipher type is '%s'",
+                            strPtr(cipherTypeName(cipherTypeAes256Cbc)), strPtr(cipherTypeName(cipherTypeAes256Gcm)));
+                    }
+                }
+                else if (memcmp(this->header, CIPHER_BLOCK_CHUNK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0)
+                    this->chunked = true;
+                else
                     THROW(CryptoError, "cipher header invalid");
+
+                this->cipher = EVP_get_cipherbyname(
+                    strPtr(cipherTypeName(this->chunked ? cipherTypeAes256Gcm : cipherTypeAes256Cbc)));
             }
             // Else copy what was provided into the header buffer and return 0
             else
@@ -177,11 +311,9 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
         if (salt)
         {
             // Generate key and initialization vector
-            unsigned char key[EVP_MAX_KEY_LENGTH];
-            unsigned char initVector[EVP_MAX_IV_LENGTH];
-
             EVP_BytesToKey(
-                this->cipher, this->digest, salt, (unsigned char *)this->pass, (int)this->passSize, 1, key, initVector);
+                this->cipher, this->digest, salt, (unsigned char *)this->pass, (int)this->passSize, 1, this->key,
+                this->initVector);
 
             // Create context to track cipher
             cryptoError(!(this->cipherContext = EVP_CIPHER_CTX_new()), "unable to create context");
@@ -192,15 +324,50 @@ cipherBlockProcessBlock(CipherBlock *this, const unsigned char *source, size_t s
             // Initialize cipher
             cryptoError(
                 !EVP_CipherInit_ex(
-                    this->cipherContext, this->cipher, NULL, key, initVector, this->mode == cipherModeEncrypt),
+                    this->cipherContext, this->cipher, NULL, this->key, this->initVector, this->mode == cipherModeEncrypt),
                     "unable to initialize cipher");
 
+            // Allocate the partial chunk buffer
+            if (this->chunked)
+            {
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->chunk = bufNew(CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE);
+                }
+                MEM_CONTEXT_END();
+            }
+
             this->saltDone = true;
         }
     }
 
     // Recheck that source size > 0 as the bytes may have been consumed reading the header
-    if (sourceSize > 0)
+    if (sourceSize > 0 && this->chunked)
+    {
+        // The last chunk is not known until flush so a full chunk is only processed when more data arrives
+        size_t chunkSizeMax = CIPHER_BLOCK_CHUNK_SIZE + (this->mode == cipherModeDecrypt ? CIPHER_BLOCK_CHUNK_TAG_SIZE : 0);
+
+        while (sourceSize > 0)
+        {
+            if (bufUsed(this->chunk) == chunkSizeMax)
+            {
+                size_t chunkSize = cipherBlockChunk(this, bufPtr(this->chunk), bufUsed(this->chunk), false, destination);
+                destination += chunkSize;
+                destinationSize += chunkSize;
+                bufUsedZero(this->chunk);
+            }
+
+            size_t catSize = sourceSize < chunkSizeMax - bufUsed(this->chunk) ? sourceSize : chunkSizeMax - bufUsed(this->chunk);
+            bufCatC(this->chunk, source, 0, catSize);
+
+            source += catSize;
+            sourceSize -= catSize;
+        }
+
+        // Note that data has been processed so flush is valid
+        this->processDone = true;
+    }
+    else if (sourceSize > 0)
     {
         // Process the data
         size_t destinationUpdateSize = 0;
@@ -240,8 +407,14 @@ cipherBlockFlush(CipherBlock *this, Buffer *destination)
     if (!this->saltDone)
         THROW(CryptoError, "cipher header missing");
 
+    // Process the last chunk, which may be empty
+    if (this->chunked)
+    {
+        destinationSize = cipherBlockChunk(this, bufPtr(this->chunk), bufUsed(this->chunk), true, bufRemainsPtr(destination));
+        bufUsedZero(this->chunk);
+    }
     // Only flush remaining data if some data was processed
-    if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), (int *)&destinationSize))
+    else if (!EVP_CipherFinal(this->cipherContext, bufRemainsPtr(destination), (int *)&destinationSize))
         THROW(CryptoError, "unable to flush");
 
     // Return actual destination size
@@ -428,6 +601,7 @@ cipherBlockNew(CipherMode mode, CipherType cipherType, const Buffer *pass, const
         // Set cipher and digest
         driver->cipher = cipher;
         driver->digest = digest;
+        driver->chunked = cipherType == cipherTypeAes256Gcm;
 
         // Store the passphrase
         driver->passSize = bufUsed(pass);
@@ -0,0 +1,145 @@
+/***********************************************************************************************************************************
+xxHash Checksum
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBXXHASH
+#include <xxhash.h>
+#endif
+
+#include "common/crypto/xxHash.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "version.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(XXHASH_FILTER_TYPE_STR,                               XXHASH_FILTER_TYPE);
+
+#ifdef HAVE_LIBXXHASH
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define XXHASH_TYPE                                                 XxHash
+#define XXHASH_PREFIX                                               xxHash
+
+typedef struct XxHash
+{
+    MemContext *memContext;                                         // Context to store data
+    XXH3_state_t *state;                                            // Checksum state
+} XxHash;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_XXHASH_TYPE                                                                                                   \
+    XxHash *
+#define FUNCTION_LOG_XXHASH_FORMAT(value, buffer, bufferSize)                                                                      \
+    objToLog(value, "XxHash", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free checksum state
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(XXHASH, LOG, logLevelTrace)
+{
+    XXH3_freeState(this->state);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Add data to the checksum
+***********************************************************************************************************************************/
+static void
+xxHashProcess(THIS_VOID, const Buffer *input)
+{
+    THIS(XxHash);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(XXHASH, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    if (XXH3_128bits_update(this->state, bufPtr(input), bufUsed(input)) != XXH_OK)
+        THROW(AssertError, "unable to process xxhash");
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get string representation of the checksum as a filter result
+***********************************************************************************************************************************/
+static Variant *
+xxHashResult(THIS_VOID)
+{
+    THIS(XxHash);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(XXHASH, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Use the canonical (big-endian) form so the checksum matches the output of xxhsum
+    XXH128_canonical_t canonical;
+    XXH128_canonicalFromHash(&canonical, XXH3_128bits_digest(this->state));
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewStr(bufHex(BUF(canonical.digest, sizeof(canonical.digest)))));
+}
+
+#endif // HAVE_LIBXXHASH
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+IoFilter *
+xxHashNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    IoFilter *this = NULL;
+
+#ifdef HAVE_LIBXXHASH
+    MEM_CONTEXT_NEW_BEGIN("XxHash")
+    {
+        XxHash *driver = memNew(sizeof(XxHash));
+        driver->memContext = MEM_CONTEXT_NEW();
+
+        // Create state and set free callback to ensure it is freed
+        driver->state = XXH3_createState();
+
+        if (driver->state == NULL || XXH3_128bits_reset(driver->state) != XXH_OK)
+            THROW(MemoryError, "unable to create xxhash state");
+
+        memContextCallbackSet(driver->memContext, xxHashFreeResource, driver);
+
+        // Create filter interface
+        this = ioFilterNewP(XXHASH_FILTER_TYPE_STR, driver, NULL, .in = xxHashProcess, .result = xxHashResult);
+    }
+    MEM_CONTEXT_NEW_END();
+#else
+    THROW(AssertError, PROJECT_NAME " not compiled with xxhash support");
+#endif
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+/**********************************************************************************************************************************/
+bool
+xxHashPresent(void)
+{
+    FUNCTION_TEST_VOID();
+
+#ifdef HAVE_LIBXXHASH
+    FUNCTION_TEST_RETURN(true);
+#else
+    FUNCTION_TEST_RETURN(false);
+#endif
+}
@@ -0,0 +1,39 @@
+/***********************************************************************************************************************************
+xxHash Checksum
+
+Generate a fast non-cryptographic checksum (XXH3 128-bit) using an IoFilter. The checksum is used to detect changed files during
+delta backup/restore where the speed of SHA1 is a bottleneck. It is not suitable where collisions could be crafted, so SHA1 is
+still recorded for each file.
+***********************************************************************************************************************************/
+#ifndef COMMON_CRYPTO_XXHASH_H
+#define COMMON_CRYPTO_XXHASH_H
+
+#include "common/io/filter/filter.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define XXHASH_FILTER_TYPE                                          "xxHash"
+    STRING_DECLARE(XXHASH_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Checksum for zero-length files and checksum sizes
+***********************************************************************************************************************************/
+#define XXHASH_ZERO                                                 "99aa06d3014798d86001c324468d497f"
+
+#define XXHASH_SIZE                                                 16
+#define XXHASH_SIZE_HEX                                             (XXHASH_SIZE * 2)
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+IoFilter *xxHashNew(void);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Was xxHash present at build time?
+bool xxHashPresent(void);
+
+#endif
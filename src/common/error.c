@@ -40,8 +40,10 @@ typedef enum {errorStateBegin, errorStateTry, errorStateCatch, errorStateFinal,
 
 /***********************************************************************************************************************************
 Track error handling
+
+Each thread tracks its own errors so they can be thrown and caught independently.
 ***********************************************************************************************************************************/
-static struct
+static __thread struct
 {
     // Array of jump buffers
     jmp_buf jumpList[ERROR_TRY_MAX];
@@ -78,9 +80,9 @@ The temp buffer is required because the error message being passed might be the
 ***********************************************************************************************************************************/
 #define ERROR_MESSAGE_BUFFER_SIZE                                   8192
 
-static char messageBuffer[ERROR_MESSAGE_BUFFER_SIZE];
-static char messageBufferTemp[ERROR_MESSAGE_BUFFER_SIZE];
-static char stackTraceBuffer[ERROR_MESSAGE_BUFFER_SIZE];
+static __thread char messageBuffer[ERROR_MESSAGE_BUFFER_SIZE];
+static __thread char messageBufferTemp[ERROR_MESSAGE_BUFFER_SIZE];
+static __thread char stackTraceBuffer[ERROR_MESSAGE_BUFFER_SIZE];
 
 /***********************************************************************************************************************************
 Error type code
@@ -10,6 +10,7 @@ Exit Routines
 #include "common/debug.h"
 #include "common/error.h"
 #include "common/exit.h"
+#include "common/io/stat.h"
 #include "common/lock.h"
 #include "common/log.h"
 #include "config/config.h"
@@ -136,6 +137,18 @@ exitSafe(int result, bool error, SignalType signalType)
         result = errorCode();
     }
 
+    // Gather IO statistics from local processes and log the totals for the command but ignore errors. Local and remote processes
+    // report their statistics to the process that started them so they do not log.
+    if (result == 0 && ioStatEnabled() && cfgCommand() != cfgCmdLocal && cfgCommand() != cfgCmdRemote)
+    {
+        TRY_BEGIN()
+        {
+            protocolLocalIoStat();
+            ioStatTotalLog();
+        }
+        TRY_END();
+    }
+
     // Free protocol objects but ignore errors
     TRY_BEGIN()
     {
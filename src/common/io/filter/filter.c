@@ -5,6 +5,7 @@ IO Filter Interface
 
 #include "common/debug.h"
 #include "common/io/filter/filter.intern.h"
+#include "common/io/stat.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
@@ -21,6 +22,7 @@ struct IoFilter
     IoFilterInterface interface;                                    // Filter interface
 
     bool flushing;                                                  // Has the filter started flushing?
+    IoStat stat;                                                    // Statistics (when enabled)
 };
 
 OBJECT_DEFINE_MOVE(IO_FILTER);
@@ -79,8 +81,19 @@ ioFilterProcessIn(IoFilter *this, const Buffer *input)
     if (input == NULL)
         this->flushing = true;
     else
+    {
+        IoStatTime statBegin = {0};
+
+        if (ioStatEnabled())
+            statBegin = ioStatBegin();
+
         this->interface.in(this->driver, input);
 
+        // The input is passed on unmodified so it is counted as output as well
+        if (ioStatEnabled())
+            ioStatEnd(&this->stat, statBegin, bufUsed(input), bufUsed(input));
+    }
+
     FUNCTION_TEST_RETURN_VOID();
 }
 
@@ -106,8 +119,24 @@ ioFilterProcessInOut(IoFilter *this, const Buffer *input, Buffer *output)
         this->flushing = true;
 
     if (!ioFilterDone(this))
+    {
+        IoStatTime statBegin = {0};
+        size_t outputBegin = bufUsed(output);
+
+        if (ioStatEnabled())
+            statBegin = ioStatBegin();
+
         this->interface.inOut(this->driver, input, output);
 
+        // Count input only once it has been consumed since the same input will be passed again when inputSame is true
+        if (ioStatEnabled())
+        {
+            ioStatEnd(
+                &this->stat, statBegin, input != NULL && !ioFilterInputSame(this) ? bufUsed(input) : 0,
+                bufUsed(output) - outputBegin);
+        }
+    }
+
     CHECK(!ioFilterInputSame(this) || bufUsed(output) > 0);
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -229,6 +258,23 @@ ioFilterResult(const IoFilter *this)
     FUNCTION_TEST_RETURN(this->interface.result ? this->interface.result(this->driver) : NULL);
 }
 
+/***********************************************************************************************************************************
+Get filter statistics
+
+Statistics are only accumulated when ioStatEnabled() is true.
+***********************************************************************************************************************************/
+const IoStat *
+ioFilterStat(const IoFilter *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(&this->stat);
+}
+
 /***********************************************************************************************************************************
 Get filter type
 
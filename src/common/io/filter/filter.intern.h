@@ -19,6 +19,7 @@ Each filter has a type that allows it to be identified in the filter list.
 #define COMMON_IO_FILTER_FILTER_INTERN_H
 
 #include "common/io/filter/filter.h"
+#include "common/io/stat.h"
 #include "common/type/variantList.h"
 
 /***********************************************************************************************************************************
@@ -70,6 +71,7 @@ bool ioFilterInputSame(const IoFilter *this);
 const IoFilterInterface *ioFilterInterface(const IoFilter *this);
 bool ioFilterOutput(const IoFilter *this);
 const VariantList *ioFilterParamList(const IoFilter *this);
+const IoStat *ioFilterStat(const IoFilter *this);
 
 /***********************************************************************************************************************************
 Macros for function logging
@@ -3,13 +3,17 @@ IO Filter Group
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "common/debug.h"
 #include "common/io/filter/buffer.h"
 #include "common/io/filter/filter.intern.h"
 #include "common/io/filter/group.h"
 #include "common/io/io.h"
+#include "common/io/stat.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
@@ -34,6 +38,83 @@ typedef struct IoFilterData
 #define FUNCTION_LOG_IO_FILTER_DATA_FORMAT(value, buffer, bufferSize)                                                              \
     objToLog(value, "IoFilterData", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Threaded processing
+
+When filter threads are enabled each filter runs in its own thread. Filters are connected by queues of buffers and each filter that
+produces output has a pool of buffers so it can fill one buffer while the next filter processes another. Filters that only accept
+input pass each input buffer on to the next filter after processing it. A buffer is returned to the pool it came from when the last
+filter to use it is done. Only full buffers are passed on, except when flushing, so each filter gets the same input it would get
+when processing serially and the results are the same.
+
+The caller's input is copied into a buffer from the first pool and the output of the last filter is copied to the caller's output
+buffer, so the caller only waits on the filters when all the buffers are in use.
+***********************************************************************************************************************************/
+#define IO_FILTER_GROUP_THREAD_TYPE                                 IoFilterGroupThread
+#define IO_FILTER_GROUP_THREAD_PREFIX                               ioFilterGroupThread
+
+// Buffers in each pool
+#define IO_FILTER_GROUP_THREAD_BUFFER                               2
+
+// Size of the error message passed back from a filter thread
+#define IO_FILTER_GROUP_THREAD_ERROR_SIZE                           4096
+
+typedef struct IoFilterGroupThreadEntry
+{
+    Buffer *buffer;                                                 // Buffer to process (NULL when there is no more input)
+    unsigned int poolIdx;                                           // Pool to return the buffer to when processing is done
+} IoFilterGroupThreadEntry;
+
+typedef struct IoFilterGroupThreadQueue
+{
+    IoFilterGroupThreadEntry *entryList;                            // Ring of entries
+    unsigned int entryHead;                                         // Oldest entry
+    unsigned int entryTotal;                                        // Entries in the queue
+} IoFilterGroupThreadQueue;
+
+typedef struct IoFilterGroupThreadPool
+{
+    Buffer *bufferList[IO_FILTER_GROUP_THREAD_BUFFER];              // Free buffers
+    unsigned int bufferTotal;                                       // Free buffers in the list
+} IoFilterGroupThreadPool;
+
+typedef struct IoFilterGroupThreadStage
+{
+    struct IoFilterGroupThread *thread;                             // Threads the stage belongs to
+    IoFilter *filter;                                               // Filter to apply
+    unsigned int stageIdx;                                          // Input from queue stageIdx and output to queue stageIdx + 1
+} IoFilterGroupThreadStage;
+
+typedef struct IoFilterGroupThread
+{
+    MemContext *memContext;                                         // Mem context
+
+    pthread_mutex_t mutex;                                          // Protects all state shared with the threads
+    pthread_cond_t change;                                          // Signaled when a queue, pool, or error changes
+    pthread_t *threadList;                                          // Filter threads
+    unsigned int threadTotal;                                       // Filter threads started
+    bool shutdown;                                                  // Should the threads exit?
+
+    IoFilterGroupThreadStage *stageList;                            // One stage per filter thread
+    unsigned int stageTotal;                                        // Total stages
+    IoFilterGroupThreadQueue *queueList;                            // Queues between stages (the last is read by the caller)
+    IoFilterGroupThreadPool *poolList;                              // Buffer pools (the first is filled by the caller)
+    unsigned int queueMax;                                          // Maximum entries in a queue
+
+    const ErrorType *errorType;                                     // Error thrown by a filter thread
+    char errorMessage[IO_FILTER_GROUP_THREAD_ERROR_SIZE];           // Error message thrown by a filter thread
+
+    size_t outputOffset;                                            // Bytes of the oldest output already copied to the caller
+    bool inputEnd;                                                  // Has the end of the input been queued?
+    bool outputEnd;                                                 // Has the end of the output been received?
+} IoFilterGroupThread;
+
+// Macros for logging
+#define FUNCTION_LOG_IO_FILTER_GROUP_THREAD_TYPE                                                                                   \
+    IoFilterGroupThread *
+#define FUNCTION_LOG_IO_FILTER_GROUP_THREAD_FORMAT(value, buffer, bufferSize)                                                      \
+    objToLog(value, "IoFilterGroupThread", buffer, bufferSize)
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -41,8 +122,11 @@ struct IoFilterGroup
 {
     MemContext *memContext;                                         // Mem context
     List *filterList;                                               // List of filters to apply
+    IoFilterGroupThread *thread;                                    // Filter threads (NULL when processing serially)
     const Buffer *input;                                            // Input buffer passed in for processing
     KeyValue *filterResult;                                         // Filter results (if any)
+    bool filterBuffer;                                              // Was the buffer filter added to the end of the list?
+    bool inPlace;                                                   // Can input be processed in place?
     bool inputSame;                                                 // Same input required again?
     bool done;                                                      // Is processing done?
 
@@ -55,6 +139,374 @@ struct IoFilterGroup
 
 OBJECT_DEFINE_FREE(IO_FILTER_GROUP);
 
+/***********************************************************************************************************************************
+Stop filter threads
+
+Stopping is safe at any time since the threads check for shutdown whenever they wait.
+***********************************************************************************************************************************/
+static void
+ioFilterGroupThreadStop(IoFilterGroupThread *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    pthread_mutex_lock(&this->mutex);
+    this->shutdown = true;
+    pthread_cond_broadcast(&this->change);
+    pthread_mutex_unlock(&this->mutex);
+
+    for (unsigned int threadIdx = 0; threadIdx < this->threadTotal; threadIdx++)
+        pthread_join(this->threadList[threadIdx], NULL);
+
+    this->threadTotal = 0;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Stop filter threads when freed
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(IO_FILTER_GROUP_THREAD, LOG, logLevelTrace)
+{
+    ioFilterGroupThreadStop(this);
+
+    pthread_cond_destroy(&this->change);
+    pthread_mutex_destroy(&this->mutex);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Create filter threads
+
+Threads are not started until the group is opened. This object must be created before any filters are added to the group so it is
+freed, stopping the threads, before the filters and buffers the threads are using.
+***********************************************************************************************************************************/
+static IoFilterGroupThread *
+ioFilterGroupThreadNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    IoFilterGroupThread *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("IoFilterGroupThread")
+    {
+        this = memNew(sizeof(IoFilterGroupThread));
+        this->memContext = MEM_CONTEXT_NEW();
+
+        pthread_mutex_init(&this->mutex, NULL);
+        pthread_cond_init(&this->change, NULL);
+
+        memContextCallbackSet(this->memContext, ioFilterGroupThreadFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/***********************************************************************************************************************************
+Add an entry to a queue. The mutex must be held.
+***********************************************************************************************************************************/
+static void
+ioFilterGroupThreadPut(IoFilterGroupThread *this, unsigned int queueIdx, Buffer *buffer, unsigned int poolIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+        FUNCTION_TEST_PARAM(UINT, queueIdx);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+        FUNCTION_TEST_PARAM(UINT, poolIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    IoFilterGroupThreadQueue *queue = &this->queueList[queueIdx];
+    ASSERT(queue->entryTotal < this->queueMax);
+
+    queue->entryList[(queue->entryHead + queue->entryTotal) % this->queueMax] = (IoFilterGroupThreadEntry)
+    {
+        .buffer = buffer,
+        .poolIdx = poolIdx,
+    };
+
+    queue->entryTotal++;
+    pthread_cond_broadcast(&this->change);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Remove the oldest entry from a queue, waiting until there is one. Returns false on shutdown. The mutex must be held.
+***********************************************************************************************************************************/
+static bool
+ioFilterGroupThreadGet(IoFilterGroupThread *this, unsigned int queueIdx, IoFilterGroupThreadEntry *entry)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+        FUNCTION_TEST_PARAM(UINT, queueIdx);
+        FUNCTION_TEST_PARAM_P(VOID, entry);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(entry != NULL);
+
+    IoFilterGroupThreadQueue *queue = &this->queueList[queueIdx];
+
+    while (!this->shutdown && queue->entryTotal == 0)
+        pthread_cond_wait(&this->change, &this->mutex);
+
+    if (!this->shutdown)
+    {
+        *entry = queue->entryList[queue->entryHead];
+        queue->entryHead = (queue->entryHead + 1) % this->queueMax;
+        queue->entryTotal--;
+    }
+
+    FUNCTION_TEST_RETURN(!this->shutdown);
+}
+
+/***********************************************************************************************************************************
+Get a free buffer from a pool, waiting until there is one. Returns NULL on shutdown. The mutex must be held.
+***********************************************************************************************************************************/
+static Buffer *
+ioFilterGroupThreadBuffer(IoFilterGroupThread *this, unsigned int poolIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+        FUNCTION_TEST_PARAM(UINT, poolIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    IoFilterGroupThreadPool *pool = &this->poolList[poolIdx];
+
+    while (!this->shutdown && pool->bufferTotal == 0)
+        pthread_cond_wait(&this->change, &this->mutex);
+
+    FUNCTION_TEST_RETURN(this->shutdown ? NULL : pool->bufferList[--pool->bufferTotal]);
+}
+
+/***********************************************************************************************************************************
+Return a buffer to its pool. The mutex must be held.
+***********************************************************************************************************************************/
+static void
+ioFilterGroupThreadRelease(IoFilterGroupThread *this, Buffer *buffer, unsigned int poolIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+        FUNCTION_TEST_PARAM(UINT, poolIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL);
+
+    IoFilterGroupThreadPool *pool = &this->poolList[poolIdx];
+    ASSERT(pool->bufferTotal < IO_FILTER_GROUP_THREAD_BUFFER);
+
+    bufUsedZero(buffer);
+    pool->bufferList[pool->bufferTotal++] = buffer;
+    pthread_cond_broadcast(&this->change);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Apply a filter to the buffers in its input queue until there is no more input
+***********************************************************************************************************************************/
+static void
+ioFilterGroupThreadStage(IoFilterGroupThreadStage *stage)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, stage);
+    FUNCTION_TEST_END();
+
+    ASSERT(stage != NULL);
+
+    IoFilterGroupThread *this = stage->thread;
+    const unsigned int outputIdx = stage->stageIdx + 1;
+    Buffer *output = NULL;
+    bool shutdown = false;
+    bool end = false;
+
+    do
+    {
+        IoFilterGroupThreadEntry input;
+
+        pthread_mutex_lock(&this->mutex);
+        shutdown = !ioFilterGroupThreadGet(this, stage->stageIdx, &input);
+        pthread_mutex_unlock(&this->mutex);
+
+        if (shutdown)
+            break;
+
+        end = input.buffer == NULL;
+
+        // If the filter produces output then process until the input is consumed or, when flushing, until the filter is done
+        if (ioFilterOutput(stage->filter))
+        {
+            do
+            {
+                if (output == NULL)
+                {
+                    pthread_mutex_lock(&this->mutex);
+                    output = ioFilterGroupThreadBuffer(this, outputIdx);
+                    pthread_mutex_unlock(&this->mutex);
+
+                    shutdown = output == NULL;
+
+                    if (shutdown)
+                        break;
+                }
+
+                ioFilterProcessInOut(stage->filter, input.buffer, output);
+
+                // Pass full buffers on to the next stage, and the last buffer when the filter is done
+                if (bufFull(output) || (ioFilterDone(stage->filter) && bufUsed(output) > 0))
+                {
+                    pthread_mutex_lock(&this->mutex);
+                    ioFilterGroupThreadPut(this, outputIdx, output, outputIdx);
+                    pthread_mutex_unlock(&this->mutex);
+
+                    output = NULL;
+                }
+            }
+            while (end ? !ioFilterDone(stage->filter) : ioFilterInputSame(stage->filter));
+
+            if (!shutdown)
+            {
+                pthread_mutex_lock(&this->mutex);
+
+                // Return the input buffer to its pool now that the filter is done with it
+                if (!end)
+                    ioFilterGroupThreadRelease(this, input.buffer, input.poolIdx);
+                // Else tell the next stage there is no more input
+                else
+                {
+                    if (output != NULL)
+                        ioFilterGroupThreadRelease(this, output, outputIdx);
+
+                    ioFilterGroupThreadPut(this, outputIdx, NULL, 0);
+                }
+
+                pthread_mutex_unlock(&this->mutex);
+            }
+        }
+        // Else pass the input on to the next stage after processing
+        else
+        {
+            ioFilterProcessIn(stage->filter, input.buffer);
+
+            pthread_mutex_lock(&this->mutex);
+            ioFilterGroupThreadPut(this, outputIdx, input.buffer, input.poolIdx);
+            pthread_mutex_unlock(&this->mutex);
+        }
+    }
+    while (!end && !shutdown);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Filter thread. Errors are passed back to be thrown by the caller and stop the other threads.
+***********************************************************************************************************************************/
+static void *
+ioFilterGroupThreadMain(void *param)
+{
+    IoFilterGroupThreadStage *stage = param;
+    IoFilterGroupThread *this = stage->thread;
+
+    TRY_BEGIN()
+    {
+        ioFilterGroupThreadStage(stage);
+    }
+    CATCH_ANY()
+    {
+        pthread_mutex_lock(&this->mutex);
+
+        if (this->errorType == NULL)
+        {
+            this->errorType = errorType();
+            strncpy(this->errorMessage, errorMessage(), sizeof(this->errorMessage) - 1);
+        }
+
+        this->shutdown = true;
+        pthread_cond_broadcast(&this->change);
+        pthread_mutex_unlock(&this->mutex);
+    }
+    TRY_END();
+
+    // Free memory allocated by filters in this thread
+    memContextFree(memContextTop());
+
+    return NULL;
+}
+
+/***********************************************************************************************************************************
+Allocate stages, queues, and buffers and start a thread for each filter
+***********************************************************************************************************************************/
+static void
+ioFilterGroupThreadStart(IoFilterGroupThread *this, const List *filterList, unsigned int filterTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP_THREAD, this);
+        FUNCTION_TEST_PARAM(LIST, filterList);
+        FUNCTION_TEST_PARAM(UINT, filterTotal);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(filterList != NULL);
+    ASSERT(filterTotal > 0);
+
+    // Each queue can hold at most every buffer plus the end of input
+    this->stageTotal = filterTotal;
+    this->queueMax = (filterTotal + 1) * IO_FILTER_GROUP_THREAD_BUFFER + 1;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->stageList = memNew(sizeof(IoFilterGroupThreadStage) * filterTotal);
+        this->queueList = memNew(sizeof(IoFilterGroupThreadQueue) * (filterTotal + 1));
+        this->poolList = memNew(sizeof(IoFilterGroupThreadPool) * (filterTotal + 1));
+        this->threadList = memNew(sizeof(pthread_t) * filterTotal);
+
+        for (unsigned int queueIdx = 0; queueIdx <= filterTotal; queueIdx++)
+            this->queueList[queueIdx].entryList = memNew(sizeof(IoFilterGroupThreadEntry) * this->queueMax);
+    }
+    MEM_CONTEXT_END();
+
+    // Buffers are allocated in the calling context so they are freed after the threads have stopped. The caller fills the first
+    // pool and each filter that produces output fills the pool after its stage.
+    for (unsigned int poolIdx = 0; poolIdx <= filterTotal; poolIdx++)
+    {
+        if (poolIdx == 0 || ioFilterOutput(((IoFilterData *)lstGet(filterList, poolIdx - 1))->filter))
+        {
+            for (unsigned int bufferIdx = 0; bufferIdx < IO_FILTER_GROUP_THREAD_BUFFER; bufferIdx++)
+                this->poolList[poolIdx].bufferList[bufferIdx] = bufNew(ioBufferSize());
+
+            this->poolList[poolIdx].bufferTotal = IO_FILTER_GROUP_THREAD_BUFFER;
+        }
+    }
+
+    // Start a thread for each filter
+    for (unsigned int stageIdx = 0; stageIdx < filterTotal; stageIdx++)
+    {
+        this->stageList[stageIdx] = (IoFilterGroupThreadStage)
+        {
+            .thread = this,
+            .filter = ((IoFilterData *)lstGet(filterList, stageIdx))->filter,
+            .stageIdx = stageIdx,
+        };
+
+        errno = pthread_create(&this->threadList[stageIdx], NULL, ioFilterGroupThreadMain, &this->stageList[stageIdx]);
+        THROW_ON_SYS_ERROR(errno != 0, KernelError, "unable to create filter thread");
+
+        this->threadTotal++;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 New Object
 ***********************************************************************************************************************************/
@@ -71,6 +523,10 @@ ioFilterGroupNew(void)
         this->memContext = memContextCurrent();
         this->done = false;
         this->filterList = lstNew(sizeof(IoFilterData));
+
+        // Create filter threads when enabled. This must happen before filters are added.
+        if (ioFilterThread())
+            this->thread = ioFilterGroupThreadNew();
     }
     MEM_CONTEXT_NEW_END();
 
@@ -180,18 +636,46 @@ ioFilterGroupOpen(IoFilterGroup *this)
 
     MEM_CONTEXT_BEGIN(this->memContext)
     {
+        // Filters added by the user
+        unsigned int filterTotal = ioFilterGroupSize(this);
+
         // If the last filter is not an output filter then add a filter to buffer/copy data.  Input filters won't copy to an output
         // buffer so we need some way to get the data to the output buffer.
         if (ioFilterGroupSize(this) == 0 ||
             !ioFilterOutput((ioFilterGroupGet(this, ioFilterGroupSize(this) - 1))->filter))
         {
             ioFilterGroupAdd(this, ioBufferNew());
+            this->filterBuffer = true;
+        }
+
+        // Start a thread for each filter added by the user. The buffer filter is not needed since output from the last thread is
+        // copied to the caller's buffer. If there are no filters then there is nothing to gain from threads.
+        if (this->thread != NULL)
+        {
+            if (filterTotal > 0)
+                ioFilterGroupThreadStart(this->thread, this->filterList, filterTotal);
+            else
+            {
+                memContextFree(this->thread->memContext);
+                this->thread = NULL;
+            }
+        }
+
+        // If no filter added by the user produces output then the data is the same on the way out as on the way in. The caller may
+        // process it in place rather than having the buffer filter copy it. This does not apply to threads since the caller's
+        // buffer could be reused before the threads are done with it.
+        this->inPlace = this->thread == NULL;
+
+        for (unsigned int filterIdx = 0; filterIdx < filterTotal; filterIdx++)
+        {
+            if (ioFilterOutput(ioFilterGroupGet(this, filterIdx)->filter))
+                this->inPlace = false;
         }
 
         // Create filter input/output buffers.  Input filters do not get an output buffer since they don't produce output.
         Buffer **lastOutputBuffer = NULL;
 
-        for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this); filterIdx++)
+        for (unsigned int filterIdx = 0; this->thread == NULL && filterIdx < ioFilterGroupSize(this); filterIdx++)
         {
             IoFilterData *filterData = ioFilterGroupGet(this, filterIdx);
 
@@ -230,29 +714,19 @@ ioFilterGroupOpen(IoFilterGroup *this)
 }
 
 /***********************************************************************************************************************************
-Process filters
+Process filters serially
 ***********************************************************************************************************************************/
-void
-ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output)
+static void
+ioFilterGroupProcessSerial(IoFilterGroup *this, const Buffer *input, Buffer *output)
 {
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, this);
-        FUNCTION_LOG_PARAM(BUFFER, input);
-        FUNCTION_LOG_PARAM(BUFFER, output);
-    FUNCTION_LOG_END();
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_TEST_PARAM(BUFFER, input);
+        FUNCTION_TEST_PARAM(BUFFER, output);
+    FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
-    ASSERT(this->opened && !this->closed);
-    ASSERT(input == NULL || bufUsed(input) > 0);
-    ASSERT(!this->flushing || input == NULL);
     ASSERT(output != NULL);
-    ASSERT(bufRemains(output) > 0);
-
-    // Once input goes to NULL then flushing has started
-#ifdef DEBUG
-    if (input == NULL)
-        this->flushing = true;
-#endif
 
     // Assign input and output buffers
     this->input = input;
@@ -354,9 +828,216 @@ ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output)
             this->done = false;
     }
 
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Process filters in place
+
+Every filter except the buffer filter is an input filter so the input can be processed without being copied to an output buffer.
+***********************************************************************************************************************************/
+static void
+ioFilterGroupProcessInPlace(IoFilterGroup *this, const Buffer *input)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_TEST_PARAM(BUFFER, input);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->inPlace && !this->inputSame);
+    ASSERT(input != NULL);
+
+    for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this) - 1; filterIdx++)
+        ioFilterProcessIn((ioFilterGroupGet(this, filterIdx))->filter, input);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Process filters in threads
+
+Queue the input for the first filter and copy any output from the last filter. When all the input buffers are in use wait until one
+is free, unless the output buffer is full in which case the same input is required again. When flushing wait until the output buffer
+is full or the last filter is done.
+***********************************************************************************************************************************/
+static void
+ioFilterGroupProcessThread(IoFilterGroup *this, const Buffer *input, Buffer *output)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_TEST_PARAM(BUFFER, input);
+        FUNCTION_TEST_PARAM(BUFFER, output);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->thread != NULL);
+    ASSERT(output != NULL);
+
+    IoFilterGroupThread *thread = this->thread;
+    IoFilterGroupThreadQueue *queue = &thread->queueList[thread->stageTotal];
+    IoFilterGroupThreadPool *pool = &thread->poolList[0];
+
+    this->inputSame = false;
+
+    pthread_mutex_lock(&thread->mutex);
+
+    while (true)
+    {
+        // Copy output from the last filter
+        while (queue->entryTotal > 0 && !bufFull(output))
+        {
+            IoFilterGroupThreadEntry *entry = &queue->entryList[queue->entryHead];
+
+            if (entry->buffer != NULL)
+            {
+                size_t copySize = bufUsed(entry->buffer) - thread->outputOffset;
+
+                if (copySize > bufRemains(output))
+                    copySize = bufRemains(output);
+
+                bufCatSub(output, entry->buffer, thread->outputOffset, copySize);
+                thread->outputOffset += copySize;
+
+                if (thread->outputOffset < bufUsed(entry->buffer))
+                    break;
+
+                ioFilterGroupThreadRelease(thread, entry->buffer, entry->poolIdx);
+                thread->outputOffset = 0;
+            }
+            else
+                thread->outputEnd = true;
+
+            queue->entryHead = (queue->entryHead + 1) % thread->queueMax;
+            queue->entryTotal--;
+        }
+
+        // Stop on error
+        if (thread->errorType != NULL)
+            break;
+
+        if (input != NULL)
+        {
+            // Queue the input when a buffer is free. The copy is done without the lock so the threads are not held up.
+            if (pool->bufferTotal > 0)
+            {
+                Buffer *buffer = pool->bufferList[--pool->bufferTotal];
+                pthread_mutex_unlock(&thread->mutex);
+
+                if (bufUsed(input) > bufSize(buffer))
+                    bufResize(buffer, bufUsed(input));
+
+                bufCat(buffer, input);
+
+                pthread_mutex_lock(&thread->mutex);
+                ioFilterGroupThreadPut(thread, 0, buffer, 0);
+                break;
+            }
+
+            // Else the same input is required again if the output buffer is full
+            if (bufFull(output))
+            {
+                this->inputSame = true;
+                break;
+            }
+        }
+        else
+        {
+            // Let the first filter know there is no more input
+            if (!thread->inputEnd)
+            {
+                ioFilterGroupThreadPut(thread, 0, NULL, 0);
+                thread->inputEnd = true;
+            }
+
+            if (thread->outputEnd || bufFull(output))
+                break;
+        }
+
+        pthread_cond_wait(&thread->change, &thread->mutex);
+    }
+
+    this->done = thread->outputEnd;
+    const ErrorType *errorType = thread->errorType;
+
+    pthread_mutex_unlock(&thread->mutex);
+
+    // Throw the error from the filter thread
+    if (errorType != NULL)
+        THROWP(errorType, thread->errorMessage);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Process filters
+
+If output is NULL then the input is processed in place, see ioFilterGroupInPlace().
+***********************************************************************************************************************************/
+void
+ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+        FUNCTION_LOG_PARAM(BUFFER, output);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->opened && !this->closed);
+    ASSERT(input == NULL || bufUsed(input) > 0);
+    ASSERT(!this->flushing || input == NULL);
+    ASSERT(output != NULL || (input != NULL && this->inPlace));
+    ASSERT(output == NULL || bufRemains(output) > 0);
+
+    // Once input goes to NULL then flushing has started
+#ifdef DEBUG
+    if (input == NULL)
+        this->flushing = true;
+#endif
+
+    if (output == NULL)
+        ioFilterGroupProcessInPlace(this, input);
+    else if (this->thread != NULL)
+        ioFilterGroupProcessThread(this, input, output);
+    else
+        ioFilterGroupProcessSerial(this, input, output);
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Add statistics to the IO_STAT_RESULT filter result unless statistics with the same name are already present
+***********************************************************************************************************************************/
+static void
+ioFilterGroupStatPut(IoFilterGroup *this, const String *name, const IoStat *stat)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM_P(VOID, stat);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->filterResult != NULL);
+    ASSERT(name != NULL);
+    ASSERT(stat != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *statKv = varKv(kvGet(this->filterResult, VARSTR(IO_STAT_RESULT_STR)));
+
+        if (statKv == NULL)
+            statKv = kvPutKv(this->filterResult, VARSTR(IO_STAT_RESULT_STR));
+
+        if (!kvKeyExists(statKv, VARSTR(name)))
+            kvPut(statKv, VARSTR(name), ioStatToVar(stat));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Close filter group and gather results
 ***********************************************************************************************************************************/
@@ -370,6 +1051,15 @@ ioFilterGroupClose(IoFilterGroup *this)
     ASSERT(this != NULL);
     ASSERT(this->opened && !this->closed);
 
+    // Stop filter threads before gathering results. Throw any error from a filter since results may be incomplete.
+    if (this->thread != NULL)
+    {
+        ioFilterGroupThreadStop(this->thread);
+
+        if (this->thread->errorType != NULL)
+            THROWP(this->thread->errorType, this->thread->errorMessage);
+    }
+
     for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this); filterIdx++)
     {
         IoFilterData *filterData = ioFilterGroupGet(this, filterIdx);
@@ -391,6 +1081,16 @@ ioFilterGroupClose(IoFilterGroup *this)
         MEM_CONTEXT_TEMP_END();
     }
 
+    // Add statistics for each filter. The buffer filter added by the group is not interesting so it is skipped.
+    if (ioStatEnabled())
+    {
+        for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this) - (this->filterBuffer ? 1 : 0); filterIdx++)
+        {
+            IoFilter *filter = ioFilterGroupGet(this, filterIdx)->filter;
+            ioFilterGroupStatPut(this, ioFilterType(filter), ioFilterStat(filter));
+        }
+    }
+
     // Filter group is open
 #ifdef DEBUG
     this->closed = true;
@@ -399,6 +1099,29 @@ ioFilterGroupClose(IoFilterGroup *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Add statistics after the group is closed
+
+This is used by IoRead/IoWrite to add statistics for their drivers. If the filters ran on a remote then the remote statistics for the
+driver are already present and are kept since they measure the storage rather than the protocol.
+***********************************************************************************************************************************/
+void
+ioFilterGroupStatAdd(IoFilterGroup *this, const String *name, const IoStat *stat)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, this);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM_P(VOID, stat);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->closed);
+
+    ioFilterGroupStatPut(this, name, stat);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Is the filter group done processing?
 ***********************************************************************************************************************************/
@@ -415,6 +1138,25 @@ ioFilterGroupDone(const IoFilterGroup *this)
     FUNCTION_TEST_RETURN(this->done);
 }
 
+/***********************************************************************************************************************************
+Can input be processed in place?
+
+When true the caller may pass a NULL output buffer to ioFilterGroupProcess() and make the input available to the reader/writer
+itself, e.g. by reading directly into the reader's buffer, rather than having it copied. Flushing still requires an output buffer.
+***********************************************************************************************************************************/
+bool
+ioFilterGroupInPlace(const IoFilterGroup *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_FILTER_GROUP, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->opened && !this->closed);
+
+    FUNCTION_TEST_RETURN(this->inPlace);
+}
+
 /***********************************************************************************************************************************
 Should the same input be passed again?
 
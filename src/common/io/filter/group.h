@@ -6,6 +6,9 @@ results can be gathered using ioFilterGroupResult() for any filters that produce
 
 Processing is complex and asymmetric for read/write so should be done via the IoRead and IoWrite objects.  General users need
 only call ioFilterGroupNew(), ioFilterGroupAdd(), and ioFilterGroupResult().
+
+If ioFilterThread() is enabled when the group is created then each filter runs in a separate thread once the group is opened. The
+results are the same but an error in a filter may not be thrown until a later call to ioFilterGroupProcess() or ioFilterGroupClose().
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_FILTER_GROUP_H
 #define COMMON_IO_FILTER_GROUP_H
@@ -19,6 +22,7 @@ Object type
 typedef struct IoFilterGroup IoFilterGroup;
 
 #include "common/io/filter/filter.h"
+#include "common/io/stat.h"
 #include "common/type/string.h"
 
 /***********************************************************************************************************************************
@@ -35,11 +39,13 @@ IoFilterGroup *ioFilterGroupClear(IoFilterGroup *this);
 void ioFilterGroupOpen(IoFilterGroup *this);
 void ioFilterGroupProcess(IoFilterGroup *this, const Buffer *input, Buffer *output);
 void ioFilterGroupClose(IoFilterGroup *this);
+void ioFilterGroupStatAdd(IoFilterGroup *this, const String *name, const IoStat *stat);
 
 /***********************************************************************************************************************************
 Getters
 ***********************************************************************************************************************************/
 bool ioFilterGroupDone(const IoFilterGroup *this);
+bool ioFilterGroupInPlace(const IoFilterGroup *this);
 bool ioFilterGroupInputSame(const IoFilterGroup *this);
 Variant *ioFilterGroupParamAll(const IoFilterGroup *this);
 const Variant *ioFilterGroupResult(const IoFilterGroup *this, const String *filterType);
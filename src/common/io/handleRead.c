@@ -8,6 +8,7 @@ Handle IO Read
 
 #include "common/debug.h"
 #include "common/io/handleRead.h"
+#include "common/io/io.h"
 #include "common/io/read.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
@@ -152,7 +153,9 @@ ioHandleReadNew(const String *name, int handle, TimeMSec timeout)
         driver->handle = handle;
         driver->timeout = timeout;
 
-        this = ioReadNewP(driver, .block = true, .eof = ioHandleReadEof, .handle = ioHandleReadHandle, .read = ioHandleRead);
+        this = ioReadNewP(
+            driver, .block = true, .bufferSize = IO_BUFFER_SIZE_PIPE, .eof = ioHandleReadEof, .handle = ioHandleReadHandle,
+            .read = ioHandleRead);
     }
     MEM_CONTEXT_NEW_END();
 
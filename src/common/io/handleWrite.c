@@ -7,6 +7,7 @@ Handle IO Write
 
 #include "common/debug.h"
 #include "common/io/handleWrite.h"
+#include "common/io/io.h"
 #include "common/io/write.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
@@ -88,7 +89,7 @@ ioHandleWriteNew(const String *name, int handle)
         driver->name = strDup(name);
         driver->handle = handle;
 
-        this = ioWriteNewP(driver, .handle = ioHandleWriteHandle, .write = ioHandleWrite);
+        this = ioWriteNewP(driver, .bufferSize = IO_BUFFER_SIZE_PIPE, .handle = ioHandleWriteHandle, .write = ioHandleWrite);
     }
     MEM_CONTEXT_NEW_END();
 
@@ -19,6 +19,14 @@ should set their buffer size using ioBufferSize() but there may be cases where a
 
 static size_t bufferSize = (8 * IO_BUFFER_BLOCK_SIZE);
 
+/***********************************************************************************************************************************
+Filter threads
+
+When enabled, filter groups created afterward run each filter in a separate thread.  Disabled by default and enabled after options
+have been loaded when requested by the user.
+***********************************************************************************************************************************/
+static bool filterThread = false;
+
 /***********************************************************************************************************************************
 Get/set buffer size
 ***********************************************************************************************************************************/
@@ -41,6 +49,45 @@ ioBufferSizeSet(size_t bufferSizeParam)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get the next size for a driver buffer that keeps filling up
+
+Drivers may start with a buffer smaller than ioBufferSize() when a large buffer does not help, e.g. a pipe or a TLS connection that
+returns a limited amount of data per call. When the buffer keeps filling up then more data is available than the buffer can hold, so
+the buffer is doubled to reduce the number of calls to the driver, but never beyond ioBufferSize().
+***********************************************************************************************************************************/
+size_t
+ioBufferSizeGrow(size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(size * 2 < bufferSize ? size * 2 : (size > bufferSize ? size : bufferSize));
+}
+
+/***********************************************************************************************************************************
+Get/set filter threads
+***********************************************************************************************************************************/
+bool
+ioFilterThread(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(filterThread);
+}
+
+void
+ioFilterThreadSet(bool filterThreadParam)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, filterThreadParam);
+    FUNCTION_TEST_END();
+
+    filterThread = filterThreadParam;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Read all IO into a buffer
 ***********************************************************************************************************************************/
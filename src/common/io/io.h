@@ -10,9 +10,21 @@ Common IO functions.
 
 #include <common/io/read.h>
 
+/***********************************************************************************************************************************
+Driver buffers smaller than ioBufferSize() are grown after this many consecutive reads/writes fill the buffer
+***********************************************************************************************************************************/
+#define IO_BUFFER_GROW_FULL                                         2
+
+/***********************************************************************************************************************************
+Initial buffer size for pipes, which is the default pipe capacity on Linux. Larger buffers do not help unless the other end of the
+pipe keeps up, in which case the buffer will grow.
+***********************************************************************************************************************************/
+#define IO_BUFFER_SIZE_PIPE                                         (64 * 1024)
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+size_t ioBufferSizeGrow(size_t size);
 Buffer *ioReadBuf(IoRead *read);
 bool ioReadDrain(IoRead *read);
 
@@ -21,5 +33,7 @@ Getters/Setters
 ***********************************************************************************************************************************/
 size_t ioBufferSize(void);
 void ioBufferSizeSet(size_t bufferSize);
+bool ioFilterThread(void);
+void ioFilterThreadSet(bool filterThread);
 
 #endif
@@ -8,6 +8,7 @@ IO Read Interface
 #include "common/debug.h"
 #include "common/io/io.h"
 #include "common/io/read.intern.h"
+#include "common/io/stat.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
@@ -22,9 +23,11 @@ struct IoRead
     IoReadInterface interface;                                      // Driver interface
     IoFilterGroup *filterGroup;                                     // IO filters
     Buffer *input;                                                  // Input buffer
+    unsigned int inputFullTotal;                                    // Consecutive driver reads that filled the input buffer
     Buffer *output;                                                 // Output buffer (holds extra data from line read)
 
     bool eofAll;                                                    // Is the read done (read and filters complete)?
+    IoStat stat;                                                    // Driver statistics (when enabled)
 
 #ifdef DEBUG
     bool opened;                                                    // Has the io been opened?
@@ -57,7 +60,8 @@ ioReadNew(void *driver, IoReadInterface interface)
         this->driver = driver;
         this->interface = interface;
         this->filterGroup = ioFilterGroupNew();
-        this->input = bufNew(ioBufferSize());
+        this->input = bufNew(
+            interface.bufferSize == 0 || interface.bufferSize > ioBufferSize() ? ioBufferSize() : interface.bufferSize);
     }
     MEM_CONTEXT_NEW_END();
 
@@ -110,6 +114,27 @@ ioReadEofDriver(const IoRead *this)
     FUNCTION_LOG_RETURN(BOOL, this->interface.eof != NULL ? this->interface.eof(this->driver) : false);
 }
 
+/***********************************************************************************************************************************
+Read data from the driver and gather statistics (see ioReadStat())
+***********************************************************************************************************************************/
+static void
+ioReadDriverRead(IoRead *this, Buffer *buffer, bool block)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+        FUNCTION_TEST_PARAM(BOOL, block);
+    FUNCTION_TEST_END();
+
+    IoStatTime statBegin = ioStatBegin();
+    size_t bufferBegin = bufUsed(buffer);
+
+    this->interface.read(this->driver, buffer, block);
+    ioStatEnd(&this->stat, statBegin, bufUsed(buffer) - bufferBegin, 0);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Read data from IO and process filters
 ***********************************************************************************************************************************/
@@ -142,14 +167,47 @@ ioReadInternal(IoRead *this, Buffer *buffer, bool block)
             // Read if not EOF
             if (!ioReadEofDriver(this))
             {
-                bufUsedZero(this->input);
+                // If the filters can process the input in place then read directly into the remaining space in the caller's buffer
+                // rather than copying it there later. A separate buffer object is passed to the driver so any limit the driver sets
+                // and then clears does not disturb a limit set by the caller.
+                if (ioFilterGroupInPlace(this->filterGroup))
+                {
+                    Buffer *input = bufNewUseC(bufRemainsPtr(buffer), bufRemains(buffer));
 
-                // If blocking then limit the amount of data requested
-                if (ioReadBlock(this) && bufRemains(this->input) > bufRemains(buffer))
-                    bufLimitSet(this->input, bufRemains(buffer));
+                    ioReadDriverRead(this, input, block);
+                    bufUsedInc(buffer, bufUsed(input));
 
-                this->interface.read(this->driver, this->input, block);
-                bufLimitClear(this->input);
+                    if (bufUsed(input) > 0)
+                        ioFilterGroupProcess(this->filterGroup, input, NULL);
+
+                    bufFree(input);
+                }
+                else
+                {
+                    bufUsedZero(this->input);
+
+                    // If blocking then limit the amount of data requested
+                    bool limit = ioReadBlock(this) && bufRemains(this->input) > bufRemains(buffer);
+
+                    if (limit)
+                        bufLimitSet(this->input, bufRemains(buffer));
+
+                    ioReadDriverRead(this, this->input, block);
+                    bufLimitClear(this->input);
+
+                    // Grow the input buffer when the driver keeps filling it. A limited read does not count since the buffer was
+                    // not the constraint.
+                    if (!limit && bufFull(this->input))
+                    {
+                        if (++this->inputFullTotal >= IO_BUFFER_GROW_FULL)
+                        {
+                            bufResize(this->input, ioBufferSizeGrow(bufSize(this->input)));
+                            this->inputFullTotal = 0;
+                        }
+                    }
+                    else
+                        this->inputFullTotal = 0;
+                }
             }
             // Set input to NULL and flush (no need to actually free the buffer here as it will be freed with the mem context)
             else
@@ -168,6 +226,9 @@ ioReadInternal(IoRead *this, Buffer *buffer, bool block)
         this->eofAll = ioReadEofDriver(this) && ioFilterGroupDone(this->filterGroup);
     }
 
+    // Output is the data returned to the caller after filtering
+    this->stat.sizeOut += bufUsed(buffer) - bufferUsedBegin;
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -317,6 +378,13 @@ ioReadClose(IoRead *this)
     if (this->interface.close != NULL)
         this->interface.close(this->driver);
 
+    // Add driver statistics to the filter results and add all statistics to the totals for the process
+    if (ioStatEnabled())
+    {
+        ioFilterGroupStatAdd(this->filterGroup, IO_STAT_READ_STR, &this->stat);
+        ioStatTotalAdd(ioFilterGroupResult(this->filterGroup, IO_STAT_RESULT_STR));
+    }
+
 #ifdef DEBUG
     this->closed = true;
 #endif
@@ -404,6 +472,24 @@ ioReadHandle(const IoRead *this)
     FUNCTION_LOG_RETURN(INT, this->interface.handle == NULL ? -1 : this->interface.handle(this->driver));
 }
 
+/***********************************************************************************************************************************
+Driver statistics
+
+Wall time and bytes are always gathered so the time spent waiting on the driver is available, e.g. to compare storage throughput
+with compression throughput. CPU time is only gathered when ioStatEnabled() is true.
+***********************************************************************************************************************************/
+const IoStat *
+ioReadStat(const IoRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(&this->stat);
+}
+
 /***********************************************************************************************************************************
 Interface for the read object
 ***********************************************************************************************************************************/
@@ -18,6 +18,7 @@ Object type
 typedef struct IoRead IoRead;
 
 #include "common/io/filter/group.h"
+#include "common/io/stat.h"
 #include "common/type/buffer.h"
 
 /***********************************************************************************************************************************
@@ -36,6 +37,7 @@ bool ioReadBlock(const IoRead *this);
 bool ioReadEof(const IoRead *this);
 IoFilterGroup *ioReadFilterGroup(const IoRead *this);
 int ioReadHandle(const IoRead *this);
+const IoStat *ioReadStat(const IoRead *this);
 
 /***********************************************************************************************************************************
 Destructor
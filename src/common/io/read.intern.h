@@ -15,6 +15,7 @@ Constructor
 typedef struct IoReadInterface
 {
     bool block;                                               // Do reads block when buffer is larger than available bytes?
+    size_t bufferSize;                                        // Initial input buffer size (defaults to ioBufferSize())
 
     bool (*eof)(void *driver);
     void (*close)(void *driver);
@@ -0,0 +1,264 @@
+/***********************************************************************************************************************************
+IO Statistics
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <time.h>
+
+#include "common/debug.h"
+#include "common/io/stat.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/keyValue.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+STRING_EXTERN(IO_STAT_RESULT_STR,                                   IO_STAT_RESULT);
+STRING_EXTERN(IO_STAT_READ_STR,                                     IO_STAT_READ);
+STRING_EXTERN(IO_STAT_WRITE_STR,                                    IO_STAT_WRITE);
+
+VARIANT_STRDEF_STATIC(IO_STAT_KEY_CPU_VAR,                          "cpu");
+VARIANT_STRDEF_STATIC(IO_STAT_KEY_WALL_VAR,                         "wall");
+VARIANT_STRDEF_STATIC(IO_STAT_KEY_IN_VAR,                           "in");
+VARIANT_STRDEF_STATIC(IO_STAT_KEY_OUT_VAR,                          "out");
+
+/***********************************************************************************************************************************
+Are statistics enabled?
+
+Disabled by default and enabled after options have been loaded when requested by the user.
+***********************************************************************************************************************************/
+static bool statEnabled = false;
+
+/***********************************************************************************************************************************
+Totals for the process
+
+Statistics are added when a filter group is closed.  Filter groups are only closed by the thread that owns them so no locking is
+required.
+***********************************************************************************************************************************/
+static struct
+{
+    MemContext *memContext;                                         // Mem context for totals
+    KeyValue *total;                                                // Totals by statistic name
+} ioStatLocal;
+
+/***********************************************************************************************************************************
+Get/set statistics enabled
+***********************************************************************************************************************************/
+bool
+ioStatEnabled(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(statEnabled);
+}
+
+void
+ioStatEnabledSet(bool enabled)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, enabled);
+    FUNCTION_TEST_END();
+
+    statEnabled = enabled;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get a clock in microseconds
+***********************************************************************************************************************************/
+static uint64_t
+ioStatClock(clockid_t clockId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, clockId);
+    FUNCTION_TEST_END();
+
+    struct timespec time;
+    clock_gettime(clockId, &time);
+
+    FUNCTION_TEST_RETURN((uint64_t)time.tv_sec * 1000000 + (uint64_t)time.tv_nsec / 1000);
+}
+
+/***********************************************************************************************************************************
+Get the time at the beginning of an operation
+
+CPU time is measured for the calling thread so filters running in separate threads (see ioFilterThread()) are measured correctly.
+CPU time is only measured when statistics are enabled since reading the thread CPU clock is a system call.
+***********************************************************************************************************************************/
+IoStatTime
+ioStatBegin(void)
+{
+    FUNCTION_TEST_VOID();
+
+    IoStatTime result =
+    {
+        .timeCpu = statEnabled ? ioStatClock(CLOCK_THREAD_CPUTIME_ID) : 0,
+        .timeWall = ioStatClock(CLOCK_MONOTONIC),
+    };
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Add the time since begin and the bytes in/out to the statistics
+***********************************************************************************************************************************/
+void
+ioStatEnd(IoStat *this, IoStatTime begin, uint64_t sizeIn, uint64_t sizeOut)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, this);
+        FUNCTION_TEST_PARAM(UINT64, sizeIn);
+        FUNCTION_TEST_PARAM(UINT64, sizeOut);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    if (statEnabled)
+        this->timeCpu += ioStatClock(CLOCK_THREAD_CPUTIME_ID) - begin.timeCpu;
+
+    this->timeWall += ioStatClock(CLOCK_MONOTONIC) - begin.timeWall;
+    this->sizeIn += sizeIn;
+    this->sizeOut += sizeOut;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Add statistics for a filter group to the totals for the process
+
+The statistics are a key/value of statistic name to statistic as stored in the IO_STAT_RESULT filter result.  Statistics with the
+same name are summed, e.g. all gzCompress filters used by the command.
+***********************************************************************************************************************************/
+void
+ioStatTotalAdd(const Variant *statAll)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(VARIANT, statAll);
+    FUNCTION_LOG_END();
+
+    if (statAll != NULL)
+    {
+        if (ioStatLocal.memContext == NULL)
+        {
+            MEM_CONTEXT_BEGIN(memContextTop())
+            {
+                MEM_CONTEXT_NEW_BEGIN("IoStat")
+                {
+                    ioStatLocal.memContext = MEM_CONTEXT_NEW();
+                    ioStatLocal.total = kvNew();
+                }
+                MEM_CONTEXT_NEW_END();
+            }
+            MEM_CONTEXT_END();
+        }
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const KeyValue *statKv = varKv(statAll);
+            const VariantList *nameList = kvKeyList(statKv);
+
+            for (unsigned int nameIdx = 0; nameIdx < varLstSize(nameList); nameIdx++)
+            {
+                const Variant *name = varLstGet(nameList, nameIdx);
+                const KeyValue *stat = varKv(kvGet(statKv, name));
+                const KeyValue *total = varKv(kvGet(ioStatLocal.total, name));
+
+                IoStat statSum =
+                {
+                    .timeCpu = varUInt64Force(kvGet(stat, IO_STAT_KEY_CPU_VAR)),
+                    .timeWall = varUInt64Force(kvGet(stat, IO_STAT_KEY_WALL_VAR)),
+                    .sizeIn = varUInt64Force(kvGet(stat, IO_STAT_KEY_IN_VAR)),
+                    .sizeOut = varUInt64Force(kvGet(stat, IO_STAT_KEY_OUT_VAR)),
+                };
+
+                if (total != NULL)
+                {
+                    statSum.timeCpu += varUInt64Force(kvGet(total, IO_STAT_KEY_CPU_VAR));
+                    statSum.timeWall += varUInt64Force(kvGet(total, IO_STAT_KEY_WALL_VAR));
+                    statSum.sizeIn += varUInt64Force(kvGet(total, IO_STAT_KEY_IN_VAR));
+                    statSum.sizeOut += varUInt64Force(kvGet(total, IO_STAT_KEY_OUT_VAR));
+                }
+
+                kvPut(ioStatLocal.total, name, ioStatToVar(&statSum));
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Log the totals for the process and reset them
+
+One line is logged per statistic in the order the statistics were first seen, which is usually the order of the filters.
+***********************************************************************************************************************************/
+void
+ioStatTotalLog(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    if (ioStatLocal.memContext != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const VariantList *nameList = kvKeyList(ioStatLocal.total);
+
+            for (unsigned int nameIdx = 0; nameIdx < varLstSize(nameList); nameIdx++)
+            {
+                const Variant *name = varLstGet(nameList, nameIdx);
+                const KeyValue *stat = varKv(kvGet(ioStatLocal.total, name));
+
+                LOG_INFO(
+                    "filter stat %s: cpu %.3lfs, wall %.3lfs, in %s, out %s", strPtr(varStr(name)),
+                    (double)varUInt64(kvGet(stat, IO_STAT_KEY_CPU_VAR)) / 1000000,
+                    (double)varUInt64(kvGet(stat, IO_STAT_KEY_WALL_VAR)) / 1000000,
+                    strPtr(strSizeFormat(varUInt64(kvGet(stat, IO_STAT_KEY_IN_VAR)))),
+                    strPtr(strSizeFormat(varUInt64(kvGet(stat, IO_STAT_KEY_OUT_VAR)))));
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        memContextFree(ioStatLocal.memContext);
+        ioStatLocal.memContext = NULL;
+        ioStatLocal.total = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Totals for the process
+
+NULL when no statistics have been added.  This is used to return the totals of a local process to the main process.
+***********************************************************************************************************************************/
+const Variant *
+ioStatTotal(void)
+{
+    FUNCTION_TEST_VOID();
+
+    FUNCTION_TEST_RETURN(ioStatLocal.total == NULL ? NULL : varNewKv(kvDup(ioStatLocal.total)));
+}
+
+/***********************************************************************************************************************************
+Convert statistics to a variant so they can be stored in filter results and passed between processes
+***********************************************************************************************************************************/
+Variant *
+ioStatToVar(const IoStat *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    KeyValue *result = kvNew();
+
+    kvPut(result, IO_STAT_KEY_CPU_VAR, VARUINT64(this->timeCpu));
+    kvPut(result, IO_STAT_KEY_WALL_VAR, VARUINT64(this->timeWall));
+    kvPut(result, IO_STAT_KEY_IN_VAR, VARUINT64(this->sizeIn));
+    kvPut(result, IO_STAT_KEY_OUT_VAR, VARUINT64(this->sizeOut));
+
+    FUNCTION_TEST_RETURN(varNewKv(result));
+}
@@ -0,0 +1,71 @@
+/***********************************************************************************************************************************
+IO Statistics
+
+When ioStatEnabled() is true each filter and each IoRead/IoWrite driver accumulates the CPU time, wall time, and bytes in/out spent
+processing. The statistics for a filter group are reported in the filter results under IO_STAT_RESULT and are also added to totals
+for the process, which are logged at the end of the command.
+
+IoRead/IoWrite drivers always accumulate wall time and bytes, which only costs a monotonic clock read per driver call, so callers
+can measure storage throughput without enabling statistics, e.g. compress-level-auto (see ioReadStat() and ioWriteStat()).
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_STAT_H
+#define COMMON_IO_STAT_H
+
+#include <stdint.h>
+
+#include "common/type/string.h"
+#include "common/type/variant.h"
+
+/***********************************************************************************************************************************
+Filter result key for the statistics of a filter group
+***********************************************************************************************************************************/
+#define IO_STAT_RESULT                                              "stat"
+    STRING_DECLARE(IO_STAT_RESULT_STR);
+
+/***********************************************************************************************************************************
+Statistic names used for the IoRead/IoWrite drivers
+***********************************************************************************************************************************/
+#define IO_STAT_READ                                                "read"
+    STRING_DECLARE(IO_STAT_READ_STR);
+#define IO_STAT_WRITE                                               "write"
+    STRING_DECLARE(IO_STAT_WRITE_STR);
+
+/***********************************************************************************************************************************
+Statistic types
+***********************************************************************************************************************************/
+typedef struct IoStat
+{
+    uint64_t timeCpu;                                               // CPU time in microseconds
+    uint64_t timeWall;                                              // Wall time in microseconds
+    uint64_t sizeIn;                                                // Bytes in
+    uint64_t sizeOut;                                               // Bytes out
+} IoStat;
+
+// Time at the beginning of an operation
+typedef struct IoStatTime
+{
+    uint64_t timeCpu;                                               // Thread CPU time in microseconds
+    uint64_t timeWall;                                              // Monotonic wall time in microseconds
+} IoStatTime;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+IoStatTime ioStatBegin(void);
+void ioStatEnd(IoStat *this, IoStatTime begin, uint64_t sizeIn, uint64_t sizeOut);
+void ioStatTotalAdd(const Variant *statAll);
+void ioStatTotalLog(void);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+bool ioStatEnabled(void);
+void ioStatEnabledSet(bool enabled);
+const Variant *ioStatTotal(void);
+
+/***********************************************************************************************************************************
+Variant conversion
+***********************************************************************************************************************************/
+Variant *ioStatToVar(const IoStat *this);
+
+#endif
@@ -33,6 +33,12 @@ TLS Client
 #include "common/type/keyValue.h"
 #include "common/wait.h"
 
+/***********************************************************************************************************************************
+Initial buffer size, which is the maximum TLS record size. SSL_read() returns at most one record per call so a larger buffer only
+helps when the connection keeps it full, in which case the buffer will grow.
+***********************************************************************************************************************************/
+#define TLS_CLIENT_BUFFER_SIZE                                      (16 * 1024)
+
 /***********************************************************************************************************************************
 Statistics
 ***********************************************************************************************************************************/
@@ -697,9 +703,10 @@ tlsClientOpen(TlsClient *this)
         MEM_CONTEXT_BEGIN(this->memContext)
         {
             // Create read and write interfaces
-            this->write = ioWriteNewP(this, .write = tlsClientWrite);
+            this->write = ioWriteNewP(this, .bufferSize = TLS_CLIENT_BUFFER_SIZE, .write = tlsClientWrite);
             ioWriteOpen(this->write);
-            this->read = ioReadNewP(this, .block = true, .eof = tlsClientEof, .read = tlsClientRead);
+            this->read = ioReadNewP(
+                this, .block = true, .bufferSize = TLS_CLIENT_BUFFER_SIZE, .eof = tlsClientEof, .read = tlsClientRead);
             ioReadOpen(this->read);
         }
         MEM_CONTEXT_END();
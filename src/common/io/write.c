@@ -7,6 +7,7 @@ IO Write Interface
 
 #include "common/debug.h"
 #include "common/io/io.h"
+#include "common/io/stat.h"
 #include "common/io/write.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
@@ -22,6 +23,8 @@ struct IoWrite
     IoWriteInterface interface;                                     // Driver interface
     IoFilterGroup *filterGroup;                                     // IO filters
     Buffer *output;                                                 // Output buffer
+    unsigned int outputFullTotal;                                   // Consecutive driver writes of a full output buffer
+    IoStat stat;                                                    // Driver statistics (when enabled)
 
 #ifdef DEBUG
     bool filterGroupSet;                                            // Were filters set?
@@ -55,7 +58,8 @@ ioWriteNew(void *driver, IoWriteInterface interface)
         this->driver = driver;
         this->interface = interface;
         this->filterGroup = ioFilterGroupNew();
-        this->output = bufNew(ioBufferSize());
+        this->output = bufNew(
+            interface.bufferSize == 0 || interface.bufferSize > ioBufferSize() ? ioBufferSize() : interface.bufferSize);
     }
     MEM_CONTEXT_NEW_END();
 
@@ -93,6 +97,25 @@ ioWriteOpen(IoWrite *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Write data to the driver and gather statistics (see ioWriteStat())
+***********************************************************************************************************************************/
+static void
+ioWriteDriverWrite(IoWrite *this, const Buffer *buffer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, this);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+    FUNCTION_TEST_END();
+
+    IoStatTime statBegin = ioStatBegin();
+
+    this->interface.write(this->driver, buffer);
+    ioStatEnd(&this->stat, statBegin, 0, bufUsed(buffer));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Write data to IO and process filters
 ***********************************************************************************************************************************/
@@ -110,18 +133,38 @@ ioWrite(IoWrite *this, const Buffer *buffer)
     // Only write if there is data to write
     if (buffer != NULL && bufUsed(buffer) > 0)
     {
-        do
-        {
-            ioFilterGroupProcess(this->filterGroup, buffer, this->output);
+        // Input is the data passed by the caller before filtering
+        this->stat.sizeIn += bufUsed(buffer);
 
-            // Write data if the buffer is full
-            if (bufRemains(this->output) == 0)
+        // If the filters can process the input in place and there is no data waiting in the output buffer then write a buffer at
+        // least as large as the output buffer directly rather than copying it. Smaller buffers are still copied so they are
+        // collected into larger writes.
+        if (ioFilterGroupInPlace(this->filterGroup) && bufUsed(this->output) == 0 && bufUsed(buffer) >= bufSize(this->output))
+        {
+            ioFilterGroupProcess(this->filterGroup, buffer, NULL);
+            ioWriteDriverWrite(this, buffer);
+        }
+        else
+        {
+            do
             {
-                this->interface.write(this->driver, this->output);
-                bufUsedZero(this->output);
+                ioFilterGroupProcess(this->filterGroup, buffer, this->output);
+
+                // Write data if the buffer is full and grow the buffer when it keeps filling up
+                if (bufRemains(this->output) == 0)
+                {
+                    ioWriteDriverWrite(this, this->output);
+                    bufUsedZero(this->output);
+
+                    if (++this->outputFullTotal >= IO_BUFFER_GROW_FULL)
+                    {
+                        bufResize(this->output, ioBufferSizeGrow(bufSize(this->output)));
+                        this->outputFullTotal = 0;
+                    }
+                }
             }
+            while (ioFilterGroupInputSame(this->filterGroup));
         }
-        while (ioFilterGroupInputSame(this->filterGroup));
     }
 
     FUNCTION_LOG_RETURN_VOID();
@@ -204,8 +247,9 @@ ioWriteFlush(IoWrite *this)
 
     if (bufUsed(this->output) > 0)
     {
-        this->interface.write(this->driver, this->output);
+        ioWriteDriverWrite(this, this->output);
         bufUsedZero(this->output);
+        this->outputFullTotal = 0;
     }
 
     FUNCTION_LOG_RETURN_VOID();
@@ -232,7 +276,7 @@ ioWriteClose(IoWrite *this)
         // Write data if the buffer is full or if this is the last buffer to be written
         if (bufRemains(this->output) == 0 || (ioFilterGroupDone(this->filterGroup) && bufUsed(this->output) > 0))
         {
-            this->interface.write(this->driver, this->output);
+            ioWriteDriverWrite(this, this->output);
             bufUsedZero(this->output);
         }
     }
@@ -241,9 +285,23 @@ ioWriteClose(IoWrite *this)
     // Close the filter group and gather results
     ioFilterGroupClose(this->filterGroup);
 
-    // Close the driver if there is a close function
+    // Close the driver if there is a close function. This is timed with the writes since a driver may wait here for data to be
+    // synced or acknowledged by a remote.
     if (this->interface.close != NULL)
+    {
+        IoStatTime statBegin = ioStatBegin();
+
         this->interface.close(this->driver);
+        ioStatEnd(&this->stat, statBegin, 0, 0);
+    }
+
+    // Add driver statistics to the filter results and add all statistics to the totals for the process. This is done after the
+    // driver is closed since a remote driver sets the filter results on close.
+    if (ioStatEnabled())
+    {
+        ioFilterGroupStatAdd(this->filterGroup, IO_STAT_WRITE_STR, &this->stat);
+        ioStatTotalAdd(ioFilterGroupResult(this->filterGroup, IO_STAT_RESULT_STR));
+    }
 
 #ifdef DEBUG
     this->closed = true;
@@ -301,6 +359,24 @@ ioWriteHandle(const IoWrite *this)
     FUNCTION_LOG_RETURN(INT, this->interface.handle == NULL ? -1 : this->interface.handle(this->driver));
 }
 
+/***********************************************************************************************************************************
+Driver statistics
+
+Wall time and bytes are always gathered so the time spent waiting on the driver is available, e.g. to compare storage throughput
+with compression throughput. CPU time is only gathered when ioStatEnabled() is true.
+***********************************************************************************************************************************/
+const IoStat *
+ioWriteStat(const IoWrite *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(&this->stat);
+}
+
 /***********************************************************************************************************************************
 Interface for the write object
 ***********************************************************************************************************************************/
@@ -17,6 +17,7 @@ Object type
 typedef struct IoWrite IoWrite;
 
 #include "common/io/filter/group.h"
+#include "common/io/stat.h"
 #include "common/type/buffer.h"
 
 /***********************************************************************************************************************************
@@ -35,6 +36,7 @@ Getters/Setters
 ***********************************************************************************************************************************/
 IoFilterGroup *ioWriteFilterGroup(const IoWrite *this);
 int ioWriteHandle(const IoWrite *this);
+const IoStat *ioWriteStat(const IoWrite *this);
 
 /***********************************************************************************************************************************
 Destructor
@@ -11,6 +11,8 @@ Constructor
 ***********************************************************************************************************************************/
 typedef struct IoWriteInterface
 {
+    size_t bufferSize;                                        // Initial output buffer size (defaults to ioBufferSize())
+
     void (*close)(void *driver);
     int (*handle)(const void *driver);
     void (*open)(void *driver);
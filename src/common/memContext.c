@@ -53,15 +53,29 @@ Top context
 
 The top context always exists and can never be freed.  All other contexts are children of the top context. The top context is
 generally used to allocate memory that exists for the life of the program.
+
+Each thread has its own top context so threads never share contexts.
 ***********************************************************************************************************************************/
-MemContext contextTop = {.state = memContextStateActive, .name = "TOP"};
+__thread MemContext contextTop = {.state = memContextStateActive, .name = "TOP"};
 
 /***********************************************************************************************************************************
 Current context
 
-All memory allocations will be done from the current context.  Initialized to top context at execution start.
+All memory allocations will be done from the current context.  Initialized to the top context of the thread on first use since the
+address of a thread-local variable is not a constant that can be used as an initializer.
 ***********************************************************************************************************************************/
-MemContext *contextCurrent = &contextTop;
+static __thread MemContext *contextCurrentThread = NULL;
+
+static inline MemContext **
+memContextCurrentThread(void)
+{
+    if (contextCurrentThread == NULL)
+        contextCurrentThread = &contextTop;
+
+    return &contextCurrentThread;
+}
+
+#define contextCurrent                                              (*memContextCurrentThread())
 
 /***********************************************************************************************************************************
 Wrapper around malloc()
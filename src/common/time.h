@@ -10,6 +10,7 @@ Time Management
 Time types
 ***********************************************************************************************************************************/
 typedef uint64_t TimeMSec;
+typedef uint64_t TimeUSec;
 
 /***********************************************************************************************************************************
 Constants describing number of sub-units in an interval
@@ -21,6 +22,7 @@ Functions
 ***********************************************************************************************************************************/
 void sleepMSec(TimeMSec sleepMSec);
 TimeMSec timeMSec(void);
+TimeUSec timeUSec(void);
 
 /***********************************************************************************************************************************
 Macros for function logging
@@ -30,4 +32,9 @@ Macros for function logging
 #define FUNCTION_LOG_TIME_MSEC_FORMAT(value, buffer, bufferSize)                                                                   \
     cvtUInt64ToZ(value, buffer, bufferSize)
 
+#define FUNCTION_LOG_TIME_USEC_TYPE                                                                                                \
+    TimeUSec
+#define FUNCTION_LOG_TIME_USEC_FORMAT(value, buffer, bufferSize)                                                                   \
+    cvtUInt64ToZ(value, buffer, bufferSize)
+
 #endif
@@ -248,6 +248,52 @@ bufHex(const Buffer *this)
     FUNCTION_TEST_RETURN(result);
 }
 
+/***********************************************************************************************************************************
+Are all the bytes in the buffer zero?
+
+The bytes are or'd together a vector at a time and checked a block of vectors at a time, so all-zero data is checked at close to
+memory speed and non-zero data is usually found in the first block. The vector type is unaligned and may alias any data.
+***********************************************************************************************************************************/
+#if defined(__GNUC__) || defined(__clang__)
+    #define BUFFER_ZERO_VECTOR
+
+    typedef uint64_t BufferZeroVector __attribute__((vector_size(16), aligned(1), may_alias));
+
+    #define BUFFER_ZERO_BLOCK_VECTORS                               4
+    #define BUFFER_ZERO_BLOCK_SIZE                                  (sizeof(BufferZeroVector) * BUFFER_ZERO_BLOCK_VECTORS)
+#endif
+
+bool
+bufZero(const Buffer *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    size_t bufferIdx = 0;
+
+#ifdef BUFFER_ZERO_VECTOR
+    for (; bufferIdx + BUFFER_ZERO_BLOCK_SIZE <= this->used; bufferIdx += BUFFER_ZERO_BLOCK_SIZE)
+    {
+        const BufferZeroVector *vector = (const BufferZeroVector *)(this->buffer + bufferIdx);
+        BufferZeroVector result = vector[0] | vector[1] | vector[2] | vector[3];
+
+        if ((result[0] | result[1]) != 0)
+            FUNCTION_TEST_RETURN(false);
+    }
+#endif
+
+    for (; bufferIdx < this->used; bufferIdx++)
+    {
+        if (this->buffer[bufferIdx] != 0)
+            FUNCTION_TEST_RETURN(false);
+    }
+
+    FUNCTION_TEST_RETURN(true);
+}
+
 /***********************************************************************************************************************************
 Resize the buffer
 ***********************************************************************************************************************************/
@@ -31,6 +31,7 @@ bool bufEq(const Buffer *this, const Buffer *compare);
 String *bufHex(const Buffer *this);
 Buffer *bufMove(Buffer *this, MemContext *parentNew);
 Buffer *bufResize(Buffer *this, size_t size);
+bool bufZero(const Buffer *this);
 
 bool bufFull(const Buffer *this);
 void bufLimitClear(Buffer *this);
@@ -67,10 +67,16 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_TIMEOUT_STR);
 #define CFGOPT_BACKUP_STANDBY                                       "backup-standby"
     STRING_DECLARE(CFGOPT_BACKUP_STANDBY_STR);
+#define CFGOPT_BLOCK_INCR                                           "block-incr"
+    STRING_DECLARE(CFGOPT_BLOCK_INCR_STR);
 #define CFGOPT_BUFFER_SIZE                                          "buffer-size"
     STRING_DECLARE(CFGOPT_BUFFER_SIZE_STR);
 #define CFGOPT_C                                                    "c"
     STRING_DECLARE(CFGOPT_C_STR);
+#define CFGOPT_CACHE_DROP                                           "cache-drop"
+    STRING_DECLARE(CFGOPT_CACHE_DROP_STR);
+#define CFGOPT_CHECKSUM_FAST                                        "checksum-fast"
+    STRING_DECLARE(CFGOPT_CHECKSUM_FAST_STR);
 #define CFGOPT_CHECKSUM_PAGE                                        "checksum-page"
     STRING_DECLARE(CFGOPT_CHECKSUM_PAGE_STR);
 #define CFGOPT_CMD_SSH                                              "cmd-ssh"
@@ -79,10 +85,18 @@ Option constants
     STRING_DECLARE(CFGOPT_COMMAND_STR);
 #define CFGOPT_COMPRESS                                             "compress"
     STRING_DECLARE(CFGOPT_COMPRESS_STR);
+#define CFGOPT_COMPRESS_DICT                                        "compress-dict"
+    STRING_DECLARE(CFGOPT_COMPRESS_DICT_STR);
 #define CFGOPT_COMPRESS_LEVEL                                       "compress-level"
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_STR);
+#define CFGOPT_COMPRESS_LEVEL_AUTO                                  "compress-level-auto"
+    STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_AUTO_STR);
 #define CFGOPT_COMPRESS_LEVEL_NETWORK                               "compress-level-network"
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_NETWORK_STR);
+#define CFGOPT_COMPRESS_THREAD                                      "compress-thread"
+    STRING_DECLARE(CFGOPT_COMPRESS_THREAD_STR);
+#define CFGOPT_COMPRESS_TYPE                                        "compress-type"
+    STRING_DECLARE(CFGOPT_COMPRESS_TYPE_STR);
 #define CFGOPT_CONFIG                                               "config"
     STRING_DECLARE(CFGOPT_CONFIG_STR);
 #define CFGOPT_CONFIG_INCLUDE_PATH                                  "config-include-path"
@@ -95,14 +109,22 @@ Option constants
     STRING_DECLARE(CFGOPT_DB_TIMEOUT_STR);
 #define CFGOPT_DELTA                                                "delta"
     STRING_DECLARE(CFGOPT_DELTA_STR);
+#define CFGOPT_DIRECT_IO                                            "direct-io"
+    STRING_DECLARE(CFGOPT_DIRECT_IO_STR);
 #define CFGOPT_EXCLUDE                                              "exclude"
     STRING_DECLARE(CFGOPT_EXCLUDE_STR);
 #define CFGOPT_FILTER                                               "filter"
     STRING_DECLARE(CFGOPT_FILTER_STR);
+#define CFGOPT_FILTER_STAT                                          "filter-stat"
+    STRING_DECLARE(CFGOPT_FILTER_STAT_STR);
+#define CFGOPT_FILTER_THREAD                                        "filter-thread"
+    STRING_DECLARE(CFGOPT_FILTER_THREAD_STR);
 #define CFGOPT_FORCE                                                "force"
     STRING_DECLARE(CFGOPT_FORCE_STR);
 #define CFGOPT_HOST_ID                                              "host-id"
     STRING_DECLARE(CFGOPT_HOST_ID_STR);
+#define CFGOPT_IO_QUEUE_DEPTH                                       "io-queue-depth"
+    STRING_DECLARE(CFGOPT_IO_QUEUE_DEPTH_STR);
 #define CFGOPT_LINK_ALL                                             "link-all"
     STRING_DECLARE(CFGOPT_LINK_ALL_STR);
 #define CFGOPT_LINK_MAP                                             "link-map"
@@ -389,8 +411,10 @@ Option constants
     STRING_DECLARE(CFGOPT_TEST_POINT_STR);
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
+#define CFGOPT_ZERO_ELIDE                                           "zero-elide"
+    STRING_DECLARE(CFGOPT_ZERO_ELIDE_STR);
 
-#define CFG_OPTION_TOTAL                                            168
+#define CFG_OPTION_TOTAL                                            180
 
 /***********************************************************************************************************************************
 Command enum
@@ -431,24 +455,35 @@ typedef enum
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
     cfgOptBackupStandby,
+    cfgOptBlockIncr,
     cfgOptBufferSize,
     cfgOptC,
+    cfgOptCacheDrop,
+    cfgOptChecksumFast,
     cfgOptChecksumPage,
     cfgOptCmdSsh,
     cfgOptCommand,
     cfgOptCompress,
+    cfgOptCompressDict,
     cfgOptCompressLevel,
+    cfgOptCompressLevelAuto,
     cfgOptCompressLevelNetwork,
+    cfgOptCompressThread,
+    cfgOptCompressType,
     cfgOptConfig,
     cfgOptConfigIncludePath,
     cfgOptConfigPath,
     cfgOptDbInclude,
     cfgOptDbTimeout,
     cfgOptDelta,
+    cfgOptDirectIo,
     cfgOptExclude,
     cfgOptFilter,
+    cfgOptFilterStat,
+    cfgOptFilterThread,
     cfgOptForce,
     cfgOptHostId,
+    cfgOptIoQueueDepth,
     cfgOptLinkAll,
     cfgOptLinkMap,
     cfgOptLockPath,
@@ -592,6 +627,7 @@ typedef enum
     cfgOptTestDelay,
     cfgOptTestPoint,
     cfgOptType,
+    cfgOptZeroElide,
 } ConfigOption;
 
 #endif
@@ -516,6 +516,44 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("block-incr")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("backup")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Store only changed pages of relation files.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "By default a relation file that has changed since the prior backup is copied in its entirety, even if only a single "
+                "page changed. When this option is enabled only the pages with an LSN newer than the start of the prior backup are "
+                "stored, along with their page numbers. On restore the file is reassembled from the prior backups that contain the "
+                "rest of its pages.\n"
+            "\n"
+            "Pages are only selected by LSN when page checksums are enabled on the cluster, since otherwise hint bit changes are "
+                "not WAL-logged, so this option has no effect unless checksum-page is enabled. Block incrementals are not "
+                "compressed with a dictionary (see compress-dict) and a file that was compressed with a dictionary in the prior "
+                "backup is copied in its entirety."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -605,6 +643,77 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("cache-drop")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Drop file data from the page cache after it is read or written.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "A backup or restore copies a large amount of data through the page cache, which can evict data that PostgreSQL is "
+                "actively using. When enabled, files on local storage are read with sequential read-ahead and the data is dropped "
+                "from the page cache once it has been read, or once it has been written and synced. Data that was already in the "
+                "page cache when a file was opened is not dropped after it is read so pages that PostgreSQL is using stay cached."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdLocal)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRemote)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRestore)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("checksum-fast")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("backup")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Record a fast checksum for each file.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Directs pgBackRest to record an xxHash (XXH3 128-bit) checksum for each file in the backup manifest in addition to "
+                "the SHA1 checksum. When a fast checksum is available it is used instead of SHA1 to determine if a file has "
+                "changed during delta backup and restore, which is considerably faster on large clusters.\n"
+            "\n"
+            "The fast checksum is not cryptographic so SHA1 is still recorded and used for all other purposes. This option "
+                "requires pgBackRest to be built with xxHash support."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -733,6 +842,45 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("compress-dict")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("backup")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Compress relation files with a trained dictionary.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Before files are copied a zst dictionary is trained from the first pages of a sample of relation files and stored in "
+                "the backup. All relation files in the backup are then compressed with the dictionary, which improves the "
+                "compression ratio since the structure common to all PostgreSQL pages does not need to be learned again for each "
+                "file. Restore loads the dictionary from the backup automatically. Only valid when compress-type=zst."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEPEND_LIST
+            (
+                cfgDefOptCompressType,
+                "zst"
+            )
+
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -749,7 +897,9 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         CFGDEFDATA_OPTION_HELP_SUMMARY("Compression level for stored files.")
         CFGDEFDATA_OPTION_HELP_DESCRIPTION
         (
-            "Sets the zlib level to be used for file compression when compress=y."
+            "Sets the level to be used for file compression when compress=y. The default is 6 for compress-type=gz, 1 for "
+                "compress-type=lz4, and 3 for compress-type=zst. The allowed levels depend on the compression type: 0-9 for gz, "
+                "1-12 for lz4, and 1-19 for zst."
         )
 
         CFGDEFDATA_OPTION_COMMAND_LIST
@@ -771,11 +921,53 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
 
         CFGDEFDATA_OPTION_OPTIONAL_LIST
         (
-            CFGDEFDATA_OPTION_OPTIONAL_ALLOW_RANGE(0, 9)
+            CFGDEFDATA_OPTION_OPTIONAL_ALLOW_RANGE(0, 19)
             CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("6")
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("compress-level-auto")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("backup")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Tune the compression level during the backup.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Each process measures the time spent compressing against the time spent waiting to read from PostgreSQL and write to "
+                "the repository, then adjusts the compression level between files. Checksums and encryption are not counted on "
+                "either side. When compression is the bottleneck the level is lowered, down to 1, and when reads or writes are the "
+                "bottleneck the level is raised. The compress-level option sets the starting level and the level is never raised "
+                "more than 3 above it, nor above the maximum for the compression type (9 for gz, 12 for lz4, and 19 for zst). This "
+                "is useful when the repository throughput is not known in advance, e.g. local NVMe storage needs a low level while "
+                "a slow link to object storage benefits from a high level."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEPEND_LIST
+            (
+                cfgDefOptCompress,
+                "1"
+            )
+
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -823,6 +1015,92 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("compress-thread")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeInteger)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Threads used to compress each file.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "When compress-type=gz or compress-type=zst each file can be compressed by multiple threads, which is useful for large "
+                "files such as WAL segments or when process-max is lower than the number of available cores. Multi-threaded gz "
+                "output is a standard gzip file. The setting is ignored by compress-type=lz4. Note that total threads used may be "
+                "as high as process-max multiplied by compress-thread."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePush)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePushAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_ALLOW_RANGE(1, 64)
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("1")
+        )
+    )
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("compress-type")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeString)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("File compression type.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "The following compression types are supported:\n"
+            "\n"
+            "* gz - gzip compression format\n"
+            "* lz4 - lz4 compression format (not available on all platforms)\n"
+            "* zst - Zstandard compression format (not available on all platforms)\n"
+            "\n"
+            "\n"
+            "lz4 compresses and decompresses much faster than gz at the cost of a lower compression ratio. zst generally achieves "
+                "a better compression ratio than gz while being considerably faster. The compression type is stored in the backup "
+                "manifest and in the extension of each compressed file so restore and archive-get always select the correct "
+                "decompressor, even when the repository contains a mix of types. Differential and incremental backups always use "
+                "the compression type of their prior backup."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePush)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePushAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_ALLOW_LIST
+            (
+                "gz",
+                "lz4",
+                "zst"
+            )
+
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("gz")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -1059,7 +1337,8 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         CFGDEFDATA_OPTION_HELP_DESCRIPTION
         (
             "During a restore, by default the PostgreSQL data and tablespace directories are expected to be present but empty. "
-                "This option performs a delta restore using checksums.\n"
+                "This option performs a delta restore using checksums. Existing files that differ from the backup are updated in "
+                "place by writing only the blocks that differ.\n"
             "\n"
             "During a backup, this option will use checksums instead of the timestamps to determine if files will be copied."
         )
@@ -1076,6 +1355,42 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("direct-io")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Read and write files without the page cache.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Files on local storage are opened with O_DIRECT so data is transferred between storage and aligned buffers in "
+                "pgBackRest without passing through the page cache. This keeps throughput predictable for large clusters and "
+                "leaves the page cache to PostgreSQL. The end of a file that does not fill a complete block is written through the "
+                "page cache. When the file system or platform does not support direct IO the file is read or written normally."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdLocal)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRemote)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRestore)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -1151,6 +1466,87 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("filter-stat")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Log time and bytes for each file filter.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "When enabled the CPU time, wall time, and bytes in/out are measured for each filter (e.g. checksum, compress, and "
+                "encrypt) and for reads and writes to storage. Totals for all processes are logged at the end of the command, "
+                "which shows whether compression, encryption, checksums, or storage is the bottleneck. The statistics are gathered "
+                "for each buffer so there is a small overhead."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchiveGet)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchiveGetAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePush)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePushAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdLocal)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRemote)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRestore)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("filter-thread")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Run file filters in separate threads.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Each file copied is passed through a series of filters, e.g. checksum, compress, and encrypt. By default the filters "
+                "run one after another in the process copying the file. When enabled each filter runs in its own thread and passes "
+                "buffers to the next filter through a queue, so reading, compression, and encryption of a file overlap. Results "
+                "are the same in either mode. Note that each process may use one thread per filter in addition to the threads used "
+                "by compress-thread."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchiveGet)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchiveGetAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePush)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdArchivePushAsync)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdLocal)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRemote)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRestore)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -1287,6 +1683,44 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
         )
     )
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("io-queue-depth")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeInteger)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("general")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Reads or writes in flight for each file.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "When greater than one, files on local storage are read ahead and written behind using io_uring so more than one read "
+                "or write is in flight for each file. This allows fast storage such as NVMe to be kept busy without increasing "
+                "process-max. Each file being read or written uses io-queue-depth * buffer-size memory. When pgBackRest was built "
+                "without liburing or io_uring is not available, files are read ahead by a helper thread and written one buffer at "
+                "a time."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdLocal)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRemote)
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdRestore)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_ALLOW_RANGE(1, 64)
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("1")
+        )
+    )
+
     // -----------------------------------------------------------------------------------------------------------------------------
     CFGDEFDATA_OPTION
     (
@@ -2730,7 +3164,8 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
             CFGDEFDATA_OPTION_OPTIONAL_DEPEND_LIST
             (
                 cfgDefOptRepoCipherType,
-                "aes-256-cbc"
+                "aes-256-cbc",
+                "aes-256-gcm"
             )
 
             CFGDEFDATA_OPTION_OPTIONAL_PREFIX("repo")
@@ -2757,6 +3192,10 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
             "\n"
             "* none - The repository is not encrypted\n"
             "* aes-256-cbc - Advanced Encryption Standard with 256 bit key length\n"
+            "* aes-256-gcm - Advanced Encryption Standard with 256 bit key length in Galois/Counter Mode. Files are encrypted and "
+                "authenticated in independent chunks so modification or truncation is detected on decrypt. Files encrypted with "
+                "aes-256-cbc are rejected on decrypt since they are not authenticated, so a new stanza is required when changing "
+                "to this type.\n"
             "\n"
             "Note that encryption is always performed client-side even if the repository type (e.g. S3) supports encryption."
         )
@@ -2787,7 +3226,8 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
             CFGDEFDATA_OPTION_OPTIONAL_ALLOW_LIST
             (
                 "none",
-                "aes-256-cbc"
+                "aes-256-cbc",
+                "aes-256-gcm"
             )
 
             CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("none")
@@ -4835,4 +5275,40 @@ static ConfigDefineOptionData configDefineOptionData[] = CFGDEFDATA_OPTION_LIST
             )
         )
     )
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    CFGDEFDATA_OPTION
+    (
+        CFGDEFDATA_OPTION_NAME("zero-elide")
+        CFGDEFDATA_OPTION_REQUIRED(true)
+        CFGDEFDATA_OPTION_SECTION(cfgDefSectionGlobal)
+        CFGDEFDATA_OPTION_TYPE(cfgDefOptTypeBoolean)
+        CFGDEFDATA_OPTION_INTERNAL(false)
+
+        CFGDEFDATA_OPTION_INDEX_TOTAL(1)
+        CFGDEFDATA_OPTION_SECURE(false)
+
+        CFGDEFDATA_OPTION_HELP_SECTION("backup")
+        CFGDEFDATA_OPTION_HELP_SUMMARY("Omit all-zero pages from relation files.")
+        CFGDEFDATA_OPTION_HELP_DESCRIPTION
+        (
+            "Relation files often contain pages that are entirely zero, e.g. at the end of segments extended by a bulk load. When "
+                "this option is enabled these pages are dropped before compression and encryption so no time is spent on them, and "
+                "only the remaining pages are stored along with their page numbers. On restore the omitted pages are left as holes "
+                "in the file.\n"
+            "\n"
+            "Files stored as block incrementals (see block-incr) are not affected since they already contain only changed pages. "
+                "Relation files with zero pages omitted are not compressed with a dictionary (see compress-dict)."
+        )
+
+        CFGDEFDATA_OPTION_COMMAND_LIST
+        (
+            CFGDEFDATA_OPTION_COMMAND(cfgDefCmdBackup)
+        )
+
+        CFGDEFDATA_OPTION_OPTIONAL_LIST
+        (
+            CFGDEFDATA_OPTION_OPTIONAL_DEFAULT("0")
+        )
+    )
 )
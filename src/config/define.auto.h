@@ -59,24 +59,35 @@ typedef enum
     cfgDefOptArchivePushQueueMax,
     cfgDefOptArchiveTimeout,
     cfgDefOptBackupStandby,
+    cfgDefOptBlockIncr,
     cfgDefOptBufferSize,
     cfgDefOptC,
+    cfgDefOptCacheDrop,
+    cfgDefOptChecksumFast,
     cfgDefOptChecksumPage,
     cfgDefOptCmdSsh,
     cfgDefOptCommand,
     cfgDefOptCompress,
+    cfgDefOptCompressDict,
     cfgDefOptCompressLevel,
+    cfgDefOptCompressLevelAuto,
     cfgDefOptCompressLevelNetwork,
+    cfgDefOptCompressThread,
+    cfgDefOptCompressType,
     cfgDefOptConfig,
     cfgDefOptConfigIncludePath,
     cfgDefOptConfigPath,
     cfgDefOptDbInclude,
     cfgDefOptDbTimeout,
     cfgDefOptDelta,
+    cfgDefOptDirectIo,
     cfgDefOptExclude,
     cfgDefOptFilter,
+    cfgDefOptFilterStat,
+    cfgDefOptFilterThread,
     cfgDefOptForce,
     cfgDefOptHostId,
+    cfgDefOptIoQueueDepth,
     cfgDefOptLinkAll,
     cfgDefOptLinkMap,
     cfgDefOptLockPath,
@@ -150,6 +161,7 @@ typedef enum
     cfgDefOptTestDelay,
     cfgDefOptTestPoint,
     cfgDefOptType,
+    cfgDefOptZeroElide,
 } ConfigDefineOption;
 
 #endif
@@ -7,14 +7,19 @@ Configuration Load
 #include <sys/stat.h>
 
 #include "command/command.h"
+#include "common/compress/helper.h"
+#include "common/crypto/xxHash.h"
 #include "common/memContext.h"
 #include "common/debug.h"
 #include "common/io/io.h"
+#include "common/io/stat.h"
 #include "common/lock.h"
 #include "common/log.h"
 #include "config/config.h"
 #include "config/load.h"
 #include "config/parse.h"
+#include "storage/posix/storage.h"
+#include "version.h"
 
 /***********************************************************************************************************************************
 Load log settings
@@ -232,6 +237,32 @@ cfgLoadUpdateOption(void)
             strPtr(cfgOptionStr(cfgOptRepoS3Bucket)));
     }
 
+    // Check that the compress type is present in this build and set the default compress level for the type. Else check that the
+    // compress level is in range for the type since the allowed range covers the levels of all types.
+    if (cfgOptionValid(cfgOptCompressType))
+    {
+        CompressType compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType));
+
+        compressTypePresent(compressType);
+
+        if (cfgOptionSource(cfgOptCompressLevel) == cfgSourceDefault)
+            cfgOptionSet(cfgOptCompressLevel, cfgSourceDefault, VARINT(compressLevelDefault(compressType)));
+        else if (cfgOptionInt(cfgOptCompressLevel) < compressLevelMin(compressType) ||
+                 cfgOptionInt(cfgOptCompressLevel) > compressLevelMax(compressType))
+        {
+            THROW_FMT(
+                OptionInvalidValueError,
+                "'%d' is out of range for '" CFGOPT_COMPRESS_LEVEL "' option when '" CFGOPT_COMPRESS_TYPE "' is '%s'"
+                    "\nHINT: allowed levels for '%s' are %d-%d.",
+                cfgOptionInt(cfgOptCompressLevel), strPtr(compressTypeStr(compressType)), strPtr(compressTypeStr(compressType)),
+                compressLevelMin(compressType), compressLevelMax(compressType));
+        }
+    }
+
+    // Check that xxhash is present in this build when fast checksums are enabled
+    if (cfgOptionValid(cfgOptChecksumFast) && cfgOptionBool(cfgOptChecksumFast) && !xxHashPresent())
+        THROW(OptionInvalidValueError, PROJECT_NAME " not compiled with xxhash support");
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -299,6 +330,26 @@ cfgLoad(unsigned int argListSize, const char *argList[])
             if (cfgOptionValid(cfgOptBufferSize))
                 ioBufferSizeSet(cfgOptionUInt(cfgOptBufferSize));
 
+            // Run filters in separate threads
+            if (cfgOptionValid(cfgOptFilterThread))
+                ioFilterThreadSet(cfgOptionBool(cfgOptFilterThread));
+
+            // Measure time and bytes for each filter
+            if (cfgOptionValid(cfgOptFilterStat))
+                ioStatEnabledSet(cfgOptionBool(cfgOptFilterStat));
+
+            // Drop file data from the page cache
+            if (cfgOptionValid(cfgOptCacheDrop))
+                storagePosixCacheDropSet(cfgOptionBool(cfgOptCacheDrop));
+
+            // Read and write files with direct IO
+            if (cfgOptionValid(cfgOptDirectIo))
+                storagePosixDirectSet(cfgOptionBool(cfgOptDirectIo));
+
+            // Keep more than one read or write in flight for each file
+            if (cfgOptionValid(cfgOptIoQueueDepth))
+                storagePosixQueueDepthSet(cfgOptionUInt(cfgOptIoQueueDepth));
+
             // Open the log file if this command logs to a file
             cfgLoadLogFile();
 
@@ -114,6 +114,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptBackupStandby,
     },
 
+    // block-incr option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_BLOCK_INCR,
+        .val = PARSE_OPTION_FLAG | cfgOptBlockIncr,
+    },
+    {
+        .name = "no-" CFGOPT_BLOCK_INCR,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptBlockIncr,
+    },
+    {
+        .name = "reset-" CFGOPT_BLOCK_INCR,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptBlockIncr,
+    },
+
     // buffer-size option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -133,6 +148,36 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptC,
     },
 
+    // cache-drop option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_CACHE_DROP,
+        .val = PARSE_OPTION_FLAG | cfgOptCacheDrop,
+    },
+    {
+        .name = "no-" CFGOPT_CACHE_DROP,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptCacheDrop,
+    },
+    {
+        .name = "reset-" CFGOPT_CACHE_DROP,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCacheDrop,
+    },
+
+    // checksum-fast option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_CHECKSUM_FAST,
+        .val = PARSE_OPTION_FLAG | cfgOptChecksumFast,
+    },
+    {
+        .name = "no-" CFGOPT_CHECKSUM_FAST,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptChecksumFast,
+    },
+    {
+        .name = "reset-" CFGOPT_CHECKSUM_FAST,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptChecksumFast,
+    },
+
     // checksum-page option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -183,6 +228,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompress,
     },
 
+    // compress-dict option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | cfgOptCompressDict,
+    },
+    {
+        .name = "no-" CFGOPT_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptCompressDict,
+    },
+    {
+        .name = "reset-" CFGOPT_COMPRESS_DICT,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressDict,
+    },
+
     // compress-level option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -195,6 +255,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressLevel,
     },
 
+    // compress-level-auto option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_COMPRESS_LEVEL_AUTO,
+        .val = PARSE_OPTION_FLAG | cfgOptCompressLevelAuto,
+    },
+    {
+        .name = "no-" CFGOPT_COMPRESS_LEVEL_AUTO,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptCompressLevelAuto,
+    },
+    {
+        .name = "reset-" CFGOPT_COMPRESS_LEVEL_AUTO,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressLevelAuto,
+    },
+
     // compress-level-network option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -207,6 +282,30 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressLevelNetwork,
     },
 
+    // compress-thread option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_COMPRESS_THREAD,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptCompressThread,
+    },
+    {
+        .name = "reset-" CFGOPT_COMPRESS_THREAD,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressThread,
+    },
+
+    // compress-type option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_COMPRESS_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptCompressType,
+    },
+    {
+        .name = "reset-" CFGOPT_COMPRESS_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptCompressType,
+    },
+
     // config option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -274,6 +373,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptDelta,
     },
 
+    // direct-io option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_DIRECT_IO,
+        .val = PARSE_OPTION_FLAG | cfgOptDirectIo,
+    },
+    {
+        .name = "no-" CFGOPT_DIRECT_IO,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptDirectIo,
+    },
+    {
+        .name = "reset-" CFGOPT_DIRECT_IO,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptDirectIo,
+    },
+
     // exclude option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -294,6 +408,36 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptFilter,
     },
 
+    // filter-stat option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_FILTER_STAT,
+        .val = PARSE_OPTION_FLAG | cfgOptFilterStat,
+    },
+    {
+        .name = "no-" CFGOPT_FILTER_STAT,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptFilterStat,
+    },
+    {
+        .name = "reset-" CFGOPT_FILTER_STAT,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptFilterStat,
+    },
+
+    // filter-thread option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_FILTER_THREAD,
+        .val = PARSE_OPTION_FLAG | cfgOptFilterThread,
+    },
+    {
+        .name = "no-" CFGOPT_FILTER_THREAD,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptFilterThread,
+    },
+    {
+        .name = "reset-" CFGOPT_FILTER_THREAD,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptFilterThread,
+    },
+
     // force option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -309,6 +453,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptHostId,
     },
 
+    // io-queue-depth option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_IO_QUEUE_DEPTH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptIoQueueDepth,
+    },
+    {
+        .name = "reset-" CFGOPT_IO_QUEUE_DEPTH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptIoQueueDepth,
+    },
+
     // link-all option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2270,6 +2426,21 @@ static const struct option optionList[] =
         .has_arg = required_argument,
         .val = PARSE_OPTION_FLAG | cfgOptType,
     },
+
+    // zero-elide option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_ZERO_ELIDE,
+        .val = PARSE_OPTION_FLAG | cfgOptZeroElide,
+    },
+    {
+        .name = "no-" CFGOPT_ZERO_ELIDE,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptZeroElide,
+    },
+    {
+        .name = "reset-" CFGOPT_ZERO_ELIDE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptZeroElide,
+    },
     // Terminate option list
     {
         .name = NULL
@@ -2287,23 +2458,33 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
     cfgOptBackupStandby,
+    cfgOptBlockIncr,
     cfgOptBufferSize,
     cfgOptC,
+    cfgOptCacheDrop,
+    cfgOptChecksumFast,
     cfgOptChecksumPage,
     cfgOptCmdSsh,
     cfgOptCommand,
     cfgOptCompress,
     cfgOptCompressLevel,
+    cfgOptCompressLevelAuto,
     cfgOptCompressLevelNetwork,
+    cfgOptCompressThread,
+    cfgOptCompressType,
     cfgOptConfig,
     cfgOptConfigIncludePath,
     cfgOptConfigPath,
     cfgOptDbInclude,
     cfgOptDbTimeout,
     cfgOptDelta,
+    cfgOptDirectIo,
     cfgOptExclude,
     cfgOptFilter,
+    cfgOptFilterStat,
+    cfgOptFilterThread,
     cfgOptHostId,
+    cfgOptIoQueueDepth,
     cfgOptLinkAll,
     cfgOptLinkMap,
     cfgOptLockPath,
@@ -2429,8 +2610,10 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptTestDelay,
     cfgOptTestPoint,
     cfgOptType,
+    cfgOptZeroElide,
     cfgOptArchiveCheck,
     cfgOptArchiveCopy,
+    cfgOptCompressDict,
     cfgOptForce,
     cfgOptRecoveryOption,
     cfgOptRepoCipherPass,
@@ -388,6 +388,13 @@ infoBackupDataAdd(const InfoBackup *this, const Manifest *manifest)
                 backupSizeDelta += file->size;
                 backupRepoSizeDelta += file->sizeRepo > 0 ? file->sizeRepo : file->size;
             }
+
+            // Prior backups in a block incremental chain are also required to restore the file
+            if (file->blockIncrChain != NULL)
+            {
+                for (unsigned int chainIdx = 0; chainIdx < strLstSize(file->blockIncrChain); chainIdx++)
+                    strLstAddIfMissing(referenceList, strLstGet(file->blockIncrChain, chainIdx));
+            }
         }
 
         MEM_CONTEXT_BEGIN(lstMemContext(this->backup))
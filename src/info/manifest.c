@@ -64,12 +64,20 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     STRING_STATIC(MANIFEST_KEY_BACKUP_TIMESTAMP_STOP_STR,           MANIFEST_KEY_BACKUP_TIMESTAMP_STOP);
 #define MANIFEST_KEY_BACKUP_TYPE                                    "backup-type"
     STRING_STATIC(MANIFEST_KEY_BACKUP_TYPE_STR,                     MANIFEST_KEY_BACKUP_TYPE);
+#define MANIFEST_KEY_BLOCK_INCR_CHAIN                               "block-incr-chain"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BLOCK_INCR_CHAIN_VAR,        MANIFEST_KEY_BLOCK_INCR_CHAIN);
 #define MANIFEST_KEY_CHECKSUM                                       "checksum"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_VAR,                MANIFEST_KEY_CHECKSUM);
+#define MANIFEST_KEY_CHECKSUM_FAST                                  "checksum-fast"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_FAST_VAR,           MANIFEST_KEY_CHECKSUM_FAST);
 #define MANIFEST_KEY_CHECKSUM_PAGE                                  "checksum-page"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_VAR,           MANIFEST_KEY_CHECKSUM_PAGE);
 #define MANIFEST_KEY_CHECKSUM_PAGE_ERROR                            "checksum-page-error"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR,     MANIFEST_KEY_CHECKSUM_PAGE_ERROR);
+#define MANIFEST_KEY_COMPRESS_BYPASS                                "compress-bypass"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_COMPRESS_BYPASS_VAR,         MANIFEST_KEY_COMPRESS_BYPASS);
+#define MANIFEST_KEY_COMPRESS_DICT                                  "compress-dict"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_COMPRESS_DICT_VAR,           MANIFEST_KEY_COMPRESS_DICT);
 #define MANIFEST_KEY_DB_ID                                          "db-id"
     STRING_STATIC(MANIFEST_KEY_DB_ID_STR,                           MANIFEST_KEY_DB_ID);
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_DB_ID_VAR,                   MANIFEST_KEY_DB_ID);
@@ -111,6 +119,8 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
 #define MANIFEST_KEY_USER                                           "user"
     STRING_STATIC(MANIFEST_KEY_USER_STR,                            MANIFEST_KEY_USER);
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_USER_VAR,                    MANIFEST_KEY_USER);
+#define MANIFEST_KEY_ZERO_ELIDE                                     "zero-elide"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_ZERO_ELIDE_VAR,              MANIFEST_KEY_ZERO_ELIDE);
 
 #define MANIFEST_KEY_OPTION_ARCHIVE_CHECK                           "option-archive-check"
     STRING_STATIC(MANIFEST_KEY_OPTION_ARCHIVE_CHECK_STR,            MANIFEST_KEY_OPTION_ARCHIVE_CHECK);
@@ -124,10 +134,14 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     STRING_STATIC(MANIFEST_KEY_OPTION_CHECKSUM_PAGE_STR,            MANIFEST_KEY_OPTION_CHECKSUM_PAGE);
 #define MANIFEST_KEY_OPTION_COMPRESS                                "option-compress"
     STRING_STATIC(MANIFEST_KEY_OPTION_COMPRESS_STR,                 MANIFEST_KEY_OPTION_COMPRESS);
+#define MANIFEST_KEY_OPTION_COMPRESS_DICT                           "option-compress-dict"
+    STRING_STATIC(MANIFEST_KEY_OPTION_COMPRESS_DICT_STR,            MANIFEST_KEY_OPTION_COMPRESS_DICT);
 #define MANIFEST_KEY_OPTION_COMPRESS_LEVEL                          "option-compress-level"
     STRING_STATIC(MANIFEST_KEY_OPTION_COMPRESS_LEVEL_STR,           MANIFEST_KEY_OPTION_COMPRESS_LEVEL);
 #define MANIFEST_KEY_OPTION_COMPRESS_LEVEL_NETWORK                  "option-compress-level-network"
     STRING_STATIC(MANIFEST_KEY_OPTION_COMPRESS_LEVEL_NETWORK_STR,   MANIFEST_KEY_OPTION_COMPRESS_LEVEL_NETWORK);
+#define MANIFEST_KEY_OPTION_COMPRESS_TYPE                           "option-compress-type"
+    STRING_STATIC(MANIFEST_KEY_OPTION_COMPRESS_TYPE_STR,            MANIFEST_KEY_OPTION_COMPRESS_TYPE);
 #define MANIFEST_KEY_OPTION_DELTA                                   "option-delta"
     STRING_STATIC(MANIFEST_KEY_OPTION_DELTA_STR,                    MANIFEST_KEY_OPTION_DELTA);
 #define MANIFEST_KEY_OPTION_HARDLINK                                "option-hardlink"
@@ -220,9 +234,12 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
     {
         ManifestFile fileAdd =
         {
+            .blockIncrChain = file->blockIncrChain == NULL ? NULL : strLstDup(file->blockIncrChain),
             .checksumPage = file->checksumPage,
             .checksumPageError = file->checksumPageError,
             .checksumPageErrorList = varLstDup(file->checksumPageErrorList),
+            .compressBypass = file->compressBypass,
+            .compressDict = file->compressDict,
             .group = manifestOwnerCache(this, file->group),
             .mode = file->mode,
             .name = strDup(file->name),
@@ -231,9 +248,11 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
             .sizeRepo = file->sizeRepo,
             .timestamp = file->timestamp,
             .user = manifestOwnerCache(this, file->user),
+            .zeroElide = file->zeroElide,
         };
 
         memcpy(fileAdd.checksumSha1, file->checksumSha1, HASH_TYPE_SHA1_SIZE_HEX + 1);
+        memcpy(fileAdd.checksumFast, file->checksumFast, XXHASH_SIZE_HEX + 1);
 
         if (file->reference != NULL)
         {
@@ -493,6 +512,16 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
                     file.checksumSha1, strPtr(varStr(kvGet(fileKv, MANIFEST_KEY_CHECKSUM_VAR))), HASH_TYPE_SHA1_SIZE_HEX + 1);
             }
 
+            const Variant *checksumFast = kvGetDefault(fileKv, MANIFEST_KEY_CHECKSUM_FAST_VAR, NULL);
+
+            if (checksumFast != NULL)
+                memcpy(file.checksumFast, strPtr(varStr(checksumFast)), XXHASH_SIZE_HEX + 1);
+
+            const Variant *blockIncrChain = kvGetDefault(fileKv, MANIFEST_KEY_BLOCK_INCR_CHAIN_VAR, NULL);
+
+            if (blockIncrChain != NULL)
+                file.blockIncrChain = strLstNewVarLst(varVarLst(blockIncrChain));
+
             const Variant *checksumPage = kvGetDefault(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_VAR, NULL);
 
             if (checksumPage != NULL)
@@ -506,6 +535,10 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
                     file.checksumPageErrorList = varVarLst(checksumPageErrorList);
             }
 
+            file.compressBypass = varBool(kvGetDefault(fileKv, MANIFEST_KEY_COMPRESS_BYPASS_VAR, BOOL_FALSE_VAR));
+            file.compressDict = varBool(kvGetDefault(fileKv, MANIFEST_KEY_COMPRESS_DICT_VAR, BOOL_FALSE_VAR));
+            file.zeroElide = varBool(kvGetDefault(fileKv, MANIFEST_KEY_ZERO_ELIDE_VAR, BOOL_FALSE_VAR));
+
             if (kvKeyExists(fileKv, MANIFEST_KEY_GROUP_VAR))
             {
                 valueFound.group = true;
@@ -757,10 +790,14 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
                 manifest->data.backupOptionBufferSize = varNewUInt(jsonToUInt(value));
             else if (strEq(key, MANIFEST_KEY_OPTION_CHECKSUM_PAGE_STR))
                 manifest->data.backupOptionChecksumPage = varNewBool(jsonToBool(value));
+            else if (strEq(key, MANIFEST_KEY_OPTION_COMPRESS_DICT_STR))
+                manifest->data.backupOptionCompressDict = varNewBool(jsonToBool(value));
             else if (strEq(key, MANIFEST_KEY_OPTION_COMPRESS_LEVEL_STR))
                 manifest->data.backupOptionCompressLevel = varNewUInt(jsonToUInt(value));
             else if (strEq(key, MANIFEST_KEY_OPTION_COMPRESS_LEVEL_NETWORK_STR))
                 manifest->data.backupOptionCompressLevelNetwork = varNewUInt(jsonToUInt(value));
+            else if (strEq(key, MANIFEST_KEY_OPTION_COMPRESS_TYPE_STR))
+                manifest->data.backupOptionCompressType = varNewStr(jsonToStr(value));
             else if (strEq(key, MANIFEST_KEY_OPTION_DELTA_STR))
                 manifest->data.backupOptionDelta = varNewBool(jsonToBool(value));
             else if (strEq(key, MANIFEST_KEY_OPTION_PROCESS_MAX_STR))
@@ -1031,6 +1068,13 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
             infoSaveData, MANIFEST_SECTION_BACKUP_OPTION_STR, MANIFEST_KEY_OPTION_COMPRESS_STR,
             jsonFromBool(manifest->data.backupOptionCompress));
 
+        if (manifest->data.backupOptionCompressDict != NULL)
+        {
+            infoSaveValue(
+                infoSaveData, MANIFEST_SECTION_BACKUP_OPTION_STR, MANIFEST_KEY_OPTION_COMPRESS_DICT_STR,
+                jsonFromVar(manifest->data.backupOptionCompressDict));
+        }
+
         if (manifest->data.backupOptionCompressLevel != NULL)
         {
             infoSaveValue(
@@ -1045,6 +1089,13 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 jsonFromVar(manifest->data.backupOptionCompressLevelNetwork));
         }
 
+        if (manifest->data.backupOptionCompressType != NULL)
+        {
+            infoSaveValue(
+                infoSaveData, MANIFEST_SECTION_BACKUP_OPTION_STR, MANIFEST_KEY_OPTION_COMPRESS_TYPE_STR,
+                jsonFromVar(manifest->data.backupOptionCompressType));
+        }
+
         if (manifest->data.backupOptionDelta != NULL)
         {
             infoSaveValue(
@@ -1133,9 +1184,15 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 const ManifestFile *file = manifestFile(manifest, fileIdx);
                 KeyValue *fileKv = kvNew();
 
+                if (file->blockIncrChain != NULL)
+                    kvPut(fileKv, MANIFEST_KEY_BLOCK_INCR_CHAIN_VAR, varNewVarLst(varLstNewStrLst(file->blockIncrChain)));
+
                 if (file->size != 0)
                     kvPut(fileKv, MANIFEST_KEY_CHECKSUM_VAR, VARSTRZ(file->checksumSha1));
 
+                if (file->checksumFast[0] != '\0')
+                    kvPut(fileKv, MANIFEST_KEY_CHECKSUM_FAST_VAR, VARSTRZ(file->checksumFast));
+
                 if (file->checksumPage)
                 {
                     kvPut(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_VAR, VARBOOL(file->checksumPageError));
@@ -1144,6 +1201,12 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                         kvPut(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR, varNewVarLst(file->checksumPageErrorList));
                 }
 
+                if (file->compressBypass)
+                    kvPut(fileKv, MANIFEST_KEY_COMPRESS_BYPASS_VAR, BOOL_TRUE_VAR);
+
+                if (file->compressDict)
+                    kvPut(fileKv, MANIFEST_KEY_COMPRESS_DICT_VAR, BOOL_TRUE_VAR);
+
                 if (!varEq(manifestOwnerVar(file->group), saveData->fileGroupDefault))
                     kvPut(fileKv, MANIFEST_KEY_GROUP_VAR, manifestOwnerVar(file->group));
 
@@ -1166,6 +1229,9 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 if (!varEq(manifestOwnerVar(file->user), saveData->fileUserDefault))
                     kvPut(fileKv, MANIFEST_KEY_USER_VAR, manifestOwnerVar(file->user));
 
+                if (file->zeroElide)
+                    kvPut(fileKv, MANIFEST_KEY_ZERO_ELIDE_VAR, BOOL_TRUE_VAR);
+
                 infoSaveValue(infoSaveData, MANIFEST_SECTION_TARGET_FILE_STR, file->name, jsonFromKv(fileKv));
 
                 MEM_CONTEXT_TEMP_RESET(1000);
@@ -20,6 +20,9 @@ Constants
 #define BACKUP_MANIFEST_FILE                                        "backup.manifest"
     STRING_DECLARE(BACKUP_MANIFEST_FILE_STR);
 
+// Compression dictionary stored in the backup path when the compress-dict option is enabled
+#define BACKUP_COMPRESS_DICT_FILE                                   "compress.dict"
+
 #define MANIFEST_TARGET_PGDATA                                      "pg_data"
     STRING_DECLARE(MANIFEST_TARGET_PGDATA_STR);
 #define MANIFEST_TARGET_PGTBLSPC                                    "pg_tblspc"
@@ -31,6 +34,7 @@ Object type
 typedef struct Manifest Manifest;
 
 #include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
 #include "storage/storage.h"
 
 /***********************************************************************************************************************************
@@ -66,6 +70,8 @@ typedef struct ManifestData
     bool backupOptionCompress;                                      // Will compression be used for backup?
     const Variant *backupOptionCompressLevel;                       // Level to use for compression
     const Variant *backupOptionCompressLevelNetwork;                // Level to use for network compression
+    const Variant *backupOptionCompressType;                        // Compression type (gz when not present)
+    const Variant *backupOptionCompressDict;                        // Was a compression dictionary trained for relation files?
     const Variant *backupOptionDelta;                               // Will a checksum delta be performed?
     bool backupOptionHardLink;                                      // Will hardlinks be created in the backup?
     bool backupOptionOnline;                                        // Will an online backup be performed?
@@ -91,12 +97,17 @@ typedef struct ManifestFile
     bool primary:1;                                                 // Should this file be copied from the primary?
     bool checksumPage:1;                                            // Does this file have page checksums?
     bool checksumPageError:1;                                       // Is there an error in the page checksum?
+    bool compressBypass:1;                                          // Was compression bypassed for this file?
+    bool compressDict:1;                                            // Was the backup set compression dictionary used?
+    bool zeroElide:1;                                               // Were zero pages omitted where the file (or chain) begins?
     mode_t mode;                                                    // File mode
     char checksumSha1[HASH_TYPE_SHA1_SIZE_HEX + 1];                 // SHA1 checksum
+    char checksumFast[XXHASH_SIZE_HEX + 1];                         // Fast checksum (empty when not recorded)
     const VariantList *checksumPageErrorList;                       // List of page checksum errors if there are any
     const String *user;                                             // User name
     const String *group;                                            // Group name
     const String *reference;                                        // Reference to a prior backup
+    const StringList *blockIncrChain;                               // Prior backups to restore before this block incremental
     uint64_t size;                                                  // Original size
     uint64_t sizeRepo;                                              // Size in repo
     time_t timestamp;                                               // Original timestamp
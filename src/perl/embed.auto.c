@@ -173,7 +173,7 @@ static const EmbeddedModule embeddedModule[] =
             "STORAGE_REPO_ARCHIVE . \"/${strArchiveId}/\" . substr($strWalSegment, 0, 16),\n"
             "{strExpression =>\n"
             "'^' . substr($strWalSegment, 0, 24) . (walIsPartial($strWalSegment) ? \"\\\\.partial\" : '') .\n"
-            "\"-[0-f]{40}(\\\\.\" . COMPRESS_EXT . \"){0,1}\\$\",\n"
+            "\"-[0-f]{40}\" . COMPRESS_EXT_REGEXP . \"\\$\",\n"
             "bIgnoreMissing => true}));\n"
             "}\n"
             "while (@stryWalFileName == 0 && waitMore($oWait));\n"
@@ -690,7 +690,7 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "my $strArchiveFile = (storageRepo()->list(\n"
             "$self->{strArchiveClusterPath} . \"/${strVersionDir}/${strArchiveDir}\",\n"
-            "{strExpression => \"^[0-F]{24}(\\\\.partial){0,1}(-[0-f]+){0,1}(\\\\.\" . COMPRESS_EXT . \"){0,1}\\$\",\n"
+            "{strExpression => \"^[0-F]{24}(\\\\.partial){0,1}(-[0-f]+){0,1}\" . COMPRESS_EXT_REGEXP . \"\\$\",\n"
             "bIgnoreMissing => true}))[0];\n"
             "\n\n"
             "if (!defined($strArchiveFile))\n"
@@ -710,10 +710,11 @@ static const EmbeddedModule embeddedModule[] =
             "\"\\nHINT: is or was the repo encrypted?\", ERROR_CRYPTO);\n"
             "}\n"
             "\n\n"
+            "my $strCompressType = compressTypeFromFile($strArchiveFile);\n"
+            "\n\n"
             "my $oFileIo = storageRepo()->openRead(\n"
             "$strArchiveFilePath,\n"
-            "{rhyFilter => $strArchiveFile =~ ('\\.' . COMPRESS_EXT . '$') ?\n"
-            "[{strClass => STORAGE_FILTER_GZIP, rxyParam => [STORAGE_DECOMPRESS, false]}] : undef,\n"
+            "{rhyFilter => defined($strCompressType) ? [compressFilter($strCompressType, STORAGE_DECOMPRESS)] : undef,\n"
             "strCipherPass => $self->cipherPassSub()});\n"
             "$oFileIo->open();\n"
             "\n"
@@ -952,6 +953,9 @@ static const EmbeddedModule embeddedModule[] =
             "my $hFile = $oStorageRepo->manifest(STORAGE_REPO_BACKUP . \"/${strBackupLabel}\");\n"
             "\n\n"
             "my $bCompressed = $oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);\n"
+            "my $iCompressExtSize =\n"
+            "length($oAbortedManifest->get(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ)) + 1;\n"
             "\n"
             "if (!$bDelta)\n"
             "{\n"
@@ -967,7 +971,7 @@ static const EmbeddedModule embeddedModule[] =
             "foreach my $strName (sort(keys(%{$hFile})))\n"
             "{\n"
             "\n"
-            "if ($strName eq FILE_MANIFEST_COPY ||\n"
+            "if ($strName eq FILE_MANIFEST_COPY || $strName eq FILE_COMPRESS_DICT ||\n"
             "$strName eq '.')\n"
             "{\n"
             "next;\n"
@@ -980,7 +984,7 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "if ($bCompressed)\n"
             "{\n"
-            "$strFile = substr($strFile, 0, length($strFile) - 3);\n"
+            "$strFile = substr($strFile, 0, length($strFile) - $iCompressExtSize);\n"
             "}\n"
             "\n\n\n"
             "if ($oManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile) &&\n"
@@ -1004,7 +1008,7 @@ static const EmbeddedModule embeddedModule[] =
             "foreach my $strName (sort(keys(%{$hFile})))\n"
             "{\n"
             "\n"
-            "if ($strName eq FILE_MANIFEST_COPY ||\n"
+            "if ($strName eq FILE_MANIFEST_COPY || $strName eq FILE_COMPRESS_DICT ||\n"
             "$strName eq '.')\n"
             "{\n"
             "next;\n"
@@ -1027,14 +1031,17 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "if ($bCompressed)\n"
             "{\n"
-            "$strFile = substr($strFile, 0, length($strFile) - 3);\n"
+            "$strFile = substr($strFile, 0, length($strFile) - $iCompressExtSize);\n"
             "}\n"
             "\n\n"
             "if ($oManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile) &&\n"
             "!$oManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_REFERENCE))\n"
             "{\n"
-            "\n"
-            "my $strChecksum = $oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, false);\n"
+            "\n\n"
+            "my $strChecksum =\n"
+            "$oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN) ||\n"
+            "$oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_ZERO_ELIDE) ? undef :\n"
+            "$oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, false);\n"
             "\n\n\n\n\n"
             "if (defined($strChecksum) &&\n"
             "$oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_SIZE) ==\n"
@@ -1045,6 +1052,24 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "$oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksum);\n"
             "\n\n"
+            "my $strChecksumFast =\n"
+            "$oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_FAST, false);\n"
+            "\n"
+            "if (defined($strChecksumFast))\n"
+            "{\n"
+            "$oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_FAST, $strChecksumFast);\n"
+            "}\n"
+            "\n\n"
+            "if ($oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_BYPASS))\n"
+            "{\n"
+            "$oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);\n"
+            "}\n"
+            "\n\n"
+            "if ($oAbortedManifest->test(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_DICT))\n"
+            "{\n"
+            "$oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_COMPRESS_DICT, true);\n"
+            "}\n"
+            "\n\n"
             "my $bChecksumPage =\n"
             "$oAbortedManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFile, MANIFEST_SUBKEY_CHECKSUM_PAGE, false);\n"
             "\n"
@@ -1104,10 +1129,13 @@ static const EmbeddedModule embeddedModule[] =
             "$strType,\n"
             "$strDbVersion,\n"
             "$bCompress,\n"
+            "$strCompressType,\n"
+            "$bCompressDict,\n"
             "$bHardLink,\n"
             "$oBackupManifest,\n"
             "$strBackupLabel,\n"
             "$strLsnStart,\n"
+            "$oLastManifest,\n"
             ") =\n"
             "logDebugParam\n"
             "(\n"
@@ -1117,10 +1145,13 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'strType'},\n"
             "{name => 'strDbVersion'},\n"
             "{name => 'bCompress'},\n"
+            "{name => 'strCompressType'},\n"
+            "{name => 'bCompressDict'},\n"
             "{name => 'bHardLink'},\n"
             "{name => 'oBackupManifest'},\n"
             "{name => 'strBackupLabel'},\n"
             "{name => 'strLsnStart', required => false},\n"
+            "{name => 'oLastManifest', required => false},\n"
             ");\n"
             "\n\n"
             "&log(TEST, TEST_BACKUP_START);\n"
@@ -1165,6 +1196,34 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "}\n"
             "\n\n"
+            "my $bCompressLevelAuto = $bCompress && cfgOption(CFGOPT_COMPRESS_LEVEL_AUTO, false) ? true : false;\n"
+            "\n\n"
+            "my $bChecksumFast = cfgOption(CFGOPT_CHECKSUM_FAST, false) ? true : false;\n"
+            "\n\n"
+            "my $lBlockIncrLsn = 0;\n"
+            "\n"
+            "if (cfgOption(CFGOPT_BLOCK_INCR, false) && cfgOption(CFGOPT_CHECKSUM_PAGE) && defined($oLastManifest))\n"
+            "{\n"
+            "$lBlockIncrLsn = backupBlockIncrLsn($oLastManifest, $oBackupManifest);\n"
+            "}\n"
+            "\n\n"
+            "my $bZeroElide = cfgOption(CFGOPT_ZERO_ELIDE, false) ? true : false;\n"
+            "\n\n"
+            "my $hBlockIncrChain = {};\n"
+            "\n\n"
+            "my $hZeroElide = {};\n"
+            "\n\n"
+            "if ($bCompressDict &&\n"
+            "!storageRepo()->exists(STORAGE_REPO_BACKUP . \"/${strBackupLabel}/\" . FILE_COMPRESS_DICT))\n"
+            "{\n"
+            "$bCompressDict = $self->processCompressDict($strDbCopyPath, $oBackupManifest, $strBackupLabel);\n"
+            "\n\n"
+            "if (!$bCompressDict)\n"
+            "{\n"
+            "$oBackupManifest->remove(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT);\n"
+            "}\n"
+            "}\n"
+            "\n\n"
             "foreach my $strRepoFile (\n"
             "sort {sprintf(\"%016d-%s\", $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE), $b) cmp\n"
             "sprintf(\"%016d-%s\", $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $a, MANIFEST_SUBKEY_SIZE), $a)}\n"
@@ -1207,6 +1266,33 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n\n"
             "my $lSize = $oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);\n"
+            "\n\n\n"
+            "my $lFileBlockIncrLsn = 0;\n"
+            "\n"
+            "if ($lBlockIncrLsn != 0 && isChecksumPage($strRepoFile) &&\n"
+            "$oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE, false, 0) > 0 &&\n"
+            "!$oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT))\n"
+            "{\n"
+            "$lFileBlockIncrLsn = $lBlockIncrLsn;\n"
+            "\n"
+            "$hBlockIncrChain->{$strRepoFile} =\n"
+            "[\n"
+            "@{$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, false, [])},\n"
+            "$oLastManifest->get(\n"
+            "MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE, false,\n"
+            "$oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL)),\n"
+            "];\n"
+            "\n"
+            "$hZeroElide->{$strRepoFile} = $oLastManifest->boolTest(\n"
+            "MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE, true) ? true : false;\n"
+            "}\n"
+            "\n\n\n"
+            "my $bFileZeroElide = $bZeroElide && isChecksumPage($strRepoFile) && $lFileBlockIncrLsn == 0 ? true : false;\n"
+            "\n"
+            "if ($bFileZeroElide)\n"
+            "{\n"
+            "$hZeroElide->{$strRepoFile} = true;\n"
+            "}\n"
             "\n"
             "$lFileTotal++;\n"
             "$lSizeTotal += $lSize;\n"
@@ -1215,15 +1301,20 @@ static const EmbeddedModule embeddedModule[] =
             "$iHostConfigIdx, $strQueueKey, $strRepoFile, OP_BACKUP_FILE,\n"
             "[$strDbFile, $bIgnoreMissing, $lSize,\n"
             "$oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, false),\n"
+            "$bChecksumFast ?\n"
+            "$oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST, false) : undef,\n"
             "cfgOption(CFGOPT_CHECKSUM_PAGE) ? isChecksumPage($strRepoFile) : false,\n"
             "defined($strLsnStart) ? hex((split('/', $strLsnStart))[0]) : 0xFFFFFFFF,\n"
             "defined($strLsnStart) ? hex((split('/', $strLsnStart))[1]) : 0xFFFFFFFF,\n"
-            "$strRepoFile, defined($strReference) ? true : false, $bCompress, cfgOption(CFGOPT_COMPRESS_LEVEL),\n"
-            "$strBackupLabel, cfgOption(CFGOPT_DELTA)],\n"
+            "$strRepoFile, defined($strReference) ? true : false, $bCompress ? $strCompressType : 'none',\n"
+            "cfgOption(CFGOPT_COMPRESS_LEVEL), cfgOption(CFGOPT_COMPRESS_THREAD), $bCompressLevelAuto,\n"
+            "$bCompressDict && isChecksumPage($strRepoFile) && $lFileBlockIncrLsn == 0 && !$bFileZeroElide ? true : false,\n"
+            "$strBackupLabel, cfgOption(CFGOPT_DELTA), $bChecksumFast, $lFileBlockIncrLsn, $bFileZeroElide],\n"
             "{rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});\n"
             "\n\n"
             "$oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);\n"
             "$oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM);\n"
+            "$oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST);\n"
             "}\n"
             "\n\n"
             "if (!$oBackupManifest->test(MANIFEST_SECTION_TARGET_FILE, MANIFEST_FILE_PGCONTROL) && cfgOption(CFGOPT_ONLINE))\n"
@@ -1254,13 +1345,15 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "($lSizeCurrent, $lManifestSaveCurrent) = backupManifestUpdate(\n"
             "$oBackupManifest, cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $hJob->{iHostConfigIdx}), false),\n"
-            "$hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],\n"
-            "@{$hJob->{rParam}}[4], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize,\n"
-            "$lManifestSaveCurrent);\n"
+            "$hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[8], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],\n"
+            "@{$hJob->{rParam}}[5], @{$hJob->{rResult}}, $hBlockIncrChain->{@{$hJob->{rParam}}[8]},\n"
+            "$hZeroElide->{@{$hJob->{rParam}}[8]}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize, $lManifestSaveCurrent);\n"
             "}\n"
             "\n\n\n"
             "protocolKeepAlive();\n"
             "}\n"
+            "\n\n"
+            "$oBackupProcess->ioStatLog();\n"
             "\n"
             "foreach my $strFile ($oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE))\n"
             "{\n"
@@ -1275,8 +1368,8 @@ static const EmbeddedModule embeddedModule[] =
             "&log(DETAIL, \"hardlink ${strFile} to ${strReference}\");\n"
             "\n"
             "storageRepo()->linkCreate(\n"
-            "STORAGE_REPO_BACKUP . \"/${strReference}/${strFile}\" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),\n"
-            "STORAGE_REPO_BACKUP . \"/${strBackupLabel}/${strFile}\" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),\n"
+            "STORAGE_REPO_BACKUP . \"/${strReference}/${strFile}\" . ($bCompress ? qw{.} . $strCompressType : ''),\n"
+            "STORAGE_REPO_BACKUP . \"/${strBackupLabel}/${strFile}\" . ($bCompress ? qw{.} . $strCompressType : ''),\n"
             "{bHard => true});\n"
             "}\n"
             "\n\n"
@@ -1295,6 +1388,66 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'lSizeTotal', value => $lSizeTotal}\n"
             ");\n"
             "}\n"
+            "\n\n\n\n\n\n\n"
+            "sub processCompressDict\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my\n"
+            "(\n"
+            "$strOperation,\n"
+            "$strDbCopyPath,\n"
+            "$oBackupManifest,\n"
+            "$strBackupLabel,\n"
+            ") =\n"
+            "logDebugParam\n"
+            "(\n"
+            "__PACKAGE__ . '->processCompressDict', \\@_,\n"
+            "{name => 'strDbCopyPath'},\n"
+            "{name => 'oBackupManifest'},\n"
+            "{name => 'strBackupLabel'},\n"
+            ");\n"
+            "\n\n"
+            "my @stryDbFile;\n"
+            "\n"
+            "foreach my $strRepoFile (\n"
+            "sort {$oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE) <=>\n"
+            "$oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $a, MANIFEST_SUBKEY_SIZE) || $a cmp $b}\n"
+            "(grep {isChecksumPage($_)} $oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE, INI_SORT_NONE)))\n"
+            "{\n"
+            "last if @stryDbFile >= BACKUP_DICT_SAMPLE_FILE_MAX ||\n"
+            "$oBackupManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE) == 0;\n"
+            "\n"
+            "push(@stryDbFile, $oBackupManifest->dbPathGet($strDbCopyPath, $strRepoFile));\n"
+            "}\n"
+            "\n"
+            "my $bResult = false;\n"
+            "\n"
+            "if (@stryDbFile > 0)\n"
+            "{\n"
+            "\n"
+            "my $oDictProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);\n"
+            "$oDictProcess->hostAdd($self->{iCopyRemoteIdx}, 1);\n"
+            "\n"
+            "$oDictProcess->queueJob(\n"
+            "$self->{iCopyRemoteIdx}, MANIFEST_TARGET_PGDATA, FILE_COMPRESS_DICT, OP_BACKUP_DICT, [\\@stryDbFile, $strBackupLabel],\n"
+            "{rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});\n"
+            "\n"
+            "while (my $hyJob = $oDictProcess->process())\n"
+            "{\n"
+            "foreach my $hJob (@{$hyJob})\n"
+            "{\n"
+            "$bResult = @{$hJob->{rResult}}[0] ? true : false;\n"
+            "}\n"
+            "}\n"
+            "}\n"
+            "\n\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'bResult', value => $bResult}\n"
+            ");\n"
+            "}\n"
             "\n\n\n\n\n\n"
             "sub process\n"
             "{\n"
@@ -1308,6 +1461,8 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "my $strType = cfgOption(CFGOPT_TYPE);\n"
             "my $bCompress = cfgOption(CFGOPT_COMPRESS);\n"
+            "my $strCompressType = cfgOption(CFGOPT_COMPRESS_TYPE);\n"
+            "my $bCompressDict = $bCompress && cfgOption(CFGOPT_COMPRESS_DICT, false) ? true : false;\n"
             "my $bHardLink = cfgOption(CFGOPT_REPO_HARDLINK);\n"
             "\n\n"
             "my $oBackupInfo = new pgBackRest::Backup::Info($oStorageRepo->pathGet(STORAGE_REPO_BACKUP));\n"
@@ -1375,6 +1530,16 @@ static const EmbeddedModule embeddedModule[] =
             "$bCompress = $oLastManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);\n"
             "}\n"
             "\n\n"
+            "my $strCompressTypeLast = $oLastManifest->get(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ);\n"
+            "\n"
+            "if ($bCompress && $strCompressType ne $strCompressTypeLast)\n"
+            "{\n"
+            "&log(WARN, \"${strType} backup cannot alter compress-type option to '${strCompressType}', reset to value in\" .\n"
+            "\" ${strBackupLastPath}\");\n"
+            "$strCompressType = $strCompressTypeLast;\n"
+            "}\n"
+            "\n\n"
             "if (!$oLastManifest->boolTest(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, $bHardLink))\n"
             "{\n"
             "&log(WARN, \"${strType} backup cannot alter hardlink option to '\" . boolFormat($bHardLink) .\n"
@@ -1458,6 +1623,26 @@ static const EmbeddedModule embeddedModule[] =
             "$strValueAborted = $oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS);\n"
             "}\n"
             "\n"
+            "elsif ($bCompress &&\n"
+            "$oAbortedManifest->get(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false,\n"
+            "CFGOPTVAL_COMPRESS_TYPE_GZ) ne $strCompressType)\n"
+            "{\n"
+            "$strKey = MANIFEST_KEY_COMPRESS_TYPE;\n"
+            "$strValueNew = $strCompressType;\n"
+            "$strValueAborted = $oAbortedManifest->get(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, false, CFGOPTVAL_COMPRESS_TYPE_GZ);\n"
+            "}\n"
+            "\n"
+            "elsif ($oAbortedManifest->boolGet(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, false, false) != $bCompressDict)\n"
+            "{\n"
+            "$strKey = MANIFEST_KEY_COMPRESS_DICT;\n"
+            "$strValueNew = $bCompressDict;\n"
+            "$strValueAborted = $oAbortedManifest->boolGet(\n"
+            "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, false, false);\n"
+            "}\n"
+            "\n"
             "elsif ($oAbortedManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK) !=\n"
             "cfgOption(CFGOPT_REPO_HARDLINK))\n"
             "{\n"
@@ -1540,6 +1725,17 @@ static const EmbeddedModule embeddedModule[] =
             "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_LEVEL, undef, cfgOption(CFGOPT_COMPRESS_LEVEL));\n"
             "$oBackupManifest->numericSet(\n"
             "MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_LEVEL_NETWORK, undef, cfgOption(CFGOPT_COMPRESS_LEVEL_NETWORK));\n"
+            "\n\n"
+            "if ($bCompress && $strCompressType ne CFGOPTVAL_COMPRESS_TYPE_GZ)\n"
+            "{\n"
+            "$oBackupManifest->set(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_TYPE, undef, $strCompressType);\n"
+            "}\n"
+            "\n\n"
+            "if ($bCompressDict)\n"
+            "{\n"
+            "$oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS_DICT, undef, true);\n"
+            "}\n"
+            "\n"
             "$oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, $bHardLink);\n"
             "$oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_ONLINE, undef, cfgOption(CFGOPT_ONLINE));\n"
             "$oBackupManifest->boolSet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_ARCHIVE_COPY, undef,\n"
@@ -1681,8 +1877,8 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "my $lBackupSizeTotal =\n"
             "$self->processManifest(\n"
-            "$strDbMasterPath, $strDbCopyPath, $strType, $strDbVersion, $bCompress, $bHardLink, $oBackupManifest, $strBackupLabel,\n"
-            "$strLsnStart);\n"
+            "$strDbMasterPath, $strDbCopyPath, $strType, $strDbVersion, $bCompress, $strCompressType, $bCompressDict, $bHardLink,\n"
+            "$oBackupManifest, $strBackupLabel, $strLsnStart, $oLastManifest);\n"
             "&log(INFO, \"${strType} backup size = \" . fileSizeFormat($lBackupSizeTotal));\n"
             "\n\n"
             "undef($oStorageDbMaster);\n"
@@ -1709,11 +1905,13 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "push(\n"
             "@{$rhyFilter},\n"
-            "{strClass => STORAGE_FILTER_GZIP, rxyParam => [STORAGE_COMPRESS, false, cfgOption(CFGOPT_COMPRESS_LEVEL)]});\n"
+            "compressFilter(\n"
+            "$strCompressType, STORAGE_COMPRESS, cfgOption(CFGOPT_COMPRESS_LEVEL),\n"
+            "cfgOption(CFGOPT_COMPRESS_THREAD)));\n"
             "}\n"
             "\n\n\n"
             "my $oDestinationFileIo = $oStorageRepo->openWrite(\n"
-            "STORAGE_REPO_BACKUP . \"/${strBackupLabel}/${strFile}\" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),\n"
+            "STORAGE_REPO_BACKUP . \"/${strBackupLabel}/${strFile}\" . ($bCompress ? qw{.} . $strCompressType : ''),\n"
             "{rhyFilter => $rhyFilter,\n"
             "strCipherPass => defined($strCipherPassBackupSet) ? $strCipherPassBackupSet : undef});\n"
             "\n\n"
@@ -1756,14 +1954,28 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "logDebugMisc($strOperation, \"archive: ${strArchive} (${strArchiveFile})\");\n"
             "\n\n"
-            "my $bArchiveCompressed = $strArchiveFile =~ ('^.*\\.' . COMPRESS_EXT . '\\$');\n"
+            "my $strArchiveCompressType = compressTypeFromFile($strArchiveFile);\n"
+            "my $strBackupCompressType = $bCompress ? $strCompressType : undef;\n"
+            "\n\n"
+            "my $rhyFilterRead;\n"
+            "my $rhyFilterWrite;\n"
+            "\n"
+            "if (($strArchiveCompressType // '') ne ($strBackupCompressType // ''))\n"
+            "{\n"
+            "$rhyFilterRead = defined($strArchiveCompressType) ?\n"
+            "[compressFilter($strArchiveCompressType, STORAGE_DECOMPRESS)] : undef;\n"
+            "$rhyFilterWrite = defined($strBackupCompressType) ?\n"
+            "[compressFilter(\n"
+            "$strBackupCompressType, STORAGE_COMPRESS, cfgOption(CFGOPT_COMPRESS_LEVEL),\n"
+            "cfgOption(CFGOPT_COMPRESS_THREAD))] : undef;\n"
+            "}\n"
             "\n"
             "$oStorageRepo->copy(\n"
             "$oStorageRepo->openRead(STORAGE_REPO_ARCHIVE . \"/${strArchiveId}/${strArchiveFile}\",\n"
-            "{strCipherPass => $oArchiveInfo->cipherPassSub()}),\n"
+            "{strCipherPass => $oArchiveInfo->cipherPassSub(), rhyFilter => $rhyFilterRead}),\n"
             "$oStorageRepo->openWrite(STORAGE_REPO_BACKUP . \"/${strBackupLabel}/\" . MANIFEST_TARGET_PGDATA . qw{/} .\n"
-            "$oBackupManifest->walPath() . \"/${strArchive}\" . ($bCompress ? qw{.} . COMPRESS_EXT : ''),\n"
-            "{bPathCreate => true, strCipherPass => $strCipherPassBackupSet})\n"
+            "$oBackupManifest->walPath() . \"/${strArchive}\" . ($bCompress ? qw{.} . $strCompressType : ''),\n"
+            "{bPathCreate => true, strCipherPass => $strCipherPassBackupSet, rhyFilter => $rhyFilterWrite})\n"
             ");\n"
             "\n\n"
             "my $strPathLog = MANIFEST_TARGET_PGDATA . qw{/} . $oBackupManifest->walPath();\n"
@@ -1861,6 +2073,9 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n\n\n"
             "use constant LINK_LATEST => 'latest';\n"
             "push @EXPORT, qw(LINK_LATEST);\n"
+            "\n\n\n\n\n"
+            "use constant BACKUP_DICT_SAMPLE_FILE_MAX => 32;\n"
+            "push @EXPORT, qw(BACKUP_DICT_SAMPLE_FILE_MAX);\n"
             "\n\n\n\n\n\n"
             "sub backupRegExpGet\n"
             "{\n"
@@ -2047,6 +2262,45 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n"
             "push @EXPORT, qw(backupLabel);\n"
+            "\n\n\n\n\n\n\n\n"
+            "sub backupBlockIncrLsn\n"
+            "{\n"
+            "\n"
+            "my\n"
+            "(\n"
+            "$strOperation,\n"
+            "$oLastManifest,\n"
+            "$oBackupManifest,\n"
+            ") =\n"
+            "logDebugParam\n"
+            "(\n"
+            "__PACKAGE__ . '::backupBlockIncrLsn', \\@_,\n"
+            "{name => 'oLastManifest', trace => true},\n"
+            "{name => 'oBackupManifest', trace => true},\n"
+            ");\n"
+            "\n"
+            "my $lBlockIncrLsn = 0;\n"
+            "\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LSN_START) &&\n"
+            "$oLastManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START) &&\n"
+            "$oBackupManifest->test(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START) &&\n"
+            "substr($oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START), 0, 8) eq\n"
+            "substr($oBackupManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START), 0, 8) &&\n"
+            "$oLastManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID) eq\n"
+            "$oBackupManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID))\n"
+            "{\n"
+            "my ($strLsnHi, $strLsnLo) = split('/', $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LSN_START));\n"
+            "$lBlockIncrLsn = hex($strLsnHi) << 32 | hex($strLsnLo);\n"
+            "}\n"
+            "\n\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'lBlockIncrLsn', value => $lBlockIncrLsn, trace => true}\n"
+            ");\n"
+            "}\n"
+            "\n"
+            "push @EXPORT, qw(backupBlockIncrLsn);\n"
             "\n"
             "1;\n"
     },
@@ -2087,6 +2341,22 @@ static const EmbeddedModule embeddedModule[] =
             "use constant BACKUP_FILE_NOOP => 4;\n"
             "push @EXPORT, qw(BACKUP_FILE_NOOP);\n"
             "\n\n\n\n"
+            "sub backupManifestChecksumFastSet\n"
+            "{\n"
+            "my $oManifest = shift;\n"
+            "my $strRepoFile = shift;\n"
+            "my $strChecksumFast = shift;\n"
+            "\n\n"
+            "if (defined($strChecksumFast))\n"
+            "{\n"
+            "$oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST, $strChecksumFast);\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM_FAST);\n"
+            "}\n"
+            "}\n"
+            "\n\n\n\n"
             "sub backupManifestUpdate\n"
             "{\n"
             "\n"
@@ -2106,6 +2376,12 @@ static const EmbeddedModule embeddedModule[] =
             "$lSizeRepo,\n"
             "$strChecksumCopy,\n"
             "$rExtra,\n"
+            "$bCompressBypass,\n"
+            "$bCompressDict,\n"
+            "$strChecksumFastCopy,\n"
+            "$bBlockIncr,\n"
+            "$rstryBlockIncrChain,\n"
+            "$bZeroElide,\n"
             "$lSizeTotal,\n"
             "$lSizeCurrent,\n"
             "$lManifestSaveSize,\n"
@@ -2129,6 +2405,14 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'lSizeRepo', required => false, trace => true},\n"
             "{name => 'strChecksumCopy', required => false, trace => true},\n"
             "{name => 'rExtra', required => false, trace => true},\n"
+            "{name => 'bCompressBypass', required => false, trace => true},\n"
+            "{name => 'bCompressDict', required => false, trace => true},\n"
+            "{name => 'strChecksumFastCopy', required => false, trace => true},\n"
+            "{name => 'bBlockIncr', required => false, trace => true},\n"
+            "\n\n"
+            "{name => 'rstryBlockIncrChain', required => false, trace => true},\n"
+            "\n\n"
+            "{name => 'bZeroElide', required => false, trace => true},\n"
             "\n\n"
             "{name => 'lSizeTotal', trace => true},\n"
             "{name => 'lSizeCurrent', trace => true},\n"
@@ -2143,6 +2427,7 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "$oManifest->numericSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE, $lSizeCopy);\n"
             "$oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksumCopy);\n"
+            "backupManifestChecksumFastSet($oManifest, $strRepoFile, $strChecksumFastCopy);\n"
             "\n"
             "&log(DETAIL,\n"
             "'match file from prior backup ' . (defined($strHost) ? \"${strHost}:\" : '') . \"${strDbFile} (\" .\n"
@@ -2185,10 +2470,49 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "$oManifest->set(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $strChecksumCopy);\n"
             "}\n"
-            "\n\n"
+            "\n"
+            "backupManifestChecksumFastSet($oManifest, $strRepoFile, $lSizeCopy > 0 ? $strChecksumFastCopy : undef);\n"
+            "\n\n\n"
             "if ($iCopyResult == BACKUP_FILE_COPY || $iCopyResult == BACKUP_FILE_RECOPY)\n"
             "{\n"
             "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE);\n"
+            "\n"
+            "if ($bCompressBypass)\n"
+            "{\n"
+            "$oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_BYPASS);\n"
+            "}\n"
+            "\n"
+            "if ($bCompressDict)\n"
+            "{\n"
+            "$oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT, true);\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_COMPRESS_DICT);\n"
+            "}\n"
+            "\n"
+            "if ($bBlockIncr && defined($rstryBlockIncrChain))\n"
+            "{\n"
+            "$oManifest->set(\n"
+            "MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, $rstryBlockIncrChain);\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN);\n"
+            "}\n"
+            "\n"
+            "if ($bBlockIncr && $bZeroElide)\n"
+            "{\n"
+            "$oManifest->boolSet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE, true);\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "$oManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_ZERO_ELIDE);\n"
+            "}\n"
             "}\n"
             "\n\n"
             "if ($bChecksumPage)\n"
@@ -2713,6 +3037,12 @@ static const EmbeddedModule embeddedModule[] =
             "$lBackupSizeDelta += $lFileSize;\n"
             "$lBackupRepoSizeDelta += $lRepoSize;\n"
             "}\n"
+            "\n\n"
+            "foreach my $strChainReference (\n"
+            "@{$oBackupManifest->get(MANIFEST_SECTION_TARGET_FILE, $strFileKey, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN, false, [])})\n"
+            "{\n"
+            "$$oReferenceHash{$strChainReference} = true;\n"
+            "}\n"
             "}\n"
             "\n\n"
             "$self->numericSet(INFO_BACKUP_SECTION_BACKUP_CURRENT, $strBackupLabel, INFO_BACKUP_KEY_BACKUP_SIZE, $lBackupSize);\n"
@@ -7627,6 +7957,10 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "return\n"
             "{\n"
+            "CFGOPTVAL_COMPRESS_TYPE_GZ                                       => 'gz',\n"
+            "CFGOPTVAL_COMPRESS_TYPE_LZ4                                      => 'lz4',\n"
+            "CFGOPTVAL_COMPRESS_TYPE_ZST                                      => 'zst',\n"
+            "\n"
             "CFGOPTVAL_INFO_OUTPUT_TEXT                                       => 'text',\n"
             "CFGOPTVAL_INFO_OUTPUT_JSON                                       => 'json',\n"
             "\n"
@@ -7635,6 +7969,7 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "CFGOPTVAL_REPO_CIPHER_TYPE_NONE                                  => 'none',\n"
             "CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                           => 'aes-256-cbc',\n"
+            "CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM                           => 'aes-256-gcm',\n"
             "\n"
             "CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL                       => 'full',\n"
             "CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF                       => 'diff',\n"
@@ -7698,12 +8033,16 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "config =>\n"
             "[\n"
+            "'CFGOPTVAL_COMPRESS_TYPE_GZ',\n"
+            "'CFGOPTVAL_COMPRESS_TYPE_LZ4',\n"
+            "'CFGOPTVAL_COMPRESS_TYPE_ZST',\n"
             "'CFGOPTVAL_INFO_OUTPUT_TEXT',\n"
             "'CFGOPTVAL_INFO_OUTPUT_JSON',\n"
             "'CFGOPTVAL_LS_OUTPUT_TEXT',\n"
             "'CFGOPTVAL_LS_OUTPUT_JSON',\n"
             "'CFGOPTVAL_REPO_CIPHER_TYPE_NONE',\n"
             "'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC',\n"
+            "'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_GCM',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR',\n"
@@ -7757,24 +8096,35 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_ARCHIVE_PUSH_QUEUE_MAX',\n"
             "'CFGOPT_ARCHIVE_TIMEOUT',\n"
             "'CFGOPT_BACKUP_STANDBY',\n"
+            "'CFGOPT_BLOCK_INCR',\n"
             "'CFGOPT_BUFFER_SIZE',\n"
             "'CFGOPT_C',\n"
+            "'CFGOPT_CACHE_DROP',\n"
+            "'CFGOPT_CHECKSUM_FAST',\n"
             "'CFGOPT_CHECKSUM_PAGE',\n"
             "'CFGOPT_CMD_SSH',\n"
             "'CFGOPT_COMMAND',\n"
             "'CFGOPT_COMPRESS',\n"
+            "'CFGOPT_COMPRESS_DICT',\n"
             "'CFGOPT_COMPRESS_LEVEL',\n"
+            "'CFGOPT_COMPRESS_LEVEL_AUTO',\n"
             "'CFGOPT_COMPRESS_LEVEL_NETWORK',\n"
+            "'CFGOPT_COMPRESS_THREAD',\n"
+            "'CFGOPT_COMPRESS_TYPE',\n"
             "'CFGOPT_CONFIG',\n"
             "'CFGOPT_CONFIG_INCLUDE_PATH',\n"
             "'CFGOPT_CONFIG_PATH',\n"
             "'CFGOPT_DB_INCLUDE',\n"
             "'CFGOPT_DB_TIMEOUT',\n"
             "'CFGOPT_DELTA',\n"
+            "'CFGOPT_DIRECT_IO',\n"
             "'CFGOPT_EXCLUDE',\n"
             "'CFGOPT_FILTER',\n"
+            "'CFGOPT_FILTER_STAT',\n"
+            "'CFGOPT_FILTER_THREAD',\n"
             "'CFGOPT_FORCE',\n"
             "'CFGOPT_HOST_ID',\n"
+            "'CFGOPT_IO_QUEUE_DEPTH',\n"
             "'CFGOPT_LINK_ALL',\n"
             "'CFGOPT_LINK_MAP',\n"
             "'CFGOPT_LOCK_PATH',\n"
@@ -7918,6 +8268,7 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_TEST_DELAY',\n"
             "'CFGOPT_TEST_POINT',\n"
             "'CFGOPT_TYPE',\n"
+            "'CFGOPT_ZERO_ELIDE',\n"
             "'cfgCommandName',\n"
             "'cfgOptionIndex',\n"
             "'cfgOptionIndexTotal',\n"
@@ -8214,6 +8565,8 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(FILE_MANIFEST);\n"
             "use constant FILE_MANIFEST_COPY => FILE_MANIFEST . INI_COPY_EXT;\n"
             "push @EXPORT, qw(FILE_MANIFEST_COPY);\n"
+            "use constant FILE_COMPRESS_DICT => 'compress.dict';\n"
+            "push @EXPORT, qw(FILE_COMPRESS_DICT);\n"
             "\n\n\n\n"
             "use constant MANIFEST_DEFAULT_MATCH_FACTOR => 0.1;\n"
             "push @EXPORT, qw(MANIFEST_DEFAULT_MATCH_FACTOR);\n"
@@ -8282,10 +8635,14 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(MANIFEST_KEY_CHECKSUM_PAGE);\n"
             "use constant MANIFEST_KEY_COMPRESS => 'option-' . cfgOptionName(CFGOPT_COMPRESS);\n"
             "push @EXPORT, qw(MANIFEST_KEY_COMPRESS);\n"
+            "use constant MANIFEST_KEY_COMPRESS_DICT => 'option-' . cfgOptionName(CFGOPT_COMPRESS_DICT);\n"
+            "push @EXPORT, qw(MANIFEST_KEY_COMPRESS_DICT);\n"
             "use constant MANIFEST_KEY_COMPRESS_LEVEL => 'option-' . cfgOptionName(CFGOPT_COMPRESS_LEVEL);\n"
             "push @EXPORT, qw(MANIFEST_KEY_COMPRESS_LEVEL);\n"
             "use constant MANIFEST_KEY_COMPRESS_LEVEL_NETWORK => 'option-' . cfgOptionName(CFGOPT_COMPRESS_LEVEL_NETWORK);\n"
             "push @EXPORT, qw(MANIFEST_KEY_COMPRESS_LEVEL_NETWORK);\n"
+            "use constant MANIFEST_KEY_COMPRESS_TYPE => 'option-' . cfgOptionName(CFGOPT_COMPRESS_TYPE);\n"
+            "push @EXPORT, qw(MANIFEST_KEY_COMPRESS_TYPE);\n"
             "use constant MANIFEST_KEY_ONLINE => 'option-' . cfgOptionName(CFGOPT_ONLINE);\n"
             "push @EXPORT, qw(MANIFEST_KEY_ONLINE);\n"
             "use constant MANIFEST_KEY_DELTA => 'option-' . cfgOptionName(CFGOPT_DELTA);\n"
@@ -8306,12 +8663,20 @@ static const EmbeddedModule embeddedModule[] =
             "use constant MANIFEST_KEY_DB_VERSION => 'db-version';\n"
             "push @EXPORT, qw(MANIFEST_KEY_DB_VERSION);\n"
             "\n\n"
+            "use constant MANIFEST_SUBKEY_BLOCK_INCR_CHAIN => 'block-incr-chain';\n"
+            "push @EXPORT, qw(MANIFEST_SUBKEY_BLOCK_INCR_CHAIN);\n"
             "use constant MANIFEST_SUBKEY_CHECKSUM => 'checksum';\n"
             "push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM);\n"
+            "use constant MANIFEST_SUBKEY_CHECKSUM_FAST => 'checksum-fast';\n"
+            "push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_FAST);\n"
             "use constant MANIFEST_SUBKEY_CHECKSUM_PAGE => 'checksum-page';\n"
             "push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_PAGE);\n"
             "use constant MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR => 'checksum-page-error';\n"
             "push @EXPORT, qw(MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR);\n"
+            "use constant MANIFEST_SUBKEY_COMPRESS_BYPASS => 'compress-bypass';\n"
+            "push @EXPORT, qw(MANIFEST_SUBKEY_COMPRESS_BYPASS);\n"
+            "use constant MANIFEST_SUBKEY_COMPRESS_DICT => 'compress-dict';\n"
+            "push @EXPORT, qw(MANIFEST_SUBKEY_COMPRESS_DICT);\n"
             "use constant MANIFEST_SUBKEY_DESTINATION => 'destination';\n"
             "push @EXPORT, qw(MANIFEST_SUBKEY_DESTINATION);\n"
             "use constant MANIFEST_SUBKEY_FILE => 'file';\n"
@@ -8342,6 +8707,8 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(MANIFEST_SUBKEY_TABLESPACE_NAME);\n"
             "use constant MANIFEST_SUBKEY_USER => 'user';\n"
             "push @EXPORT, qw(MANIFEST_SUBKEY_USER);\n"
+            "use constant MANIFEST_SUBKEY_ZERO_ELIDE => 'zero-elide';\n"
+            "push @EXPORT, qw(MANIFEST_SUBKEY_ZERO_ELIDE);\n"
             "\n\n\n\n"
             "use constant DB_PATH_ARCHIVESTATUS => 'archive_status';\n"
             "push @EXPORT, qw(DB_PATH_ARCHIVESTATUS);\n"
@@ -9200,12 +9567,40 @@ static const EmbeddedModule embeddedModule[] =
             "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM));\n"
             "}\n"
             "\n\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST))\n"
+            "{\n"
+            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST,\n"
+            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_FAST));\n"
+            "}\n"
+            "\n\n"
             "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE))\n"
             "{\n"
             "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE,\n"
             "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE));\n"
             "}\n"
             "\n\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_BYPASS))\n"
+            "{\n"
+            "$self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_BYPASS, true);\n"
+            "}\n"
+            "\n\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_DICT))\n"
+            "{\n"
+            "$self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_COMPRESS_DICT, true);\n"
+            "}\n"
+            "\n\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN))\n"
+            "{\n"
+            "$self->set(\n"
+            "MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN,\n"
+            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_BLOCK_INCR_CHAIN));\n"
+            "}\n"
+            "\n\n"
+            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_ZERO_ELIDE))\n"
+            "{\n"
+            "$self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_ZERO_ELIDE, true);\n"
+            "}\n"
+            "\n\n"
             "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER))\n"
             "{\n"
             "$self->set(\n"
@@ -9512,6 +9907,8 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(OP_NOOP);\n"
             "use constant OP_EXIT => 'exit';\n"
             "push @EXPORT, qw(OP_EXIT);\n"
+            "use constant OP_IO_STAT => 'ioStat';\n"
+            "push @EXPORT, qw(OP_IO_STAT);\n"
             "\n\n\n\n"
             "sub new\n"
             "{\n"
@@ -10129,6 +10526,8 @@ static const EmbeddedModule embeddedModule[] =
             "use pgBackRest::Protocol::Remote::Master;\n"
             "use pgBackRest::Version;\n"
             "\n\n\n\n\n"
+            "use constant OP_BACKUP_DICT => 'backupDict';\n"
+            "push @EXPORT, qw(OP_BACKUP_DICT);\n"
             "use constant OP_BACKUP_FILE => 'backupFile';\n"
             "push @EXPORT, qw(OP_BACKUP_FILE);\n"
             "\n\n"
@@ -10600,7 +10999,9 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "use pgBackRest::Common::Exception;\n"
             "use pgBackRest::Common::Log;\n"
+            "use pgBackRest::Common::String;\n"
             "use pgBackRest::Config::Config;\n"
+            "use pgBackRest::Protocol::Base::Master;\n"
             "use pgBackRest::Protocol::Local::Master;\n"
             "use pgBackRest::Version;\n"
             "\n\n\n\n"
@@ -10630,6 +11031,8 @@ static const EmbeddedModule embeddedModule[] =
             "$self->{hHostMap} = {};\n"
             "$self->{hyHost} = undef;\n"
             "\n\n"
+            "$self->{hIoStat} = {};\n"
+            "\n\n"
             "$self->reset();\n"
             "\n\n"
             "return logDebugReturn\n"
@@ -10968,6 +11371,11 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "delete($self->{hLocalMap}{$hLocal->{hndIn}});\n"
             "\n\n"
+            "if (cfgOptionValid(CFGOPT_FILTER_STAT) && cfgOption(CFGOPT_FILTER_STAT))\n"
+            "{\n"
+            "$self->ioStatAdd($hLocal->{oLocal}->cmdExecute(OP_IO_STAT));\n"
+            "}\n"
+            "\n\n"
             "$hLocal->{oLocal}->close(true);\n"
             "\n\n"
             "undef(${$self->{hyLocal}}[$iLocalIdx]);\n"
@@ -11002,6 +11410,40 @@ static const EmbeddedModule embeddedModule[] =
             "return \\@hyResult;\n"
             "}\n"
             "\n\n\n\n\n\n"
+            "sub ioStatAdd\n"
+            "{\n"
+            "my $self = shift;\n"
+            "my $hIoStat = shift;\n"
+            "\n"
+            "foreach my $strName (keys(%{$hIoStat}))\n"
+            "{\n"
+            "foreach my $strKey (keys(%{$hIoStat->{$strName}}))\n"
+            "{\n"
+            "$self->{hIoStat}{$strName}{$strKey} += $hIoStat->{$strName}{$strKey};\n"
+            "}\n"
+            "}\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub ioStatLog\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my ($strOperation) = logDebugParam(__PACKAGE__ . '->ioStatLog');\n"
+            "\n"
+            "foreach my $strName (sort(keys(%{$self->{hIoStat}})))\n"
+            "{\n"
+            "my $hIoStat = $self->{hIoStat}{$strName};\n"
+            "\n"
+            "&log(INFO, sprintf(\n"
+            "'filter stat %s: cpu %.3fs, wall %.3fs, in %s, out %s', $strName, $hIoStat->{cpu} / 1000000,\n"
+            "$hIoStat->{wall} / 1000000, fileSizeFormat($hIoStat->{in}), fileSizeFormat($hIoStat->{out})));\n"
+            "}\n"
+            "\n"
+            "$self->{hIoStat} = {};\n"
+            "\n\n"
+            "return logDebugReturn($strOperation);\n"
+            "}\n"
+            "\n\n\n\n\n\n"
             "sub queueJob\n"
             "{\n"
             "my $self = shift;\n"
@@ -11918,11 +12360,17 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(STORAGE_DECRYPT);\n"
             "use constant CIPHER_MAGIC => 'Salted__';\n"
             "push @EXPORT, qw(CIPHER_MAGIC);\n"
+            "use constant CIPHER_MAGIC_CHUNK => 'GcmChunk';\n"
+            "push @EXPORT, qw(CIPHER_MAGIC_CHUNK);\n"
             "\n\n\n\n"
             "use constant STORAGE_FILTER_CIPHER_BLOCK => 'pgBackRest::Storage::Filter::CipherBlock';\n"
             "push @EXPORT, qw(STORAGE_FILTER_CIPHER_BLOCK);\n"
             "use constant STORAGE_FILTER_GZIP => 'pgBackRest::Storage::Filter::Gzip';\n"
             "push @EXPORT, qw(STORAGE_FILTER_GZIP);\n"
+            "use constant STORAGE_FILTER_LZ4 => 'pgBackRest::Storage::Filter::Lz4';\n"
+            "push @EXPORT, qw(STORAGE_FILTER_LZ4);\n"
+            "use constant STORAGE_FILTER_ZST => 'pgBackRest::Storage::Filter::Zst';\n"
+            "push @EXPORT, qw(STORAGE_FILTER_ZST);\n"
             "use constant STORAGE_FILTER_SHA => 'pgBackRest::Storage::Filter::Sha';\n"
             "push @EXPORT, qw(STORAGE_FILTER_SHA);\n"
             "\n\n\n\n\n\n\n"
@@ -12200,6 +12648,14 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n\n\n"
             "use constant COMPRESS_EXT => 'gz';\n"
             "push @EXPORT, qw(COMPRESS_EXT);\n"
+            "use constant COMPRESS_EXT_LZ4 => 'lz4';\n"
+            "push @EXPORT, qw(COMPRESS_EXT_LZ4);\n"
+            "use constant COMPRESS_EXT_ZST => 'zst';\n"
+            "push @EXPORT, qw(COMPRESS_EXT_ZST);\n"
+            "\n\n"
+            "use constant COMPRESS_EXT_LIST => join('|', COMPRESS_EXT, COMPRESS_EXT_LZ4, COMPRESS_EXT_ZST);\n"
+            "use constant COMPRESS_EXT_REGEXP => '(\\\\.(' . COMPRESS_EXT_LIST . ')){0,1}';\n"
+            "push @EXPORT, qw(COMPRESS_EXT_REGEXP);\n"
             "\n\n\n\n"
             "use constant STORAGE_TEMP_EXT => PROJECT_EXE . '.tmp';\n"
             "push @EXPORT, qw(STORAGE_TEMP_EXT);\n"
@@ -12217,6 +12673,41 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n"
             "push @EXPORT, qw(storageLocal);\n"
+            "\n\n\n\n\n\n"
+            "sub compressFilter\n"
+            "{\n"
+            "my $strCompressType = shift;\n"
+            "my $strMode = shift;\n"
+            "my $iLevel = shift;\n"
+            "my $iThread = shift;\n"
+            "\n"
+            "if ($strCompressType eq COMPRESS_EXT_LZ4)\n"
+            "{\n"
+            "return {strClass => STORAGE_FILTER_LZ4, rxyParam => [$strMode, defined($iLevel) ? $iLevel : 0]};\n"
+            "}\n"
+            "\n"
+            "if ($strCompressType eq COMPRESS_EXT_ZST)\n"
+            "{\n"
+            "return {\n"
+            "strClass => STORAGE_FILTER_ZST,\n"
+            "rxyParam => [$strMode, defined($iLevel) ? $iLevel : 3, defined($iThread) ? $iThread : 1]};\n"
+            "}\n"
+            "\n"
+            "return {strClass => STORAGE_FILTER_GZIP, rxyParam => [$strMode, false, defined($iLevel) ? $iLevel : 6]};\n"
+            "}\n"
+            "\n"
+            "push @EXPORT, qw(compressFilter);\n"
+            "\n\n\n\n"
+            "sub compressTypeFromFile\n"
+            "{\n"
+            "my $strFile = shift;\n"
+            "\n"
+            "my ($strCompressType) = $strFile =~ ('\\.(' . COMPRESS_EXT_LIST . ')$');\n"
+            "\n"
+            "return $strCompressType;\n"
+            "}\n"
+            "\n"
+            "push @EXPORT, qw(compressTypeFromFile);\n"
             "\n"
             "1;\n"
     },
@@ -13074,7 +13565,8 @@ static const EmbeddedModule embeddedModule[] =
             "my $lSizeRead = $oFileIo->read(\\$tMagicSignature, length(CIPHER_MAGIC));\n"
             "$oFileIo->close();\n"
             "\n"
-            "if (substr($tMagicSignature, 0, length(CIPHER_MAGIC)) eq CIPHER_MAGIC)\n"
+            "if (substr($tMagicSignature, 0, length(CIPHER_MAGIC)) eq CIPHER_MAGIC ||\n"
+            "substr($tMagicSignature, 0, length(CIPHER_MAGIC_CHUNK)) eq CIPHER_MAGIC_CHUNK)\n"
             "{\n"
             "$bEncrypted = true;\n"
             "}\n"
@@ -22,6 +22,7 @@ STRING_EXTERN(PROTOCOL_GREETING_VERSION_STR,                        PROTOCOL_GRE
 
 STRING_EXTERN(PROTOCOL_COMMAND_NOOP_STR,                            PROTOCOL_COMMAND_NOOP);
 STRING_EXTERN(PROTOCOL_COMMAND_EXIT_STR,                            PROTOCOL_COMMAND_EXIT);
+STRING_EXTERN(PROTOCOL_COMMAND_IO_STAT_STR,                         PROTOCOL_COMMAND_IO_STAT);
 
 STRING_EXTERN(PROTOCOL_ERROR_STR,                                   PROTOCOL_ERROR);
 STRING_EXTERN(PROTOCOL_ERROR_STACK_STR,                             PROTOCOL_ERROR_STACK);
@@ -28,6 +28,8 @@ Constants
 
 #define PROTOCOL_COMMAND_EXIT                                       "exit"
     STRING_DECLARE(PROTOCOL_COMMAND_EXIT_STR);
+#define PROTOCOL_COMMAND_IO_STAT                                    "ioStat"
+    STRING_DECLARE(PROTOCOL_COMMAND_IO_STAT_STR);
 #define PROTOCOL_COMMAND_NOOP                                       "noop"
     STRING_DECLARE(PROTOCOL_COMMAND_NOOP_STR);
 
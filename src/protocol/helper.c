@@ -8,6 +8,7 @@ Protocol Helper
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/exec.h"
+#include "common/io/stat.h"
 #include "common/memContext.h"
 #include "config/config.h"
 #include "config/exec.h"
@@ -419,6 +420,34 @@ protocolKeepAlive(void)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Add IO statistics from all local processes to the totals for this process
+***********************************************************************************************************************************/
+void
+protocolLocalIoStat(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    if (protocolHelper.memContext != NULL)
+    {
+        for (unsigned int clientIdx  = 0; clientIdx < protocolHelper.clientLocalSize; clientIdx++)
+        {
+            if (protocolHelper.clientLocal[clientIdx].client != NULL)
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    ioStatTotalAdd(
+                        protocolClientExecute(
+                            protocolHelper.clientLocal[clientIdx].client, protocolCommandNew(PROTOCOL_COMMAND_IO_STAT_STR), true));
+                }
+                MEM_CONTEXT_TEMP_END();
+            }
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Free the protocol objects and shutdown processes
 ***********************************************************************************************************************************/
@@ -28,6 +28,7 @@ Functions
 ***********************************************************************************************************************************/
 void protocolKeepAlive(void);
 ProtocolClient *protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int protocolId);
+void protocolLocalIoStat(void);
 ProtocolClient *protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId);
 
 /***********************************************************************************************************************************
@@ -6,6 +6,7 @@ Protocol Server
 #include <string.h>
 
 #include "common/debug.h"
+#include "common/io/stat.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
@@ -178,6 +179,8 @@ protocolServerProcess(ProtocolServer *this)
                         protocolServerResponse(this, NULL);
                     else if (strEq(command, PROTOCOL_COMMAND_EXIT_STR))
                         exit = true;
+                    else if (strEq(command, PROTOCOL_COMMAND_IO_STAT_STR))
+                        protocolServerResponse(this, ioStatTotal());
                     else
                         THROW_FMT(ProtocolError, "invalid command '%s'", strPtr(command));
                 }
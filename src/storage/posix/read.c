@@ -4,15 +4,19 @@ Posix Storage Read
 #include "build.auto.h"
 
 #include <fcntl.h>
+#include <string.h>
 #include <unistd.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/io/read.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
 #include "storage/posix/read.h"
+#include "storage/posix/readAhead.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/read.intern.h"
 
 /***********************************************************************************************************************************
@@ -29,6 +33,18 @@ typedef struct StorageReadPosix
 
     int handle;
     bool eof;
+    uint64_t offset;                                                // Current offset, used to drop data behind the read
+    Buffer *cacheResident;                                          // Pages in the page cache when opened (not dropped)
+
+    bool direct;                                                    // Read with direct IO?
+    Buffer *directBuffer;                                           // Aligned buffer for direct IO
+    bool readAheadBegin;                                            // Start read ahead on the first read?
+    StoragePosixUring *uring;                                       // Read ahead with io_uring (NULL when not used)
+    StoragePosixReadAhead *readAhead;                               // Read ahead with a thread (NULL when not used)
+
+    const Buffer *block;                                            // Block read with direct IO or read ahead
+    size_t blockOffset;                                             // Offset of data not yet copied from the block
+    bool blockEof;                                                  // Is the block the last in the file?
 } StorageReadPosix;
 
 /***********************************************************************************************************************************
@@ -67,7 +83,10 @@ storageReadPosixOpen(THIS_VOID)
     bool result = false;
 
     // Open the file
-    this->handle = open(strPtr(this->interface.name), O_RDONLY, 0);
+    if (this->direct)
+        this->handle = storagePosixDirectOpen(this->interface.name, O_RDONLY, 0);
+    else
+        this->handle = open(strPtr(this->interface.name), O_RDONLY, 0);
 
     // Handle errors
     if (this->handle == -1)
@@ -84,6 +103,29 @@ storageReadPosixOpen(THIS_VOID)
     if (this->handle != -1)
     {
         memContextCallbackSet(this->memContext, storageReadPosixFreeResource, this);
+        storagePosixCacheSequential(this->handle);
+
+        // Get the pages that are already in the page cache before anything is read so they are not dropped
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->cacheResident = storagePosixCacheResident(this->handle);
+        }
+        MEM_CONTEXT_END();
+
+        // Read ahead when more than one read can be in flight. Read ahead starts on the first read so nothing is read ahead when
+        // the file is copied in the kernel instead, see storageWriteCopy().
+        if (storagePosixQueueDepth() > 1)
+            this->readAheadBegin = true;
+        // Else allocate the direct IO buffer since there are no read ahead blocks, which are aligned, to read into
+        else if (this->direct)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->directBuffer = storagePosixDirectBufferNew(ioBufferSize());
+            }
+            MEM_CONTEXT_END();
+        }
+
         result = true;
     }
 
@@ -107,10 +149,80 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
     ASSERT(this != NULL && this->handle != -1);
     ASSERT(buffer != NULL && !bufFull(buffer));
 
+    // Start read ahead, with io_uring when available or else with a thread
+    if (this->readAheadBegin)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+#ifdef HAVE_LIBURING
+            this->uring = storagePosixUringNew(this->handle, this->interface.name, false, storagePosixQueueDepth(), ioBufferSize());
+
+            if (this->uring == NULL)
+#endif
+            {
+                this->readAhead = storagePosixReadAheadNew(
+                    this->handle, this->interface.name, storagePosixQueueDepth(), ioBufferSize());
+            }
+        }
+        MEM_CONTEXT_END();
+
+        this->readAheadBegin = false;
+    }
+
     // Read if EOF has not been reached
     ssize_t actualBytes = 0;
 
-    if (!this->eof)
+    if (!this->eof && (this->direct || this->uring != NULL || this->readAhead != NULL))
+    {
+        // Get the next block when all the data has been copied from the current block
+        if (this->block == NULL || this->blockOffset == bufUsed(this->block))
+        {
+#ifdef HAVE_LIBURING
+            if (this->uring != NULL)
+                this->block = storagePosixUringRead(this->uring);
+            else
+#endif
+            if (this->readAhead != NULL)
+                this->block = storagePosixReadAheadRead(this->readAhead);
+            else
+            {
+                // Reads are always the full size of the aligned buffer so the file offset remains aligned
+                ssize_t blockBytes = read(this->handle, bufPtr(this->directBuffer), bufSize(this->directBuffer));
+
+                // Error occurred during read
+                if (blockBytes == -1)
+                    THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strPtr(this->interface.name));
+
+                bufUsedSet(this->directBuffer, (size_t)blockBytes);
+                this->block = this->directBuffer;
+            }
+
+            this->blockOffset = 0;
+
+            // Drop the data just read from the page cache in case the file system does not support direct IO
+            storagePosixCacheDropRead(this->handle, this->cacheResident, this->offset, bufUsed(this->block));
+            this->offset += bufUsed(this->block);
+
+            // If less data than expected was read then EOF (see the note about growing files below)
+            if (bufUsed(this->block) != bufSize(this->block))
+                this->blockEof = true;
+        }
+
+        // Copy as much data as possible from the block
+        actualBytes = (ssize_t)(bufUsed(this->block) - this->blockOffset);
+
+        if ((size_t)actualBytes > bufRemains(buffer))
+            actualBytes = (ssize_t)bufRemains(buffer);
+
+        memcpy(bufRemainsPtr(buffer), bufPtr(this->block) + this->blockOffset, (size_t)actualBytes);
+        bufUsedInc(buffer, (size_t)actualBytes);
+        this->blockOffset += (size_t)actualBytes;
+
+        // EOF when the file has been read to the end and all the data has been copied
+        if (this->blockEof && this->blockOffset == bufUsed(this->block))
+            this->eof = true;
+    }
+    else if (!this->eof)
     {
         // Read and handle errors
         size_t expectedBytes = bufRemains(buffer);
@@ -123,6 +235,10 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
         // Update amount of buffer used
         bufUsedInc(buffer, (size_t)actualBytes);
 
+        // Drop the data just read from the page cache
+        storagePosixCacheDropRead(this->handle, this->cacheResident, this->offset, (uint64_t)actualBytes);
+        this->offset += (uint64_t)actualBytes;
+
         // If less data than expected was read then EOF.  The file may not actually be EOF but we are not concerned with files that
         // are growing.  Just read up to the point where the file is being extended.
         if ((size_t)actualBytes != expectedBytes)
@@ -146,6 +262,16 @@ storageReadPosixClose(THIS_VOID)
 
     ASSERT(this != NULL);
 
+#ifdef HAVE_LIBURING
+    // Wait for reads in flight and free the io_uring blocks
+    storagePosixUringFree(this->uring);
+    this->uring = NULL;
+#endif
+
+    // Stop the read ahead thread before the handle is closed
+    storagePosixReadAheadFree(this->readAhead);
+    this->readAhead = NULL;
+
     storageReadPosixFreeResource(this);
     memContextCallbackClear(this->memContext);
     this->handle = -1;
@@ -225,6 +351,7 @@ storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissin
 
         driver->storage = storage;
         driver->handle = -1;
+        driver->direct = storagePosixDirect();
 
         this = storageReadNew(driver, &driver->interface);
     }
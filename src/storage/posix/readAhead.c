@@ -0,0 +1,246 @@
+/***********************************************************************************************************************************
+Posix Storage Read Ahead
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "storage/posix/readAhead.h"
+#include "storage/posix/storage.intern.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_READ_AHEAD_TYPE                               StoragePosixReadAhead
+#define STORAGE_POSIX_READ_AHEAD_PREFIX                             storagePosixReadAhead
+
+typedef struct StoragePosixReadAheadBlock
+{
+    Buffer *buffer;                                                 // Block returned to the caller
+    unsigned char *data;                                            // Block data filled by the thread
+    size_t size;                                                    // Block size
+    bool full;                                                      // Has the block been read and not yet released by the caller?
+    ssize_t result;                                                 // Bytes read or -1 on error
+    int errNo;                                                      // Error number when the read failed
+} StoragePosixReadAheadBlock;
+
+struct StoragePosixReadAhead
+{
+    MemContext *memContext;                                         // Object mem context
+    int handle;                                                     // File handle
+    const String *name;                                             // File name used in errors
+
+    pthread_mutex_t mutex;                                          // Protects block state shared with the thread
+    pthread_cond_t change;                                          // Signaled when a block is filled or released, or on shutdown
+    pthread_t thread;                                               // Thread that fills blocks
+    bool threadStarted;                                             // Has the thread been started?
+    bool shutdown;                                                  // Should the thread exit?
+
+    unsigned int blockTotal;                                        // Total blocks
+    StoragePosixReadAheadBlock *blockList;                          // Blocks
+    unsigned int blockIdx;                                          // Block to return on the next read
+    bool blockReleased;                                             // Has the block returned by the previous read been released?
+    bool eof;                                                       // Has the last block been returned?
+};
+
+/***********************************************************************************************************************************
+Stop the thread when freed
+
+The thread only uses the block data, which is raw memory in the object mem context, so it is still valid when the thread is stopped
+after the block buffers have been freed.
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_POSIX_READ_AHEAD, LOG, logLevelTrace)
+{
+    if (this->threadStarted)
+    {
+        pthread_mutex_lock(&this->mutex);
+        this->shutdown = true;
+        pthread_cond_broadcast(&this->change);
+        pthread_mutex_unlock(&this->mutex);
+
+        pthread_join(this->thread, NULL);
+    }
+
+    pthread_cond_destroy(&this->change);
+    pthread_mutex_destroy(&this->mutex);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+OBJECT_DEFINE_FREE(STORAGE_POSIX_READ_AHEAD);
+
+/***********************************************************************************************************************************
+Fill blocks in file order until EOF, an error, or shutdown
+
+Blocks are read at explicit offsets so the file position of the handle is not used or changed.  A block with less data than the
+block size indicates EOF, as in storageReadPosix(), and the thread exits after filling it.  Errors are stored in the block so the
+caller can throw them when the block is read.
+***********************************************************************************************************************************/
+static void
+storagePosixReadAheadFill(StoragePosixReadAhead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_READ_AHEAD, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    unsigned int fillIdx = 0;
+    uint64_t offset = 0;
+    bool done = false;
+
+    pthread_mutex_lock(&this->mutex);
+
+    do
+    {
+        StoragePosixReadAheadBlock *block = &this->blockList[fillIdx];
+
+        // Wait for the caller to release the block
+        while (!this->shutdown && block->full)
+            pthread_cond_wait(&this->change, &this->mutex);
+
+        if (this->shutdown)
+            break;
+
+        // Read without holding the mutex so the caller can process other blocks
+        pthread_mutex_unlock(&this->mutex);
+
+        ssize_t result = pread(this->handle, block->data, block->size, (off_t)offset);
+        int errNo = errno;
+
+        pthread_mutex_lock(&this->mutex);
+
+        block->result = result;
+        block->errNo = errNo;
+        block->full = true;
+        pthread_cond_broadcast(&this->change);
+
+        done = result != (ssize_t)block->size;
+        offset += block->size;
+        fillIdx = (fillIdx + 1) % this->blockTotal;
+    }
+    while (!done);
+
+    pthread_mutex_unlock(&this->mutex);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read ahead thread
+***********************************************************************************************************************************/
+static void *
+storagePosixReadAheadMain(void *param)
+{
+    storagePosixReadAheadFill(param);
+    return NULL;
+}
+
+/***********************************************************************************************************************************
+Read the next block of the file
+
+The block returned by the previous call is released so the thread can fill it again.  The block returned is only valid until the
+next call.
+***********************************************************************************************************************************/
+const Buffer *
+storagePosixReadAheadRead(StoragePosixReadAhead *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_READ_AHEAD, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->eof);
+
+    pthread_mutex_lock(&this->mutex);
+
+    // Release the block returned by the previous read
+    if (!this->blockReleased)
+    {
+        this->blockList[this->blockIdx].full = false;
+        this->blockIdx = (this->blockIdx + 1) % this->blockTotal;
+        pthread_cond_broadcast(&this->change);
+    }
+
+    // Wait for the next block in file order to be filled
+    StoragePosixReadAheadBlock *block = &this->blockList[this->blockIdx];
+
+    while (!block->full)
+        pthread_cond_wait(&this->change, &this->mutex);
+
+    this->blockReleased = false;
+
+    pthread_mutex_unlock(&this->mutex);
+
+    if (block->result == -1)
+        THROW_SYS_ERROR_CODE_FMT(block->errNo, FileReadError, "unable to read '%s'", strPtr(this->name));
+
+    bufUsedSet(block->buffer, (size_t)block->result);
+
+    if (bufUsed(block->buffer) != bufSize(block->buffer))
+        this->eof = true;
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, block->buffer);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+StoragePosixReadAhead *
+storagePosixReadAheadNew(int handle, const String *name, unsigned int blockTotal, size_t bufferSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, handle);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(UINT, blockTotal);
+        FUNCTION_LOG_PARAM(SIZE, bufferSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(handle != -1);
+    ASSERT(name != NULL);
+    ASSERT(blockTotal > 1);
+    ASSERT(bufferSize > 0);
+
+    StoragePosixReadAhead *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StoragePosixReadAhead")
+    {
+        this = memNew(sizeof(StoragePosixReadAhead));
+        this->memContext = MEM_CONTEXT_NEW();
+        this->handle = handle;
+        this->name = strDup(name);
+        this->blockReleased = true;
+
+        pthread_mutex_init(&this->mutex, NULL);
+        pthread_cond_init(&this->change, NULL);
+
+        memContextCallbackSet(this->memContext, storagePosixReadAheadFreeResource, this);
+
+        // Create aligned blocks so direct IO can be used
+        this->blockTotal = blockTotal;
+        this->blockList = memNew(sizeof(StoragePosixReadAheadBlock) * blockTotal);
+
+        for (unsigned int blockIdx = 0; blockIdx < this->blockTotal; blockIdx++)
+        {
+            StoragePosixReadAheadBlock *block = &this->blockList[blockIdx];
+
+            block->buffer = storagePosixDirectBufferNew(bufferSize);
+            block->data = bufPtr(block->buffer);
+            block->size = bufSize(block->buffer);
+        }
+
+        // Start reading
+        errno = pthread_create(&this->thread, NULL, storagePosixReadAheadMain, this);
+        THROW_ON_SYS_ERROR(errno != 0, KernelError, "unable to create read ahead thread");
+
+        this->threadStarted = true;
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_POSIX_READ_AHEAD, this);
+}
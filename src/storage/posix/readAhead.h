@@ -0,0 +1,44 @@
+/***********************************************************************************************************************************
+Posix Storage Read Ahead
+
+Reads a file ahead of the caller in a helper thread so the next blocks are being read while the caller processes the current block,
+e.g. while filters compress and encrypt it. This is used when more than one read should be in flight but io_uring is not available
+(see storagePosixUringNew()). Blocks are returned in file order and are aligned so they can also be used for direct IO.
+
+Each file uses queue depth * buffer size memory for blocks.
+***********************************************************************************************************************************/
+#ifndef STORAGE_POSIX_READAHEAD_H
+#define STORAGE_POSIX_READAHEAD_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StoragePosixReadAhead StoragePosixReadAhead;
+
+#include "common/type/buffer.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+StoragePosixReadAhead *storagePosixReadAheadNew(int handle, const String *name, unsigned int blockTotal, size_t bufferSize);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+const Buffer *storagePosixReadAheadRead(StoragePosixReadAhead *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void storagePosixReadAheadFree(StoragePosixReadAhead *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_POSIX_READ_AHEAD_TYPE                                                                                 \
+    StoragePosixReadAhead *
+#define FUNCTION_LOG_STORAGE_POSIX_READ_AHEAD_FORMAT(value, buffer, bufferSize)                                                    \
+    objToLog(value, "StoragePosixReadAhead", buffer, bufferSize)
+
+#endif
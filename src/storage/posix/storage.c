@@ -1,6 +1,11 @@
 /***********************************************************************************************************************************
 Posix Storage
 ***********************************************************************************************************************************/
+// Required for O_DIRECT on Linux
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
 #include "build.auto.h"
 
 #include <dirent.h>
@@ -9,9 +14,16 @@ Posix Storage
 #include <limits.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
+#ifdef __linux__
+    #include <linux/fs.h>
+#endif
+
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
@@ -42,6 +54,379 @@ struct StoragePosix
     StorageInterface interface;                                     // Storage interface
 };
 
+/***********************************************************************************************************************************
+Drop file data from the page cache?
+
+Disabled by default and enabled after options have been loaded when requested by the user.
+***********************************************************************************************************************************/
+static bool cacheDrop = false;
+
+/***********************************************************************************************************************************
+Get/set drop file data from the page cache
+***********************************************************************************************************************************/
+bool
+storagePosixCacheDrop(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(cacheDrop);
+}
+
+void
+storagePosixCacheDropSet(bool enabled)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, enabled);
+    FUNCTION_TEST_END();
+
+    cacheDrop = enabled;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read and write files with direct IO?
+
+Disabled by default and enabled after options have been loaded when requested by the user.
+***********************************************************************************************************************************/
+static bool directIo = false;
+
+/***********************************************************************************************************************************
+Get/set read and write files with direct IO
+***********************************************************************************************************************************/
+bool
+storagePosixDirect(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(directIo);
+}
+
+void
+storagePosixDirectSet(bool enabled)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, enabled);
+    FUNCTION_TEST_END();
+
+    directIo = enabled;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Reads or writes in flight for each file
+
+Only one at a time by default.  More than one uses io_uring when available (see storagePosixUringNew()).  Otherwise reads are
+done ahead by a thread (see storagePosixReadAheadNew()) and writes are one at a time.
+***********************************************************************************************************************************/
+static unsigned int queueDepth = 1;
+
+/***********************************************************************************************************************************
+Get/set reads or writes in flight for each file
+***********************************************************************************************************************************/
+unsigned int
+storagePosixQueueDepth(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(queueDepth);
+}
+
+void
+storagePosixQueueDepthSet(unsigned int depth)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, depth);
+    FUNCTION_TEST_END();
+
+    ASSERT(depth > 0);
+
+    queueDepth = depth;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Create a buffer for direct IO
+
+The buffer is aligned and the size is rounded up to a multiple of STORAGE_POSIX_DIRECT_ALIGN.  The buffer memory is allocated in the
+current mem context so it is freed along with the driver that uses it.
+***********************************************************************************************************************************/
+Buffer *
+storagePosixDirectBufferNew(size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(size > 0);
+
+    size = (size + STORAGE_POSIX_DIRECT_ALIGN - 1) / STORAGE_POSIX_DIRECT_ALIGN * STORAGE_POSIX_DIRECT_ALIGN;
+
+    // Allocate enough extra memory to align the start of the buffer
+    uintptr_t memory = (uintptr_t)memNewRaw(size + STORAGE_POSIX_DIRECT_ALIGN - 1);
+    void *buffer = (void *)((memory + STORAGE_POSIX_DIRECT_ALIGN - 1) / STORAGE_POSIX_DIRECT_ALIGN * STORAGE_POSIX_DIRECT_ALIGN);
+
+    FUNCTION_TEST_RETURN(bufNewUseC(buffer, size));
+}
+
+/***********************************************************************************************************************************
+Open a file for direct IO
+
+If the platform does not support direct IO or the file system rejects it then the file is opened normally.  In either case the
+caller must still transfer data with aligned buffers at aligned offsets, except for the last write (see
+storagePosixDirectDisable()).
+***********************************************************************************************************************************/
+int
+storagePosixDirectOpen(const String *name, int flags, mode_t mode)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(INT, flags);
+        FUNCTION_TEST_PARAM(MODE, mode);
+    FUNCTION_TEST_END();
+
+    ASSERT(name != NULL);
+
+#ifdef O_DIRECT
+    int result = open(strPtr(name), flags | O_DIRECT, mode);
+
+    // Open without direct IO when the file system does not support it
+    if (result == -1 && errno == EINVAL)
+        result = open(strPtr(name), flags, mode);
+#else
+    int result = open(strPtr(name), flags, mode);
+#endif
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Disable direct IO on a file
+
+This allows the end of a file that does not fill a complete aligned block to be written through the page cache.
+***********************************************************************************************************************************/
+void
+storagePosixDirectDisable(int handle, const String *name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(handle != -1);
+    ASSERT(name != NULL);
+
+#ifdef O_DIRECT
+    int flags = fcntl(handle, F_GETFL);
+
+    THROW_ON_SYS_ERROR_FMT(
+        flags == -1 || fcntl(handle, F_SETFL, flags & ~O_DIRECT) == -1, FileOpenError, "unable to disable direct io for '%s'",
+        strPtr(name));
+#endif
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Advise the kernel that a file will be read sequentially so read-ahead is more aggressive
+
+Errors are ignored since the advice is only a hint.  Platforms without posix_fadvise() are not advised.
+***********************************************************************************************************************************/
+void
+storagePosixCacheSequential(int handle)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+    FUNCTION_TEST_END();
+
+    ASSERT(handle != -1);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (cacheDrop)
+        posix_fadvise(handle, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Drop a range of a file from the page cache
+
+A size of zero drops from the offset to the end of the file.  Dirty pages are not dropped so files that have been written should be
+synced first.  Errors are ignored since the advice is only a hint.
+***********************************************************************************************************************************/
+void
+storagePosixCacheDropRange(int handle, uint64_t offset, uint64_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(UINT64, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(handle != -1);
+
+#ifdef POSIX_FADV_DONTNEED
+    if (cacheDrop)
+        posix_fadvise(handle, (off_t)offset, (off_t)size, POSIX_FADV_DONTNEED);
+#endif
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the pages of a file that are resident in the page cache
+
+One byte is returned per page and the low bit is set when the page is resident. NULL is returned when cache drop is disabled, the
+file is empty, or residency cannot be determined, in which case all data read will be dropped.
+***********************************************************************************************************************************/
+Buffer *
+storagePosixCacheResident(int handle)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+    FUNCTION_TEST_END();
+
+    ASSERT(handle != -1);
+
+    Buffer *result = NULL;
+    struct stat statFile;
+
+    if (cacheDrop && fstat(handle, &statFile) == 0 && statFile.st_size > 0)
+    {
+        // Mapping the file does not read it so residency is not changed
+        size_t size = (size_t)statFile.st_size;
+        void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, handle, 0);
+
+        if (map != MAP_FAILED)                                      // {uncoverable_branch - mmap error}
+        {
+            const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+            Buffer *resident = bufNew((size / pageSize) + (size % pageSize == 0 ? 0 : 1));
+
+            if (mincore(map, size, (void *)bufPtr(resident)) == 0) // {uncoverable_branch - mincore error}
+            {
+                bufUsedSet(resident, bufSize(resident));
+                result = resident;
+            }
+
+            munmap(map, size);
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Drop a range of a file that has been read from the page cache
+
+Only pages that were not resident when the file was opened are dropped (see storagePosixCacheResident()) so reading a file does not
+evict data that another process, e.g. PostgreSQL, was using. All pages in the range are dropped when residency is NULL.
+***********************************************************************************************************************************/
+void
+storagePosixCacheDropRead(int handle, const Buffer *resident, uint64_t offset, uint64_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handle);
+        FUNCTION_TEST_PARAM(BUFFER, resident);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(UINT64, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(handle != -1);
+
+    if (cacheDrop)
+    {
+        if (resident == NULL)
+            storagePosixCacheDropRange(handle, offset, size);
+        else
+        {
+            const uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+            const uint64_t end = offset + size;
+            uint64_t dropBegin = 0;
+            bool drop = false;
+
+            // Drop each run of pages in the range that were not resident. Pages past the end of the residency, e.g. when the file
+            // has grown, were not resident.
+            for (uint64_t pageIdx = offset / pageSize; pageIdx * pageSize < end; pageIdx++)
+            {
+                uint64_t pageBegin = pageIdx * pageSize < offset ? offset : pageIdx * pageSize;
+                bool pageResident = pageIdx < bufUsed(resident) && (bufPtr(resident)[pageIdx] & 1);
+
+                if (!pageResident && !drop)
+                {
+                    dropBegin = pageBegin;
+                    drop = true;
+                }
+                else if (pageResident && drop)
+                {
+                    storagePosixCacheDropRange(handle, dropBegin, pageBegin - dropBegin);
+                    drop = false;
+                }
+            }
+
+            if (drop)
+                storagePosixCacheDropRange(handle, dropBegin, end - dropBegin);
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Copy a file in the kernel
+
+The destination shares the extents of the source when the file system supports it, e.g. XFS and Btrfs, else the data is copied with
+copy_file_range() so it does not pass through user space.  Explicit offsets are used so the file positions of the handles are not
+used or changed.
+
+Returns false when the kernel cannot copy these files, e.g. they are on different file systems and the kernel is too old to copy
+between them, or either handle was opened with flags the kernel does not allow.  Nothing has been copied in that case so the caller
+can copy the data itself, which will also report any error that is not just a missing feature.
+***********************************************************************************************************************************/
+bool
+storagePosixCopyKernel(int handleSource, int handleDestination, const String *name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, handleSource);
+        FUNCTION_TEST_PARAM(INT, handleDestination);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(handleSource != -1);
+    ASSERT(handleDestination != -1);
+    ASSERT(name != NULL);
+
+    bool result = false;
+
+#ifdef FICLONE
+    // Share extents with the source
+    result = ioctl(handleDestination, FICLONE, handleSource) == 0;
+#endif
+
+#ifdef SYS_copy_file_range
+    // Else copy the data in the kernel
+    if (!result)                                                    // {uncovered_branch - no reflink on tested filesystems}
+    {
+        loff_t offsetSource = 0;
+        loff_t offsetDestination = 0;
+        ssize_t actualBytes;
+
+        do
+        {
+            actualBytes = (ssize_t)syscall(
+                SYS_copy_file_range, handleSource, &offsetSource, handleDestination, &offsetDestination, STORAGE_POSIX_COPY_SIZE,
+                0);
+        }
+        while (actualBytes > 0);
+
+        // Errors after data has been copied are real errors rather than a missing feature
+        result = actualBytes == 0 || offsetDestination > 0;
+        THROW_ON_SYS_ERROR_FMT(result && actualBytes == -1, FileWriteError, "unable to copy to '%s'", strPtr(name));
+    }
+#endif
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Does a file exist? This function is only for files, not paths.
 ***********************************************************************************************************************************/
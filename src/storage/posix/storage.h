@@ -23,4 +23,23 @@ Constructor
 Storage *storagePosixNew(
     const String *path, mode_t modeFile, mode_t modePath, bool write, StoragePathExpressionCallback pathExpressionFunction);
 
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+void storagePosixCacheDropRange(int handle, uint64_t offset, uint64_t size);
+void storagePosixCacheDropRead(int handle, const Buffer *resident, uint64_t offset, uint64_t size);
+Buffer *storagePosixCacheResident(int handle);
+void storagePosixCacheSequential(int handle);
+void storagePosixDirectDisable(int handle, const String *name);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+bool storagePosixCacheDrop(void);
+void storagePosixCacheDropSet(bool enabled);
+bool storagePosixDirect(void);
+void storagePosixDirectSet(bool enabled);
+unsigned int storagePosixQueueDepth(void);
+void storagePosixQueueDepthSet(unsigned int depth);
+
 #endif
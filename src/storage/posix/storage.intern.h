@@ -7,6 +7,18 @@ Posix Storage Internal
 #include "common/object.h"
 #include "storage/posix/storage.h"
 
+/***********************************************************************************************************************************
+Alignment for direct IO buffers, offsets, and sizes
+
+This is the page size on most platforms, which satisfies the alignment required by file systems that support direct IO.
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_DIRECT_ALIGN                                  ((size_t)(4 * 1024))
+
+/***********************************************************************************************************************************
+Maximum bytes to copy in the kernel with one call so a large file does not tie up the kernel in a single call
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_COPY_SIZE                                     ((size_t)(64 * 1024 * 1024))
+
 /***********************************************************************************************************************************
 Constructor
 ***********************************************************************************************************************************/
@@ -17,6 +29,9 @@ Storage *storagePosixNewInternal(
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+bool storagePosixCopyKernel(int handleSource, int handleDestination, const String *name);
+Buffer *storagePosixDirectBufferNew(size_t size);
+int storagePosixDirectOpen(const String *name, int flags, mode_t mode);
 void storagePosixPathCreate(THIS_VOID, const String *path, bool errorOnExists, bool noParentCreate, mode_t mode);
 void storagePosixPathSync(THIS_VOID, const String *path);
 
@@ -0,0 +1,451 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_LIBURING
+
+#include <errno.h>
+#include <liburing.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_URING_TYPE                                    StoragePosixUring
+#define STORAGE_POSIX_URING_PREFIX                                  storagePosixUring
+
+typedef struct StoragePosixUringBlock
+{
+    Buffer *buffer;                                                 // Block data
+    struct iovec vector;                                            // Vector submitted for the block
+    uint64_t offset;                                                // File offset the vector was submitted at
+    bool pending;                                                   // Has the block been submitted and not completed?
+    int result;                                                     // Result of the completed operation
+} StoragePosixUringBlock;
+
+struct StoragePosixUring
+{
+    MemContext *memContext;                                         // Object mem context
+    struct io_uring ring;                                           // Ring used to submit and complete operations
+    int handle;                                                     // File handle
+    const String *name;                                             // File name used in errors
+    bool write;                                                     // Is the file being written?
+
+    unsigned int blockTotal;                                        // Total blocks (and queue depth)
+    StoragePosixUringBlock *blockList;                              // Blocks
+    unsigned int blockIdx;                                          // Block to return on the next read or use on the next write
+    unsigned int pendingTotal;                                      // Total blocks submitted and not completed
+    uint64_t offset;                                                // File offset of the next block to be submitted
+
+    uint64_t readSize;                                              // File size when opened, to tell short reads from EOF
+    bool readBegin;                                                 // Have the initial reads been submitted?
+    bool readEof;                                                   // Has EOF been reached so no more reads should be submitted?
+};
+
+/***********************************************************************************************************************************
+Is io_uring unavailable?
+
+Set the first time the ring cannot be created so the attempt is not repeated for every file.
+***********************************************************************************************************************************/
+static bool uringUnavailable = false;
+
+/***********************************************************************************************************************************
+Wait for the next completion, retrying when interrupted by a signal
+***********************************************************************************************************************************/
+static int
+storagePosixUringWaitCqe(StoragePosixUring *this, struct io_uring_cqe **cqe)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, cqe);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(cqe != NULL);
+
+    int result;
+
+    do
+    {
+        result = io_uring_wait_cqe(&this->ring, cqe);
+    }
+    while (result == -EINTR);                                       // {uncoverable_branch - signal}
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Wait for operations in flight and free the ring
+
+The kernel may still be using the blocks until the operations complete so they must not be freed before that.  Errors are ignored
+since the object is being freed.
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_POSIX_URING, LOG, logLevelTrace)
+{
+    struct io_uring_cqe *cqe = NULL;
+
+    while (this->pendingTotal > 0 && storagePosixUringWaitCqe(this, &cqe) == 0) // {uncoverable_branch - wait error}
+    {
+        io_uring_cqe_seen(&this->ring, cqe);
+        this->pendingTotal--;
+    }
+
+    io_uring_queue_exit(&this->ring);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+OBJECT_DEFINE_FREE(STORAGE_POSIX_URING);
+
+/***********************************************************************************************************************************
+Handle errors
+
+io_uring calls and operations return a negative errno on error rather than setting errno.
+***********************************************************************************************************************************/
+static void
+storagePosixUringError(const StoragePosixUring *this, int result)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(INT, result);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    if (result < 0)
+    {
+        THROWP_SYS_ERROR_CODE_FMT(
+            -result, this->write ? &FileWriteError : &FileReadError, "unable to %s '%s'", this->write ? "write" : "read",
+            strPtr(this->name));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Queue the block's vector to be read or written at the block's offset
+
+The ring has an entry for each block so an entry is always available.  Operations are not sent to the kernel until
+storagePosixUringSubmit() is called so more than one can be submitted together.
+***********************************************************************************************************************************/
+static void
+storagePosixUringQueue(StoragePosixUring *this, StoragePosixUringBlock *block)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, block);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(block != NULL && !block->pending);
+
+    struct io_uring_sqe *sqe = io_uring_get_sqe(&this->ring);
+    ASSERT(sqe != NULL);
+
+    if (this->write)
+        io_uring_prep_writev(sqe, this->handle, &block->vector, 1, block->offset);
+    else
+        io_uring_prep_readv(sqe, this->handle, &block->vector, 1, block->offset);
+
+    io_uring_sqe_set_data(sqe, block);
+
+    block->pending = true;
+    this->pendingTotal++;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Prepare a block to be read or written at the next offset
+***********************************************************************************************************************************/
+static void
+storagePosixUringPrepare(StoragePosixUring *this, StoragePosixUringBlock *block, size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, block);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(block != NULL);
+
+    block->vector = (struct iovec){.iov_base = bufPtr(block->buffer), .iov_len = size};
+    block->offset = this->offset;
+    storagePosixUringQueue(this, block);
+
+    this->offset += size;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Submit prepared operations to the kernel
+***********************************************************************************************************************************/
+static void
+storagePosixUringSubmit(StoragePosixUring *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    storagePosixUringError(this, io_uring_submit(&this->ring));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for an operation to complete
+
+Operations may complete in any order so the result is stored in the block.  Writes are checked immediately since the caller does
+not wait for them.
+***********************************************************************************************************************************/
+static void
+storagePosixUringComplete(StoragePosixUring *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->pendingTotal > 0);
+
+    struct io_uring_cqe *cqe = NULL;
+    storagePosixUringError(this, storagePosixUringWaitCqe(this, &cqe));
+
+    StoragePosixUringBlock *block = io_uring_cqe_get_data(cqe);
+    block->result = cqe->res;
+    block->pending = false;
+
+    io_uring_cqe_seen(&this->ring, cqe);
+    this->pendingTotal--;
+
+    if (this->write)
+    {
+        storagePosixUringError(this, block->result);
+
+        if (block->result != (int)block->vector.iov_len)
+            THROW_FMT(FileWriteError, "unable to write '%s'", strPtr(this->name));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read the next block of the file
+
+All blocks are submitted on the first call.  After that the block returned by the previous call is submitted again to read further
+ahead before waiting for the next block.  The kernel may complete a read with less data than requested before the end of the file,
+so the remainder of a short block is read again until it is full, the read returns no data, or the file size from when the file was
+opened is reached.  A block with less data than the block size then indicates EOF and no more reads are submitted.  As in
+storageReadPosix() the file is not expected to be growing.
+
+The block returned is only valid until the next call.
+***********************************************************************************************************************************/
+const Buffer *
+storagePosixUringRead(StoragePosixUring *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->write);
+    ASSERT(!this->readEof);
+
+    // Submit all the blocks together on the first read
+    if (!this->readBegin)
+    {
+        for (unsigned int blockIdx = 0; blockIdx < this->blockTotal; blockIdx++)
+            storagePosixUringPrepare(this, &this->blockList[blockIdx], bufSize(this->blockList[blockIdx].buffer));
+
+        this->readBegin = true;
+    }
+    // Else submit the block returned by the previous read to read further ahead
+    else
+    {
+        StoragePosixUringBlock *block = &this->blockList[this->blockIdx];
+        storagePosixUringPrepare(this, block, bufSize(block->buffer));
+
+        this->blockIdx = (this->blockIdx + 1) % this->blockTotal;
+    }
+
+    storagePosixUringSubmit(this);
+
+    // Wait for the next block in file order to complete
+    StoragePosixUringBlock *block = &this->blockList[this->blockIdx];
+
+    do
+    {
+        while (block->pending)
+            storagePosixUringComplete(this);
+
+        storagePosixUringError(this, block->result);
+
+        // Read the remainder of a short block when the end of the file has not been reached
+        if (block->result > 0 && (size_t)block->result < block->vector.iov_len &&
+            block->offset + (uint64_t)block->result < this->readSize)
+        {
+            block->vector.iov_base = (unsigned char *)block->vector.iov_base + block->result;
+            block->vector.iov_len -= (size_t)block->result;
+            block->offset += (uint64_t)block->result;
+
+            storagePosixUringQueue(this, block);
+            storagePosixUringSubmit(this);
+        }
+    }
+    while (block->pending);
+
+    bufUsedSet(block->buffer, (size_t)((unsigned char *)block->vector.iov_base - bufPtr(block->buffer)) + (size_t)block->result);
+
+    if (bufUsed(block->buffer) != bufSize(block->buffer))
+        this->readEof = true;
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, block->buffer);
+}
+
+/***********************************************************************************************************************************
+Wait for all operations in flight to complete
+***********************************************************************************************************************************/
+void
+storagePosixUringWait(StoragePosixUring *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    while (this->pendingTotal > 0)
+        storagePosixUringComplete(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write data to the file
+
+The data is copied to the next block, waiting for the block's previous write to complete when needed, and submitted without waiting
+for the write to complete.  Data larger than a block is split across blocks.
+***********************************************************************************************************************************/
+void
+storagePosixUringWrite(StoragePosixUring *this, const unsigned char *data, size_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->write);
+    ASSERT(data != NULL);
+
+    while (size > 0)
+    {
+        StoragePosixUringBlock *block = &this->blockList[this->blockIdx];
+
+        while (block->pending)
+            storagePosixUringComplete(this);
+
+        size_t blockSize = size < bufSize(block->buffer) ? size : bufSize(block->buffer);
+
+        memcpy(bufPtr(block->buffer), data, blockSize);
+        storagePosixUringPrepare(this, block, blockSize);
+        storagePosixUringSubmit(this);
+
+        this->blockIdx = (this->blockIdx + 1) % this->blockTotal;
+        data += blockSize;
+        size -= blockSize;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringNew(int handle, const String *name, bool write, unsigned int queueDepth, size_t bufferSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, handle);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(BOOL, write);
+        FUNCTION_LOG_PARAM(UINT, queueDepth);
+        FUNCTION_LOG_PARAM(SIZE, bufferSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(handle != -1);
+    ASSERT(name != NULL);
+    ASSERT(queueDepth > 1);
+    ASSERT(bufferSize > 0);
+
+    StoragePosixUring *this = NULL;
+
+    if (!uringUnavailable)
+    {
+        int result = 0;
+
+        MEM_CONTEXT_NEW_BEGIN("StoragePosixUring")
+        {
+            this = memNew(sizeof(StoragePosixUring));
+            this->memContext = MEM_CONTEXT_NEW();
+            this->handle = handle;
+            this->name = strDup(name);
+            this->write = write;
+
+            // Create the ring with an entry for each block
+            result = io_uring_queue_init(queueDepth, &this->ring, 0);
+
+            if (result == 0)
+            {
+                memContextCallbackSet(this->memContext, storagePosixUringFreeResource, this);
+
+                // Create aligned blocks so direct IO can be used
+                this->blockTotal = queueDepth;
+                this->blockList = memNew(sizeof(StoragePosixUringBlock) * queueDepth);
+
+                for (unsigned int blockIdx = 0; blockIdx < this->blockTotal; blockIdx++)
+                    this->blockList[blockIdx].buffer = storagePosixDirectBufferNew(bufferSize);
+
+                // Get the file size so short reads can be told apart from EOF
+                if (!write)
+                {
+                    struct stat statFile;
+
+                    THROW_ON_SYS_ERROR_FMT(
+                        fstat(handle, &statFile) == -1, FileReadError, "unable to get info for '%s'", strPtr(name));
+
+                    this->readSize = (uint64_t)statFile.st_size;
+                }
+            }
+        }
+        MEM_CONTEXT_NEW_END();
+
+        // Fall back to synchronous IO when io_uring is not available
+        if (result != 0)
+        {
+            LOG_DEBUG("io_uring is not available, using synchronous io: [%d] %s", -result, strerror(-result));
+
+            memContextFree(this->memContext);
+            this = NULL;
+            uringUnavailable = true;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(STORAGE_POSIX_URING, this);
+}
+
+#endif // HAVE_LIBURING
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+
+Keeps more than one read or write in flight for a file using io_uring. Reads are submitted ahead of the caller in blocks and
+returned in file order. Writes are copied to a free block and submitted without waiting so the caller can continue while the data
+is written.
+Offsets are tracked explicitly so the file position of the handle is not used or changed.
+
+Each file uses queue depth * buffer size memory for blocks, which are aligned so they can also be used for direct IO.
+***********************************************************************************************************************************/
+#ifndef STORAGE_POSIX_URING_H
+#define STORAGE_POSIX_URING_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StoragePosixUring StoragePosixUring;
+
+#include "common/type/buffer.h"
+#include "common/type/string.h"
+
+#ifdef HAVE_LIBURING
+
+/***********************************************************************************************************************************
+Constructor
+
+Returns NULL when io_uring is not available, e.g. the kernel is too old or io_uring has been disabled, so the caller can fall back
+to a read ahead thread (see storagePosixReadAheadNew()) or synchronous IO.
+***********************************************************************************************************************************/
+StoragePosixUring *storagePosixUringNew(int handle, const String *name, bool write, unsigned int queueDepth, size_t bufferSize);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+const Buffer *storagePosixUringRead(StoragePosixUring *this);
+void storagePosixUringWait(StoragePosixUring *this);
+void storagePosixUringWrite(StoragePosixUring *this, const unsigned char *data, size_t size);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void storagePosixUringFree(StoragePosixUring *this);
+
+#endif // HAVE_LIBURING
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_POSIX_URING_TYPE                                                                                      \
+    StoragePosixUring *
+#define FUNCTION_LOG_STORAGE_POSIX_URING_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(value, "StoragePosixUring", buffer, bufferSize)
+
+#endif
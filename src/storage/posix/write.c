@@ -5,16 +5,20 @@ Posix Storage File write
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/io/write.intern.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
 #include "common/user.h"
+#include "storage/posix/read.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/posix/write.h"
 #include "storage/write.intern.h"
 
@@ -33,6 +37,10 @@ typedef struct StorageWritePosix
     const String *nameTmp;
     const String *path;
     int handle;
+
+    bool direct;                                                    // Write with direct IO?
+    Buffer *directBuffer;                                           // Aligned buffer for direct IO
+    StoragePosixUring *uring;                                       // Write behind with io_uring (NULL when not used)
 } StorageWritePosix;
 
 /***********************************************************************************************************************************
@@ -60,6 +68,24 @@ OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_WRITE_POSIX, LOG, logLevelTrace)
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
+/***********************************************************************************************************************************
+Open the file handle, with direct IO when enabled
+***********************************************************************************************************************************/
+static int
+storageWritePosixOpenHandle(StorageWritePosix *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_WRITE_POSIX, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(
+        this->direct ?
+            storagePosixDirectOpen(this->nameTmp, FILE_OPEN_FLAGS, this->interface.modeFile) :
+            open(strPtr(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -76,7 +102,7 @@ storageWritePosixOpen(THIS_VOID)
     ASSERT(this->handle == -1);
 
     // Open the file
-    this->handle = open(strPtr(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+    this->handle = storageWritePosixOpenHandle(this);
 
     // Attempt the create the path if it is missing
     if (this->handle == -1 && errno == ENOENT && this->interface.createPath)
@@ -85,7 +111,7 @@ storageWritePosixOpen(THIS_VOID)
         storagePosixPathCreate(this->storage, this->path, false, false, this->interface.modePath);
 
         // Open file again
-        this->handle = open(strPtr(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+        this->handle = storageWritePosixOpenHandle(this);
     }
 
     // Handle errors
@@ -100,6 +126,20 @@ storageWritePosixOpen(THIS_VOID)
     // Set free callback to ensure file handle is freed
     memContextCallbackSet(this->memContext, storageWritePosixFreeResource, this);
 
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        // Allocate the direct IO buffer
+        if (this->direct)
+            this->directBuffer = storagePosixDirectBufferNew(ioBufferSize());
+
+#ifdef HAVE_LIBURING
+        // Write behind with io_uring when more than one write can be in flight
+        if (storagePosixQueueDepth() > 1)
+            this->uring = storagePosixUringNew(this->handle, this->nameTmp, true, storagePosixQueueDepth(), ioBufferSize());
+#endif
+    }
+    MEM_CONTEXT_END();
+
     // Update user/group owner
     if (this->interface.user != NULL || this->interface.group != NULL)
     {
@@ -121,6 +161,33 @@ storageWritePosixOpen(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Write data to the file handle
+***********************************************************************************************************************************/
+static void
+storageWritePosixData(StorageWritePosix *this, const unsigned char *data, size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, data);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(data != NULL);
+
+#ifdef HAVE_LIBURING
+    // Write behind with io_uring when enabled
+    if (this->uring != NULL)
+        storagePosixUringWrite(this->uring, data, size);
+    else
+#endif
+    if (write(this->handle, data, size) != (ssize_t)size)
+        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strPtr(this->nameTmp));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Write to the file
 ***********************************************************************************************************************************/
@@ -138,9 +205,63 @@ storageWritePosix(THIS_VOID, const Buffer *buffer)
     ASSERT(buffer != NULL);
     ASSERT(this->handle != -1);
 
-    // Write the data
-    if (write(this->handle, bufPtr(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
-        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strPtr(this->nameTmp));
+    // Write to the direct IO buffer and write the buffer to the file each time it is full so writes are always aligned
+    if (this->direct)
+    {
+        size_t bufferOffset = 0;
+
+        while (bufferOffset < bufUsed(buffer))
+        {
+            size_t copySize = bufUsed(buffer) - bufferOffset;
+
+            if (copySize > bufRemains(this->directBuffer))
+                copySize = bufRemains(this->directBuffer);
+
+            memcpy(bufRemainsPtr(this->directBuffer), bufPtr(buffer) + bufferOffset, copySize);
+            bufUsedInc(this->directBuffer, copySize);
+            bufferOffset += copySize;
+
+            if (bufFull(this->directBuffer))
+            {
+                storageWritePosixData(this, bufPtr(this->directBuffer), bufUsed(this->directBuffer));
+                bufUsedZero(this->directBuffer);
+            }
+        }
+    }
+    // Else write the data
+    else
+        storageWritePosixData(this, bufPtr(buffer), bufUsed(buffer));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write the data remaining in the direct IO buffer
+
+Aligned blocks are written with direct IO and then direct IO is disabled to write the remainder, which is smaller than a block.
+***********************************************************************************************************************************/
+static void
+storageWritePosixDirectFlush(StorageWritePosix *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->direct);
+
+    size_t alignedSize = bufUsed(this->directBuffer) / STORAGE_POSIX_DIRECT_ALIGN * STORAGE_POSIX_DIRECT_ALIGN;
+
+    if (alignedSize > 0)
+        storageWritePosixData(this, bufPtr(this->directBuffer), alignedSize);
+
+    if (alignedSize < bufUsed(this->directBuffer))
+    {
+        storagePosixDirectDisable(this->handle, this->nameTmp);
+        storageWritePosixData(this, bufPtr(this->directBuffer) + alignedSize, bufUsed(this->directBuffer) - alignedSize);
+    }
+
+    bufUsedZero(this->directBuffer);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -162,10 +283,29 @@ storageWritePosixClose(THIS_VOID)
     // Close if the file has not already been closed
     if (this->handle != -1)
     {
+        // Write data remaining in the direct IO buffer
+        if (this->direct)
+            storageWritePosixDirectFlush(this);
+
+#ifdef HAVE_LIBURING
+        // Wait for writes in flight and free the io_uring blocks
+        if (this->uring != NULL)
+        {
+            storagePosixUringWait(this->uring);
+            storagePosixUringFree(this->uring);
+            this->uring = NULL;
+        }
+#endif
+
         // Sync the file
         if (this->interface.syncFile)
+        {
             THROW_ON_SYS_ERROR_FMT(fsync(this->handle) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strPtr(this->nameTmp));
 
+            // Drop the file from the page cache now that the data is clean
+            storagePosixCacheDropRange(this->handle, 0, 0);
+        }
+
         // Close the file
         memContextCallbackClear(this->memContext);
         THROW_ON_SYS_ERROR_FMT(close(this->handle) == -1, FileCloseError, STORAGE_ERROR_WRITE_CLOSE, strPtr(this->nameTmp));
@@ -199,6 +339,73 @@ storageWritePosixClose(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Copy from a posix file in the kernel
+
+Filters that only observe the data, e.g. size and hash, are fed by reading the file back after the copy. This is still cheaper than
+a copy through user space since the data is only read and it is likely to be in the page cache.
+***********************************************************************************************************************************/
+static bool
+storageWritePosixCopy(THIS_VOID, IoRead *source, IoFilterGroup *filterGroup)
+{
+    THIS(StorageWritePosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM(IO_READ, source);
+        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, filterGroup);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->handle != -1);
+    ASSERT(source != NULL);
+    ASSERT(filterGroup != NULL);
+
+    bool result = false;
+
+    // The kernel will not copy from sources that are not regular files, so only check that the source has a handle, e.g. it is not
+    // a remote file
+    int handleSource = ioReadHandle(source);
+
+    if (handleSource != -1 && storagePosixCopyKernel(handleSource, this->handle, this->nameTmp))
+    {
+        IoFilterGroup *filterGroupSource = ioReadFilterGroup(source);
+
+        // Read the file back for filters that observe the data. Open groups that process in place always end with the buffer filter
+        // added by ioFilterGroupOpen() so there are other filters when the size is more than one.
+        if (ioFilterGroupSize(filterGroupSource) > 1 || ioFilterGroupSize(filterGroup) > 1)
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                IoRead *read = storageReadIo(storageReadPosixNew(this->storage, this->nameTmp, false));
+                ioReadOpen(read);
+
+                Buffer *buffer = bufNew(ioBufferSize());
+
+                do
+                {
+                    ioRead(read, buffer);
+
+                    if (bufUsed(buffer) > 0)
+                    {
+                        ioFilterGroupProcess(filterGroupSource, buffer, NULL);
+                        ioFilterGroupProcess(filterGroup, buffer, NULL);
+                        bufUsedZero(buffer);
+                    }
+                }
+                while (!ioReadEof(read));
+
+                ioReadClose(read);
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+
+        result = true;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /***********************************************************************************************************************************
 Get handle (file descriptor)
 ***********************************************************************************************************************************/
@@ -264,6 +471,8 @@ storageWritePosixNew(
             .user = strDup(user),
             .timeModified = timeModified,
 
+            .copy = storageWritePosixCopy,
+
             .ioInterface = (IoWriteInterface)
             {
                 .close = storageWritePosixClose,
@@ -277,6 +486,7 @@ storageWritePosixNew(
         driver->nameTmp = atomic ? strNewFmt("%s." STORAGE_FILE_TEMP_EXT, strPtr(name)) : driver->interface.name;
         driver->path = strPath(name);
         driver->handle = -1;
+        driver->direct = storagePosixDirect();
 
         this = storageWriteNew(driver, &driver->interface);
     }
@@ -3,11 +3,20 @@ Remote Storage Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/backup/blockIncr.h"
+#include "command/backup/checksum.h"
 #include "command/backup/pageChecksum.h"
+#include "common/compress/adaptive.h"
 #include "common/compress/gzip/compress.h"
+#include "common/compress/gzip/compressParallel.h"
 #include "common/compress/gzip/decompress.h"
+#include "common/compress/lz4/compress.h"
+#include "common/compress/lz4/decompress.h"
+#include "common/compress/zst/compress.h"
+#include "common/compress/zst/decompress.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
 #include "common/debug.h"
 #include "common/io/filter/sink.h"
 #include "common/io/filter/size.h"
@@ -68,14 +77,38 @@ storageRemoteFilterGroup(IoFilterGroup *filterGroup, const Variant *filterList)
         const String *filterKey = varStr(varLstGet(kvKeyList(filterKv), 0));
         const VariantList *filterParam = varVarLst(kvGet(filterKv, VARSTR(filterKey)));
 
-        if (strEq(filterKey, GZIP_COMPRESS_FILTER_TYPE_STR))
+        if (strEq(filterKey, BACKUP_CHECKSUM_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, backupChecksumNewVar(filterParam));
+        else if (strEq(filterKey, BLOCK_INCR_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, blockIncrNewVar(filterParam));
+        else if (strEq(filterKey, COMPRESS_ADAPTIVE_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, compressAdaptiveNewVar(filterParam));
+        else if (strEq(filterKey, GZIP_COMPRESS_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, gzipCompressNewVar(filterParam));
+        else if (strEq(filterKey, GZIP_COMPRESS_PARALLEL_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, gzipCompressParallelNewVar(filterParam));
         else if (strEq(filterKey, GZIP_DECOMPRESS_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, gzipDecompressNewVar(filterParam));
+#ifdef HAVE_LIBLZ4
+        else if (strEq(filterKey, LZ4_COMPRESS_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, lz4CompressNewVar(filterParam));
+        else if (strEq(filterKey, LZ4_DECOMPRESS_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, lz4DecompressNew());
+#endif
+#ifdef HAVE_LIBZSTD
+        else if (strEq(filterKey, ZST_COMPRESS_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, zstCompressNewVar(filterParam));
+        else if (strEq(filterKey, ZST_DECOMPRESS_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, zstDecompressNewVar(filterParam));
+#endif
         else if (strEq(filterKey, CIPHER_BLOCK_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, cipherBlockNewVar(filterParam));
         else if (strEq(filterKey, CRYPTO_HASH_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, cryptoHashNewVar(filterParam));
+#ifdef HAVE_LIBXXHASH
+        else if (strEq(filterKey, XXHASH_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, xxHashNew());
+#endif
         else if (strEq(filterKey, PAGE_CHECKSUM_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, pageChecksumNewVar(filterParam));
         else if (strEq(filterKey, SINK_FILTER_TYPE_STR))
@@ -106,16 +106,19 @@ storageCopy(StorageRead *source, StorageWrite *destination)
             // Open the destination file now that we know the source file exists and is readable
             ioWriteOpen(storageWriteIo(destination));
 
-            // Copy data from source to destination
-            Buffer *read = bufNew(ioBufferSize());
-
-            do
+            // Copy data from source to destination, without passing the data through user space when the storage supports it
+            if (!storageWriteCopy(destination, storageReadIo(source)))
             {
-                ioRead(storageReadIo(source), read);
-                ioWrite(storageWriteIo(destination), read);
-                bufUsedZero(read);
+                Buffer *read = bufNew(ioBufferSize());
+
+                do
+                {
+                    ioRead(storageReadIo(source), read);
+                    ioWrite(storageWriteIo(destination), read);
+                    bufUsedZero(read);
+                }
+                while (!ioReadEof(storageReadIo(source)));
             }
-            while (!ioReadEof(storageReadIo(source)));
 
             // Close the source and destination files
             ioReadClose(storageReadIo(source));
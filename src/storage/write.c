@@ -59,6 +59,31 @@ storageWriteNew(void *driver, const StorageWriteInterface *interface)
     FUNCTION_LOG_RETURN(STORAGE_WRITE, this);
 }
 
+/***********************************************************************************************************************************
+Copy from a source without passing the data through user space when the driver supports it
+
+Both the source and this file must be open. The copy is only attempted when no filter in either filter group changes the data, e.g.
+a size or hash filter, and the driver is responsible for providing the data to those filters. Returns false when the copy was not
+done, in which case nothing has been written and the caller must copy the data with ioRead()/ioWrite().
+***********************************************************************************************************************************/
+bool
+storageWriteCopy(StorageWrite *this, IoRead *source)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, this);
+        FUNCTION_LOG_PARAM(IO_READ, source);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+
+    FUNCTION_LOG_RETURN(
+        BOOL,
+        this->interface->copy != NULL && ioFilterGroupInPlace(ioReadFilterGroup(source)) &&
+            ioFilterGroupInPlace(ioWriteFilterGroup(this->io)) &&
+            this->interface->copy(this->driver, source, ioWriteFilterGroup(this->io)));
+}
+
 /***********************************************************************************************************************************
 Will the file be written atomically?
 
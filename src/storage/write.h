@@ -12,6 +12,7 @@ Object type
 
 typedef struct StorageWrite StorageWrite;
 
+#include "common/io/read.h"
 #include "common/io/write.h"
 #include "common/type/buffer.h"
 #include "common/type/string.h"
@@ -19,6 +20,7 @@ typedef struct StorageWrite StorageWrite;
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+bool storageWriteCopy(StorageWrite *this, IoRead *source);
 StorageWrite *storageWriteMove(StorageWrite *this, MemContext *parentNew);
 
 /***********************************************************************************************************************************
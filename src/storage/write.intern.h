@@ -33,6 +33,9 @@ typedef struct StorageWriteInterface
     time_t timeModified;                                            // Time file was last modified
     const String *user;                                             // User that owns the file
 
+    // Copy from an open source without passing the data through the write filters (optional, see storageWriteCopy())
+    bool (*copy)(void *driver, IoRead *source, IoFilterGroup *filterGroup);
+
     IoWriteInterface ioInterface;
 } StorageWriteInterface;
 
@@ -363,6 +363,21 @@ sub containerBuild
                 "        gcc make perl-ExtUtils-MakeMaker perl-Test-Simple openssl-devel perl-ExtUtils-Embed rpm-build \\\n" .
                 "        zlib-devel libxml2-devel lz4-devel";
 
+            if (vmWithZst($strOS))
+            {
+                $strScript .= ' libzstd-devel';
+            }
+
+            if (vmWithXxHash($strOS))
+            {
+                $strScript .= ' xxhash-devel';
+            }
+
+            if (vmWithUring($strOS))
+            {
+                $strScript .= ' liburing-devel';
+            }
+
             if ($strOS eq VM_CO6)
             {
                 $strScript .= ' perl-Time-HiRes perl-parent perl-JSON';
@@ -421,7 +421,11 @@ sub run
 
                 # Create build.auto.h
                 my $strBuildAutoH =
-                    "#define HAVE_LIBPERL\n";
+                    "#define HAVE_LIBPERL\n" .
+                    ($self->{oTest}->{&TEST_VM} ne VM_U12 ? "#define HAVE_LIBLZ4\n" : '') .
+                    (vmWithZst($self->{oTest}->{&TEST_VM}) ? "#define HAVE_LIBZSTD\n" : '') .
+                    (vmWithXxHash($self->{oTest}->{&TEST_VM}) ? "#define HAVE_LIBXXHASH\n" : '') .
+                    (vmWithUring($self->{oTest}->{&TEST_VM}) ? "#define HAVE_LIBURING\n" : '');
 
                 buildPutDiffers($self->{oStorageTest}, "$self->{strGCovPath}/" . BUILD_AUTO_H, $strBuildAutoH);
 
@@ -488,7 +492,11 @@ sub run
                     "BUILDFLAGS=${strBuildFlags}\n" .
                     "HARNESSFLAGS=${strHarnessFlags}\n" .
                     "TESTFLAGS=${strTestFlags}\n" .
-                    "LDFLAGS=-lcrypto -lssl -lxml2 -lz" .
+                    "LDFLAGS=-lcrypto -lpthread -lssl -lxml2 -lz" .
+                        ($self->{oTest}->{&TEST_VM} ne VM_U12 ? ' -llz4' : '') .
+                        (vmWithZst($self->{oTest}->{&TEST_VM}) ? ' -lzstd' : '') .
+                        (vmWithXxHash($self->{oTest}->{&TEST_VM}) ? ' -lxxhash' : '') .
+                        (vmWithUring($self->{oTest}->{&TEST_VM}) ? ' -luring' : '') .
                         (vmCoverageC($self->{oTest}->{&TEST_VM}) && $self->{bCoverageUnit} ? " -lgcov" : '') .
                         (vmWithBackTrace($self->{oTest}->{&TEST_VM}) && $self->{bBackTrace} ? ' -lbacktrace' : '') .
                         " `perl -MExtUtils::Embed -e ldopts`\n" .
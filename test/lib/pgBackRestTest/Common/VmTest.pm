@@ -46,6 +46,12 @@ use constant VMDEF_PGSQL_BIN                                        => 'pgsql-bi
     push @EXPORT, qw(VMDEF_PGSQL_BIN);
 use constant VMDEF_WITH_BACKTRACE                                   => 'with-backtrace';
     push @EXPORT, qw(VMDEF_WITH_BACKTRACE);
+use constant VMDEF_WITH_URING                                       => 'with-uring';
+    push @EXPORT, qw(VMDEF_WITH_URING);
+use constant VMDEF_WITH_XXHASH                                      => 'with-xxhash';
+    push @EXPORT, qw(VMDEF_WITH_XXHASH);
+use constant VMDEF_WITH_ZST                                         => 'with-zst';
+    push @EXPORT, qw(VMDEF_WITH_ZST);
 
 ####################################################################################################################################
 # Valid OS base List
@@ -189,6 +195,8 @@ my $oyVm =
 
         &VMDEF_DEBUG_INTEGRATION => false,
 
+        &VMDEF_WITH_ZST => true,
+
         &VM_DB =>
         [
             PG_VERSION_92,
@@ -217,6 +225,10 @@ my $oyVm =
 
         &VMDEF_DEBUG_INTEGRATION => false,
 
+        &VMDEF_WITH_URING => true,
+        &VMDEF_WITH_XXHASH => true,
+        &VMDEF_WITH_ZST => true,
+
         &VM_DB =>
         [
             PG_VERSION_94,
@@ -571,6 +583,42 @@ sub vmWithBackTrace
 
 push @EXPORT, qw(vmWithBackTrace);
 
+####################################################################################################################################
+# Does the VM support liburing?
+####################################################################################################################################
+sub vmWithUring
+{
+    my $strVm = shift;
+
+    return ($oyVm->{$strVm}{&VMDEF_WITH_URING} ? true : false);
+}
+
+push @EXPORT, qw(vmWithUring);
+
+####################################################################################################################################
+# Does the VM support libxxhash?
+####################################################################################################################################
+sub vmWithXxHash
+{
+    my $strVm = shift;
+
+    return ($oyVm->{$strVm}{&VMDEF_WITH_XXHASH} ? true : false);
+}
+
+push @EXPORT, qw(vmWithXxHash);
+
+####################################################################################################################################
+# Does the VM support libzstd?
+####################################################################################################################################
+sub vmWithZst
+{
+    my $strVm = shift;
+
+    return ($oyVm->{$strVm}{&VMDEF_WITH_ZST} ? true : false);
+}
+
+push @EXPORT, qw(vmWithZst);
+
 ####################################################################################################################################
 # Will integration tests be run in debug mode?
 ####################################################################################################################################
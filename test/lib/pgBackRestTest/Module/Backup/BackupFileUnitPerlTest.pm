@@ -142,6 +142,11 @@ sub run
             8192,
             $strPgControlHash,
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             0,
             167854,
@@ -175,6 +180,11 @@ sub run
             16777216,
             '1c7e00fd09b9dd11fc2966590b3e3274645dd031',
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             8192,
             167854,
@@ -211,6 +221,11 @@ sub run
             3646899,
             '1c7e00fd09b9dd11fc2966590b3e3274645dd031',
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             16785408,
             167854,
@@ -247,6 +262,11 @@ sub run
             undef,
             undef,
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             33562624,
             167854,
@@ -273,6 +293,11 @@ sub run
             undef,
             undef,
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             50339840,
             167854,
@@ -297,6 +322,11 @@ sub run
             16777216,
             '1c7e00fd09b9dd11fc2966590b3e3274645dd031',
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             67117056,
             167854,
@@ -331,6 +361,11 @@ sub run
             undef,
             '1c7e00fd09b9dd11fc2966590b3e3274645dd031',
             undef,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             16785408,
             83894272,
             $lManifestSaveSize,
@@ -372,6 +407,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
@@ -411,6 +451,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
@@ -432,6 +477,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
@@ -453,6 +503,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
@@ -474,6 +529,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
@@ -497,6 +557,11 @@ sub run
             $lResultRepoSize,
             $strResultCopyChecksum,
             $rResultExtra,
+            false,
+            false,
+            undef,
+            false,
+            undef,
             $lSizeTotal,
             $lSizeCurrent,
             $lManifestSaveSize,
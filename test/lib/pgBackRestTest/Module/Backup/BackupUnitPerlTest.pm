@@ -192,6 +192,52 @@ sub run
         $self->testResult(sub {$strDiffLabel eq $strNewDiffLabel}, true, 'new diff label in future');
     }
 
+    ################################################################################################################################
+    if ($self->begin('backupBlockIncrLsn()'))
+    {
+        my $oLastManifest = new pgBackRest::Manifest(
+            $self->testPath() . '/last.manifest',
+            {bLoad => false, strDbVersion => PG_VERSION_94, iDbCatalogVersion => $self->dbCatalogVersion(PG_VERSION_94)});
+        my $oManifest = new pgBackRest::Manifest(
+            $self->testPath() . '/backup.manifest',
+            {bLoad => false, strDbVersion => PG_VERSION_94, iDbCatalogVersion => $self->dbCatalogVersion(PG_VERSION_94)});
+
+        $oLastManifest->numericSet(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID, undef, 6569239123849665679);
+        $oManifest->numericSet(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID, undef, 6569239123849665679);
+        $oManifest->set(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START, undef, '000000010000000200000005');
+
+        #---------------------------------------------------------------------------------------------------------------------------
+        $self->testResult(sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0, 'no lsn start in prior backup');
+
+        $oLastManifest->set(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LSN_START, undef, '2/3000028');
+
+        $self->testResult(sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0, 'no archive start in prior backup');
+
+        $oLastManifest->set(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START, undef, '000000010000000200000003');
+
+        $self->testResult(
+            sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0x203000028, 'lsn start of prior backup on same timeline');
+
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oManifest->set(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START, undef, '000000020000000200000005');
+
+        $self->testResult(sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0, 'timeline switch since prior backup');
+
+        $oManifest->set(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START, undef, '000000010000000200000005');
+
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oManifest->numericSet(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID, undef, 6569239123849665680);
+
+        $self->testResult(sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0, 'prior backup on a different system');
+
+        $oManifest->numericSet(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_SYSTEM_ID, undef, 6569239123849665679);
+
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oManifest->remove(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_ARCHIVE_START);
+
+        $self->testResult(sub {backupBlockIncrLsn($oLastManifest, $oManifest)}, 0, 'no archive start in current backup');
+    }
+
     ################################################################################################################################
     if ($self->begin('resumeClean()'))
     {
@@ -2,6 +2,8 @@
 Test Archive Get Command
 ***********************************************************************************************************************************/
 #include "common/compress/gzip/compress.h"
+#include "common/compress/lz4/compress.h"
+#include "common/compress/zst/compress.h"
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
 #include "common/io/bufferRead.h"
@@ -215,6 +217,65 @@ testRun(void)
         TEST_RESULT_BOOL(storageExistsNP(storageTest, walDestination), true, "  check exists");
         TEST_RESULT_INT(storageInfoNP(storageTest, walDestination).size, 16 * 1024 * 1024, "  check size");
 
+#ifdef HAVE_LIBLZ4
+        // Replace with an lz4 compressed WAL segment
+        // -------------------------------------------------------------------------------------------------------------------------
+        storageRemoveP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.gz"),
+            .errorOnMissing = true);
+        storageRemoveP(storageTest, walDestination, .errorOnMissing = true);
+
+        destination = storageNewWriteNP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.lz4"));
+
+        filterGroup = ioWriteFilterGroup(storageWriteIo(destination));
+        ioFilterGroupAdd(filterGroup, lz4CompressNew(1));
+        ioFilterGroupAdd(
+            filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("worstpassphraseever"), NULL));
+        storagePutNP(destination, buffer);
+
+        TEST_RESULT_INT(
+            archiveGetFile(
+                storageTest, archiveFile, walDestination, false, cipherTypeAes256Cbc, strNew("12345678")), 0,
+            "lz4 WAL segment copied");
+        TEST_RESULT_INT(storageInfoNP(storageTest, walDestination).size, 16 * 1024 * 1024, "  check size");
+#endif
+
+#ifdef HAVE_LIBZSTD
+        // Replace with a zst compressed WAL segment
+        // -------------------------------------------------------------------------------------------------------------------------
+        storageRemoveNP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.gz"));
+        storageRemoveNP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.lz4"));
+        storageRemoveP(storageTest, walDestination, .errorOnMissing = true);
+
+        destination = storageNewWriteNP(
+            storageTest,
+            strNew(
+                "repo/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst"));
+
+        filterGroup = ioWriteFilterGroup(storageWriteIo(destination));
+        ioFilterGroupAdd(filterGroup, zstCompressNew(3, 2, NULL));
+        ioFilterGroupAdd(
+            filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("worstpassphraseever"), NULL));
+        storagePutNP(destination, buffer);
+
+        TEST_RESULT_INT(
+            archiveGetFile(
+                storageTest, archiveFile, walDestination, false, cipherTypeAes256Cbc, strNew("12345678")), 0,
+            "zst WAL segment copied");
+        TEST_RESULT_INT(storageInfoNP(storageTest, walDestination).size, 16 * 1024 * 1024, "  check size");
+#endif
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
@@ -296,6 +296,51 @@ testRun(void)
                     TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
             true, "check repo for WAL file");
 
+#ifdef HAVE_LIBLZ4
+        // Push a WAL segment with lz4 compression
+        // -------------------------------------------------------------------------------------------------------------------------
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "--compress-type=lz4");
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000003");
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("pg_wal/000000010000000100000003")), walBuffer2);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment with lz4");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsNP(
+                storageTest,
+                strNewFmt(
+                    "repo/archive/test/11-1/0000000100000001/000000010000000100000003-%s.lz4",
+                    TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
+            true, "check repo for lz4 WAL file");
+#endif
+
+#ifdef HAVE_LIBZSTD
+        // Push a WAL segment with multi-threaded zst compression
+        // -------------------------------------------------------------------------------------------------------------------------
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "--compress-type=zst");
+        strLstAddZ(argListTemp, "--compress-thread=2");
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000004");
+        harnessCfgLoad(cfgCmdArchivePush, argListTemp);
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("pg_wal/000000010000000100000004")), walBuffer2);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment with zst");
+        harnessLogResult("P00   INFO: pushed WAL file '000000010000000100000004' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsNP(
+                storageTest,
+                strNewFmt(
+                    "repo/archive/test/11-1/0000000100000001/000000010000000100000004-%s.zst",
+                    TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
+            true, "check repo for zst WAL file");
+#endif
+
         // Push a history file
         // -------------------------------------------------------------------------------------------------------------------------
         argListTemp = strLstDup(argList);
@@ -344,8 +389,9 @@ testRun(void)
         varLstAdd(paramList, varNewStrZ("000000010000000100000002"));
         varLstAdd(paramList, varNewUInt64(cipherTypeNone));
         varLstAdd(paramList, NULL);
-        varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewUInt(compressTypeNone));
         varLstAdd(paramList, varNewInt(6));
+        varLstAdd(paramList, varNewUInt(1));
 
         TEST_RESULT_BOOL(
             archivePushProtocol(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR, paramList, server), true, "protocol archive put");
@@ -1,12 +1,22 @@
 /***********************************************************************************************************************************
 Test Common Functions and Definitions for Backup and Expire Commands
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "common/crypto/hash.h"
+#include "common/crypto/xxHash.h"
+#include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/filter/size.h"
+#include "common/io/io.h"
 #include "common/regExp.h"
 #include "common/type/json.h"
 #include "postgres/interface.h"
 #include "storage/posix/storage.h"
 
+#include "common/harnessConfig.h"
+
 /***********************************************************************************************************************************
 Need these structures to mock up test data
 ***********************************************************************************************************************************/
@@ -266,5 +276,215 @@ testRun(void)
         TEST_RESULT_STR(strPtr(backupTypeStr(backupTypeIncr)), "incr", "backup type str incr");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("backupCipherType()"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        harnessCfgLoad(cfgCmdBackup, argList);
+
+        TEST_RESULT_UINT(backupCipherType(NULL), cipherTypeNone, "no cipher pass");
+        TEST_RESULT_UINT(backupCipherType(STRDEF("X")), cipherTypeAes256Cbc, "cipher type not set falls back to aes-256-cbc");
+
+        strLstAddZ(argList, "--repo1-cipher-type=aes-256-gcm");
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "12345678", true);
+        harnessCfgLoad(cfgCmdBackup, argList);
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        TEST_RESULT_UINT(backupCipherType(STRDEF("X")), cipherTypeAes256Gcm, "cipher type aes-256-gcm");
+
+        harnessCfgLoad(cfgCmdVersion, strLstNew());
+
+        TEST_RESULT_UINT(backupCipherType(STRDEF("X")), cipherTypeAes256Cbc, "cipher type not valid falls back to aes-256-cbc");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("BackupChecksum"))
+    {
+        // Buffer spans more than one chunk and ends in a partial page
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *buffer = bufNew(PG_PAGE_SIZE_DEFAULT * 10 - (PG_PAGE_SIZE_DEFAULT - 512));
+        Buffer *bufferOut = bufNew(0);
+        bufUsedSet(buffer, bufSize(buffer));
+        memset(bufPtr(buffer), 0, bufSize(buffer));
+
+        // Page 1 is in the first chunk and page 8 is in the second chunk. Both have bogus checksums.
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x01)))->pd_upper = 0x01;
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x01)))->pd_lsn.walid = 0xF0F0F0F0;
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x08)))->pd_upper = 0x01;
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x08)))->pd_lsn.walid = 0xF0F0F0F0;
+
+        IoWrite *write = ioBufferWriteNew(bufferOut);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), cryptoHashNew(HASH_TYPE_SHA1_STR));
+        ioFilterGroupAdd(ioWriteFilterGroup(write), ioSizeNew());
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(write), pageChecksumNew(0, PG_SEGMENT_PAGE_DEFAULT, PG_PAGE_SIZE_DEFAULT, 0xFACEFACE00000000));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(write),
+            backupChecksumNewVar(
+                varVarLst(
+                    jsonToVar(
+                        strNewFmt(
+                            "[true,false,true,0,%u,%u,%" PRIu64 "]", PG_SEGMENT_PAGE_DEFAULT, PG_PAGE_SIZE_DEFAULT,
+                            0xFACEFACE00000000)))));
+        ioWriteOpen(write);
+        ioWrite(write, buffer);
+        ioWriteClose(write);
+
+        const Variant *result = ioFilterGroupResult(ioWriteFilterGroup(write), BACKUP_CHECKSUM_FILTER_TYPE_STR);
+
+        TEST_RESULT_STR(
+            strPtr(varStr(backupChecksumResult(result, CRYPTO_HASH_FILTER_TYPE_STR))),
+            strPtr(varStr(ioFilterGroupResult(ioWriteFilterGroup(write), CRYPTO_HASH_FILTER_TYPE_STR))),
+            "sha1 matches hash filter");
+        TEST_RESULT_UINT(
+            varUInt64(backupChecksumResult(result, SIZE_FILTER_TYPE_STR)),
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(write), SIZE_FILTER_TYPE_STR)), "size matches size filter");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(backupChecksumResult(result, PAGE_CHECKSUM_FILTER_TYPE_STR))),
+            strPtr(jsonFromVar(ioFilterGroupResult(ioWriteFilterGroup(write), PAGE_CHECKSUM_FILTER_TYPE_STR))),
+            "page checksum matches page checksum filter");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(backupChecksumResult(result, PAGE_CHECKSUM_FILTER_TYPE_STR))),
+            "{\"align\":false,\"error\":[1,8],\"valid\":false}", "    check page checksum errors");
+        TEST_RESULT_PTR(backupChecksumResult(result, XXHASH_FILTER_TYPE_STR), NULL, "    no fast checksum");
+
+        // Size only
+        // -------------------------------------------------------------------------------------------------------------------------
+        write = ioBufferWriteNew(bufferOut);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), backupChecksumNew(false, false, false, 0, 0, 0, 0));
+        ioWriteOpen(write);
+        ioWrite(write, BUFSTRDEF("abc"));
+        ioWriteClose(write);
+
+        result = ioFilterGroupResult(ioWriteFilterGroup(write), BACKUP_CHECKSUM_FILTER_TYPE_STR);
+
+        TEST_RESULT_STR(strPtr(jsonFromVar(result)), "{\"size\":3}", "size only");
+
+#ifdef HAVE_LIBXXHASH
+        // Fast checksum
+        // -------------------------------------------------------------------------------------------------------------------------
+        write = ioBufferWriteNew(bufferOut);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), backupChecksumNew(false, true, false, 0, 0, 0, 0));
+        ioWriteOpen(write);
+        ioWrite(write, BUFSTRDEF("abc"));
+        ioWriteClose(write);
+
+        result = ioFilterGroupResult(ioWriteFilterGroup(write), BACKUP_CHECKSUM_FILTER_TYPE_STR);
+
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(result)), "{\"size\":3,\"xxHash\":\"06b05ab6733a618578af5f94892f3950\"}", "fast checksum");
+#endif
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("BlockIncr"))
+    {
+        Storage *storageTest = storagePosixNew(
+            strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+        // Four pages and a partial page. Pages 1 and 2 changed since the prior backup started.
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *buffer = bufNew(PG_PAGE_SIZE_DEFAULT * 4 + 100);
+        bufUsedSet(buffer, bufSize(buffer));
+        memset(bufPtr(buffer), 0xAA, bufSize(buffer));
+
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x00)))->pd_lsn = (PageWalRecPtr){.walid = 1, .xrecoff = 0};
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x01)))->pd_lsn = (PageWalRecPtr){.walid = 2, .xrecoff = 0};
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x02)))->pd_lsn = (PageWalRecPtr){.walid = 0, .xrecoff = 0};
+        ((PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x03)))->pd_lsn = (PageWalRecPtr){.walid = 1, .xrecoff = 1};
+
+        // Use an output buffer smaller than a page so records must be split across output buffers
+        ioBufferSizeSet(PG_PAGE_SIZE_DEFAULT / 3);
+
+        Buffer *blockIncr = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(blockIncr);
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(write),
+            blockIncrNewVar(varVarLst(jsonToVar(strNewFmt("[%u,%" PRIu64 "]", PG_PAGE_SIZE_DEFAULT, (uint64_t)2 << 32)))));
+        ioWriteOpen(write);
+        ioWrite(write, BUF(bufPtr(buffer), PG_PAGE_SIZE_DEFAULT + 10));
+        ioWrite(write, BUF(bufPtr(buffer) + PG_PAGE_SIZE_DEFAULT + 10, bufUsed(buffer) - PG_PAGE_SIZE_DEFAULT - 10));
+        ioWriteClose(write);
+
+        TEST_RESULT_UINT(
+            varUInt(ioFilterGroupResult(ioWriteFilterGroup(write), BLOCK_INCR_FILTER_TYPE_STR)), 3, "three pages stored");
+        TEST_RESULT_UINT(
+            bufUsed(blockIncr), (BLOCK_INCR_PAGE_NO_SIZE + PG_PAGE_SIZE_DEFAULT) * 2 + BLOCK_INCR_PAGE_NO_SIZE + 100,
+            "    check size");
+        TEST_RESULT_UINT(
+            (unsigned int)bufPtr(blockIncr)[BLOCK_INCR_PAGE_NO_SIZE + PG_PAGE_SIZE_DEFAULT + 3], 2, "    check second page number");
+
+        ioBufferSizeSet(65536);
+
+        // Apply the block incremental to an empty file. The pages that were not stored remain zero.
+        // -------------------------------------------------------------------------------------------------------------------------
+        StorageWrite *pgWrite = storageNewWriteNP(storageTest, strNew("block"));
+        ioWriteOpen(storageWriteIo(pgWrite));
+
+        IoRead *read = ioBufferReadNew(blockIncr);
+        ioReadOpen(read);
+
+        TEST_RESULT_VOID(
+            blockIncrApply(read, PG_PAGE_SIZE_DEFAULT, ioWriteHandle(storageWriteIo(pgWrite)), strNew("block")),
+            "apply block incremental");
+        ioWriteClose(storageWriteIo(pgWrite));
+
+        memset(bufPtr(buffer), 0, PG_PAGE_SIZE_DEFAULT);
+        memset(bufPtr(buffer) + PG_PAGE_SIZE_DEFAULT * 3, 0, PG_PAGE_SIZE_DEFAULT);
+
+        TEST_RESULT_BOOL(bufEq(storageGetNP(storageNewReadNP(storageTest, strNew("block"))), buffer), true, "    check file");
+
+        // Errors
+        // -------------------------------------------------------------------------------------------------------------------------
+        read = ioBufferReadNew(BUF(bufPtr(blockIncr), BLOCK_INCR_PAGE_NO_SIZE - 1));
+        ioReadOpen(read);
+
+        TEST_ERROR(
+            blockIncrApply(read, PG_PAGE_SIZE_DEFAULT, 0, strNew("block")), FormatError,
+            "block incremental for 'block' ends in a page number");
+
+        read = ioBufferReadNew(BUF(bufPtr(blockIncr), BLOCK_INCR_PAGE_NO_SIZE));
+        ioReadOpen(read);
+
+        TEST_ERROR(
+            blockIncrApply(read, PG_PAGE_SIZE_DEFAULT, 0, strNew("block")), FormatError,
+            "block incremental for 'block' is missing a page");
+
+        int fd = open(strPtr(storagePathNP(storageTest, strNew("block"))), O_RDONLY);
+
+        read = ioBufferReadNew(blockIncr);
+        ioReadOpen(read);
+
+        TEST_ERROR(
+            blockIncrApply(read, PG_PAGE_SIZE_DEFAULT, fd, strNew("block")), FileWriteError,
+            "unable to write 'block': [9] Bad file descriptor");
+
+        close(fd);
+
+        // Without a prior backup only pages that are not all zero are stored. The partial page is stored even when it is zero.
+        // -------------------------------------------------------------------------------------------------------------------------
+        buffer = bufNew(PG_PAGE_SIZE_DEFAULT * 3 + 100);
+        bufUsedSet(buffer, bufSize(buffer));
+        memset(bufPtr(buffer), 0, bufSize(buffer));
+        memset(bufPtr(buffer), 0xAA, PG_PAGE_SIZE_DEFAULT);
+        bufPtr(buffer)[PG_PAGE_SIZE_DEFAULT * 3 - 1] = 0xAA;
+
+        blockIncr = bufNew(0);
+        write = ioBufferWriteNew(blockIncr);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), blockIncrNew(PG_PAGE_SIZE_DEFAULT, 0));
+        ioWriteOpen(write);
+        ioWrite(write, buffer);
+        ioWriteClose(write);
+
+        TEST_RESULT_UINT(
+            varUInt(ioFilterGroupResult(ioWriteFilterGroup(write), BLOCK_INCR_FILTER_TYPE_STR)), 3, "three pages stored");
+        TEST_RESULT_UINT(
+            (unsigned int)bufPtr(blockIncr)[BLOCK_INCR_PAGE_NO_SIZE + PG_PAGE_SIZE_DEFAULT + 3], 2, "    check second page number");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
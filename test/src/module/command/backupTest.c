@@ -4,11 +4,47 @@ Test Backup Command
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/io/io.h"
+#include "common/compress/helper.h"
+#include "common/crypto/cipherBlock.h"
+#include "postgres/interface.h"
 #include "storage/helper.h"
 #include "storage/posix/storage.h"
 
 #include "common/harnessConfig.h"
 
+#ifdef HAVE_LIBZSTD
+
+/***********************************************************************************************************************************
+Generate relation pages that share a vocabulary, so there is little repetition within a page but a lot across pages
+***********************************************************************************************************************************/
+static Buffer *
+testRelation(unsigned int pageTotal, uint32_t seed)
+{
+    Buffer *result = bufNew(PG_PAGE_SIZE_DEFAULT * pageTotal);
+    uint32_t random = seed;
+
+    while (bufUsed(result) < bufSize(result))
+    {
+        random = random * 1103515245 + 12345;
+
+        // Each word is deterministic for its index in the vocabulary
+        unsigned char word[8];
+        uint32_t wordRandom = (random >> 16) % 2048 + 1;
+
+        for (unsigned int charIdx = 0; charIdx < sizeof(word); charIdx++)
+        {
+            wordRandom = wordRandom * 1103515245 + 12345;
+            word[charIdx] = (unsigned char)('a' + (wordRandom >> 16) % 26);
+        }
+
+        bufCatC(result, word, 0, sizeof(word));
+    }
+
+    return result;
+}
+
+#endif // HAVE_LIBZSTD
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -58,7 +94,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+                missingFile, true, 0, NULL, NULL, false, 0, 0, false, missingFile, false, compressTypeNone, 1, 1, false, NULL,
+                backupLabel, false, false, cipherTypeNone, NULL),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -70,26 +107,34 @@ testRun(void)
         varLstAdd(paramList, varNewBool(true));             // pgFileIgnoreMissing
         varLstAdd(paramList, varNewUInt64(0));              // pgFileSize
         varLstAdd(paramList, NULL);                         // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumFast
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 1
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 2
         varLstAdd(paramList, varNewStr(missingFile));       // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
-        varLstAdd(paramList, varNewBool(false));            // repoFileCompress
+        varLstAdd(paramList, varNewStrZ("none"));           // repoFileCompressType
         varLstAdd(paramList, varNewUInt(0));                // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt(1));                // repoFileCompressThread
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAuto
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressDict
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // checksumFast
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrLsn
+        varLstAdd(paramList, varNewBool(false));            // zeroElide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - skip");
-        TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":[3,0,0,null,null]}\n", "    check result");
+        TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":[3,0,0,null,null,false,false,null,false]}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         // Pg file missing - ignoreMissing=false
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ERROR_FMT(
             backupFile(
-                missingFile, false, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+                missingFile, false, 0, NULL, NULL, false, 0, 0, false, missingFile, false, compressTypeNone, 1, 1, false, NULL,
+                backupLabel, false, false, cipherTypeNone, NULL),
             FileMissingError, "unable to open missing file '%s/pg/missing' for read", testPath());
 
         // Create a pg file to backup
@@ -104,7 +149,9 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+            backupFile(
+                pgFile, false, 9, NULL, NULL, false, 0, 0, false, pgFile, false, compressTypeNone, 1, 1, false, NULL, backupLabel,
+                false, false, cipherTypeNone, NULL),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         ((Storage *)storageRepo())->interface.feature = feature;
@@ -123,8 +170,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, false, 1, backupLabel, false, cipherTypeNone,
-                NULL),
+                pgFile, false, 9, NULL, NULL, true, 0xFFFFFFFFFFFFFFFF, 0, false, pgFile, false, compressTypeNone, 1, 1, false,
+                NULL, backupLabel, false, false, cipherTypeNone, NULL),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -145,21 +192,29 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // pgFileIgnoreMissing
         varLstAdd(paramList, varNewUInt64(9));              // pgFileSize
         varLstAdd(paramList, NULL);                         // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumFast
         varLstAdd(paramList, varNewBool(true));             // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0xFFFFFFFF));     // pgFileChecksumPageLsnLimit 1
         varLstAdd(paramList, varNewUInt64(0xFFFFFFFF));     // pgFileChecksumPageLsnLimit 2
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
-        varLstAdd(paramList, varNewBool(false));            // repoFileCompress
+        varLstAdd(paramList, varNewStrZ("none"));           // repoFileCompressType
         varLstAdd(paramList, varNewUInt(1));                // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt(1));                // repoFileCompressThread
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAuto
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressDict
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // checksumFast
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrLsn
+        varLstAdd(paramList, varNewBool(false));            // zeroElide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - pageChecksum");
         TEST_RESULT_STR(
             strPtr(strNewBuf(serverWrite)),
-            "{\"out\":[1,9,9,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",{\"align\":false,\"valid\":false}]}\n",
+            "{\"out\":[1,9,9,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",{\"align\":false,\"valid\":false},false,false,null,"
+                "false]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
 
@@ -168,8 +223,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, true,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeNone, NULL),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 0, "    repo size not set since already exists in repo");
@@ -187,30 +242,66 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // pgFileIgnoreMissing
         varLstAdd(paramList, varNewUInt64(9));              // pgFileSize
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));   // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumFast
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 1
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 2
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(true));             // repoFileHasReference
-        varLstAdd(paramList, varNewBool(false));            // repoFileCompress
+        varLstAdd(paramList, varNewStrZ("none"));           // repoFileCompressType
         varLstAdd(paramList, varNewUInt(1));                // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt(1));                // repoFileCompressThread
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAuto
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressDict
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(true));             // delta
+        varLstAdd(paramList, varNewBool(false));            // checksumFast
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrLsn
+        varLstAdd(paramList, varNewBool(false));            // zeroElide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - noop");
         TEST_RESULT_STR(
-            strPtr(strNewBuf(serverWrite)), "{\"out\":[4,9,0,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
+            strPtr(strNewBuf(serverWrite)),
+            "{\"out\":[4,9,0,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,false,false,null,false]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
 
+#ifdef HAVE_LIBXXHASH
+        // -------------------------------------------------------------------------------------------------------------------------
+        // File exists in repo and db, fast checksum match, delta set, hasReference - NOOP without calculating the sha1
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), strNew("12f8c02a0617441f0db078e863be4061"),
+                false, 0, 0, false, pgFile, true, compressTypeNone, 1, 1, false, NULL, backupLabel, true, true, cipherTypeNone,
+                NULL),
+            "file in db and repo, fast checksum equal, delta, hasReference");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultNoOp, "    noop file");
+        TEST_RESULT_STR(strPtr(result.copyChecksum), "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    sha1 from manifest");
+        TEST_RESULT_STR(strPtr(result.copyChecksumFast), "12f8c02a0617441f0db078e863be4061", "    fast checksum");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // File exists in repo and db, fast checksum mismatch, delta set, hasReference - COPY and record the fast checksum
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), strNew("bccad7d9b36352e55876920309378552"),
+                false, 0, 0, false, pgFile, true, compressTypeNone, 1, 1, false, NULL, backupLabel, true, true, cipherTypeNone,
+                NULL),
+            "file in db and repo, fast checksum not equal, delta, hasReference");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_STR(strPtr(result.copyChecksum), "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    sha1");
+        TEST_RESULT_STR(strPtr(result.copyChecksumFast), "12f8c02a0617441f0db078e863be4061", "    fast checksum");
+#endif
+
         // -------------------------------------------------------------------------------------------------------------------------
         // File exists in repo and db, pg checksum mismatch, delta set, ignoreMissing false, hasReference - COPY
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), NULL, false, 0, 0, false, pgFile, true,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeNone, NULL),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -224,8 +315,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, true,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeNone, NULL),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -242,8 +333,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeNone, NULL),
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeNone, NULL),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    recopy file");
@@ -260,8 +351,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeNone, NULL),
+                missingFile, true, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeNone, NULL),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -273,7 +364,9 @@ testRun(void)
         // No prior checksum, compression, no page checksum, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(pgFile, false, 9, NULL, false, 0, pgFile, false, true, 3, backupLabel, false, cipherTypeNone, NULL),
+            backupFile(
+                pgFile, false, 9, NULL, NULL, false, 0, 0, false, pgFile, false, compressTypeGzip, 3, 1, false, NULL, backupLabel,
+                false, false, cipherTypeNone, NULL),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -284,14 +377,41 @@ testRun(void)
                 storageExistsNP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(backupLabel), strPtr(pgFile))) &&
                 result.pageChecksumResult == NULL),
             true, "    copy file to repo compress success");
+        TEST_RESULT_BOOL(result.compressBypass, false, "    compression not bypassed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Compression is bypassed for a file that is not compressible
+        Buffer *incompressible = bufNew(128 * 1024);
+        uint32_t seed = 1;
+
+        for (size_t idx = 0; idx < bufSize(incompressible); idx++)
+        {
+            seed = seed * 1103515245 + 12345;
+            bufPtr(incompressible)[idx] = (unsigned char)(seed >> 16);
+        }
+
+        bufUsedSet(incompressible, bufSize(incompressible));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("incompressible")), incompressible);
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                strNew("incompressible"), false, 128 * 1024, NULL, NULL, false, 0, 0, false, strNew("incompressible"), false,
+                compressTypeGzip, 3, 1, false, NULL, backupLabel, false, false, cipherTypeNone, NULL),
+            "pg file not compressible, compression");
+
+        TEST_RESULT_UINT(result.copySize, 128 * 1024, "    copy=pgFile size");
+        TEST_RESULT_BOOL(result.repoSize > result.copySize, true, "    repo size includes stored block overhead");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_BOOL(result.compressBypass, true, "    compression bypassed");
 
         // -------------------------------------------------------------------------------------------------------------------------
         // Pg and repo file exist & match, prior checksum, compression, no page checksum, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, true, 3, backupLabel,
-                false, cipherTypeNone, NULL),
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeGzip, 3, 1, false, NULL, backupLabel, false, false, cipherTypeNone, NULL),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -311,23 +431,87 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // pgFileIgnoreMissing
         varLstAdd(paramList, varNewUInt64(9));              // pgFileSize
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));   // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumFast
         varLstAdd(paramList, varNewBool(false));            // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 1
         varLstAdd(paramList, varNewUInt64(0));              // pgFileChecksumPageLsnLimit 2
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
-        varLstAdd(paramList, varNewBool(true));             // repoFileCompress
+        varLstAdd(paramList, varNewStrZ("gz"));             // repoFileCompressType
         varLstAdd(paramList, varNewUInt(3));                // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt(1));                // repoFileCompressThread
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressLevelAuto
+        varLstAdd(paramList, varNewBool(false));            // repoFileCompressDict
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // checksumFast
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrLsn
+        varLstAdd(paramList, varNewBool(false));            // zeroElide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - copy, compress");
         TEST_RESULT_STR(
-            strPtr(strNewBuf(serverWrite)), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
+            strPtr(strNewBuf(serverWrite)),
+            "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,false,false,null,false]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
 
+#ifdef HAVE_LIBLZ4
+        // -------------------------------------------------------------------------------------------------------------------------
+        // No prior checksum, lz4 compression, no page checksum, no pageChecksum, no delta, no hasReference
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, NULL, NULL, false, 0, 0, false, pgFile, false, compressTypeLz4, 1, 1, false, NULL, backupLabel,
+                false, false, cipherTypeNone, NULL),
+            "pg file exists, no checksum, no ignoreMissing, lz4 compression, no pageChecksum, no delta, no hasReference");
+
+        TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
+        TEST_RESULT_UINT(result.repoSize, 28, "    repo compress size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_BOOL(
+            storageExistsNP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.lz4", strPtr(backupLabel), strPtr(pgFile))),
+            true, "    copy file to repo lz4 compress success");
+
+        // Pg and repo file exist & match, prior checksum, lz4 compression
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeLz4, 1, 1, false, NULL, backupLabel, false, false, cipherTypeNone, NULL),
+            "pg file & repo exists, match, checksum, lz4 compression, no pageChecksum, no delta, no hasReference");
+
+        TEST_RESULT_UINT(result.repoSize, 28, "    repo compress size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultChecksum, "    checksum file");
+#endif
+
+#ifdef HAVE_LIBZSTD
+        // -------------------------------------------------------------------------------------------------------------------------
+        // No prior checksum, threaded zst compression, no page checksum, no pageChecksum, no delta, no hasReference
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, NULL, NULL, false, 0, 0, false, pgFile, false, compressTypeZst, 3, 2, false, NULL, backupLabel,
+                false, false, cipherTypeNone, NULL),
+            "pg file exists, no checksum, no ignoreMissing, zst compression, no pageChecksum, no delta, no hasReference");
+
+        TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_BOOL(
+            storageExistsNP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.zst", strPtr(backupLabel), strPtr(pgFile))),
+            true, "    copy file to repo zst compress success");
+
+        // Pg and repo file exist & match, prior checksum, zst compression
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeZst, 3, 1, false, NULL, backupLabel, false, false, cipherTypeNone, NULL),
+            "pg file & repo exists, match, checksum, zst compression, no pageChecksum, no delta, no hasReference");
+
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultChecksum, "    checksum file");
+#endif
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a zero sized file - checksum will be set but in backupManifestUpdate it will not be copied
         storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("zerofile")), BUFSTRDEF(""));
@@ -336,8 +520,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                strNew("zerofile"), false, 0, NULL, false, 0, strNew("zerofile"), false, false, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                strNew("zerofile"), false, 0, NULL, NULL, false, 0, 0, false, strNew("zerofile"), false, compressTypeNone, 1, 1,
+                false, NULL, backupLabel, false, false, cipherTypeNone, NULL),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -377,8 +561,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false, cipherTypeAes256Cbc,
-                strNew("12345678")),
+                pgFile, false, 9, NULL, NULL, false, 0, 0, false, pgFile, false, compressTypeNone, 1, 1, false, NULL, backupLabel,
+                false, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -394,8 +578,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
+                pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeNone, 1, 1, false, NULL, backupLabel, true, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -411,8 +595,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, false, false, 0,
-                backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
+                pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), NULL, false, 0, 0, false, pgFile, false,
+                compressTypeNone, 0, 1, false, NULL, backupLabel, false, false, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -430,24 +614,124 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));                // pgFileIgnoreMissing
         varLstAdd(paramList, varNewUInt64(9));                  // pgFileSize
         varLstAdd(paramList, varNewStrZ("1234567890123456789012345678901234567890"));   // pgFileChecksum
+        varLstAdd(paramList, NULL);                         // pgFileChecksumFast
         varLstAdd(paramList, varNewBool(false));                // pgFileChecksumPage
         varLstAdd(paramList, varNewUInt64(0));                  // pgFileChecksumPageLsnLimit 1
         varLstAdd(paramList, varNewUInt64(0));                  // pgFileChecksumPageLsnLimit 2
         varLstAdd(paramList, varNewStr(pgFile));                // repoFile
         varLstAdd(paramList, varNewBool(false));                // repoFileHasReference
-        varLstAdd(paramList, varNewBool(false));                // repoFileCompress
+        varLstAdd(paramList, varNewStrZ("none"));               // repoFileCompressType
         varLstAdd(paramList, varNewUInt(0));                    // repoFileCompressLevel
+        varLstAdd(paramList, varNewUInt(1));                    // repoFileCompressThread
+        varLstAdd(paramList, varNewBool(false));                // repoFileCompressLevelAuto
+        varLstAdd(paramList, varNewBool(false));                // repoFileCompressDict
         varLstAdd(paramList, varNewStr(backupLabel));           // backupLabel
         varLstAdd(paramList, varNewBool(false));                // delta
+        varLstAdd(paramList, varNewBool(false));            // checksumFast
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrLsn
+        varLstAdd(paramList, varNewBool(false));            // zeroElide
         varLstAdd(paramList, varNewStrZ("12345678"));           // cipherPass
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - recopy, encrypt");
         TEST_RESULT_STR(
-            strPtr(strNewBuf(serverWrite)), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
+            strPtr(strNewBuf(serverWrite)),
+            "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,false,false,null,false]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("backupDictCreate(), backupDictGet(), backupProtocol"))
+    {
+        // Load Parameters
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        strLstAddZ(argList, "--repo1-cipher-type=aes-256-cbc");
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "12345678", true);
+        harnessCfgLoad(cfgCmdBackup, argList);
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        const String *dictFile = strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_COMPRESS_DICT_FILE, strPtr(backupLabel));
+        const String *cipherPass = strNew("12345678");
+
+        // Create the pg path
+        storagePathCreateP(storagePgWrite(), NULL, .mode = 0700);
+
+        // Not enough data to train
+        // -------------------------------------------------------------------------------------------------------------------------
+        StringList *pgFileList = strLstNew();
+        strLstAdd(pgFileList, missingFile);
+
+        TEST_RESULT_BOOL(
+            backupDictCreate(pgFileList, backupLabel, cipherTypeAes256Cbc, cipherPass), false, "missing file cannot be trained");
+#ifdef HAVE_LIBZSTD
+        harnessLogResult(
+            "P00   WARN: unable to train compression dictionary, relation files will be compressed without a dictionary");
+#endif // HAVE_LIBZSTD
+        TEST_RESULT_BOOL(storageExistsNP(storageRepo(), dictFile), false, "    dictionary not written");
+
+#ifdef HAVE_LIBZSTD
+        // Train the dictionary
+        // -------------------------------------------------------------------------------------------------------------------------
+        for (unsigned int relationIdx = 0; relationIdx < 4; relationIdx++)
+        {
+            const String *relation = strNewFmt("base/1/%u", 16384 + relationIdx);
+            Buffer *relationData = testRelation(16, relationIdx + 1);
+
+            // The last relation ends in a partial page that will not be sampled
+            if (relationIdx == 3)
+                bufCat(relationData, BUFSTRDEF("partial"));
+
+            storagePutNP(storageNewWriteNP(storagePgWrite(), relation), relationData);
+            strLstAdd(pgFileList, relation);
+        }
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewVarLst(varLstNewStrLst(pgFileList)));
+        varLstAdd(paramList, varNewStr(backupLabel));
+        varLstAdd(paramList, varNewStr(cipherPass));
+
+        TEST_RESULT_BOOL(backupProtocol(PROTOCOL_COMMAND_BACKUP_DICT_STR, paramList, server), true, "protocol backup dict");
+        TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":true}\n", "    check result");
+        bufUsedSet(serverWrite, 0);
+
+        TEST_RESULT_BOOL(storageExistsNP(storageRepo(), dictFile), true, "    dictionary written");
+
+        // Get the dictionary and make sure it is cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        const Buffer *dict = NULL;
+
+        TEST_ASSIGN(dict, backupDictGet(backupLabel, cipherTypeAes256Cbc, cipherPass), "get dictionary");
+        TEST_RESULT_BOOL(bufUsed(dict) > 0, true, "    dictionary loaded");
+        TEST_RESULT_PTR(backupDictGet(backupLabel, cipherTypeAes256Cbc, cipherPass), dict, "    dictionary cached");
+
+        // Backup a relation with the dictionary
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *relation = strLstGet(pgFileList, 1);
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                relation, false, PG_PAGE_SIZE_DEFAULT * 16, NULL, NULL, false, 0, 0, false, relation, false, compressTypeZst, 3, 1,
+                true, dict, backupLabel, false, false, cipherTypeAes256Cbc, cipherPass),
+            "backup relation with dictionary and level auto");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_BOOL(result.compressDict, true, "    dictionary used");
+
+        StorageRead *read = storageNewReadNP(
+            storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.zst", strPtr(backupLabel), strPtr(relation)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeZst, dict));
+
+        TEST_RESULT_BOOL(bufEq(storageGetNP(read), testRelation(16, 1)), true, "    decompress relation with dictionary");
+#endif // HAVE_LIBZSTD
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -149,6 +149,8 @@ testRun(void)
             "\n"
             "  --buffer-size                    buffer size for file operations\n"
             "                                   [current=32768, default=4194304]\n"
+            "  --cache-drop                     drop file data from the page cache after it\n"
+            "                                   is read or written [default=n]\n"
             "  --cmd-ssh                        path to ssh client executable [default=ssh]\n"
             "  --compress                       use gzip file compression [default=y]\n"
             "  --compress-level                 compression level for stored files\n"
@@ -162,6 +164,14 @@ testRun(void)
             "  --config-path                    base path of pgBackRest configuration files\n"
             "                                   [default=/etc/pgbackrest]\n"
             "  --delta                          restore or backup using checksums [default=n]\n"
+            "  --direct-io                      read and write files without the page cache\n"
+            "                                   [default=n]\n"
+            "  --filter-stat                    log time and bytes for each file filter\n"
+            "                                   [default=n]\n"
+            "  --filter-thread                  run file filters in separate threads\n"
+            "                                   [default=n]\n"
+            "  --io-queue-depth                 reads or writes in flight for each file\n"
+            "                                   [default=1]\n"
             "  --lock-path                      path where lock files are stored\n"
             "                                   [default=/tmp/pgbackrest]\n"
             "  --neutral-umask                  use a neutral umask [default=y]\n"
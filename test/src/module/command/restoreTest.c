@@ -1,8 +1,11 @@
 /***********************************************************************************************************************************
 Test Restore Command
 ***********************************************************************************************************************************/
+#include "command/backup/blockIncr.h"
 #include "common/compress/gzip/compress.h"
+#include "common/compress/lz4/compress.h"
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
 #include "common/io/io.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
@@ -174,14 +177,16 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("sparse-zero"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("sparse-zero"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 true, 0x10000000000UL, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             false, "zero sparse 1TB file");
         TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("sparse-zero")).size, 0x10000000000UL, "    check size");
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("normal-zero"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("normal-zero"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 0, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
             true, "zero-length file");
         TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("normal-zero")).size, 0, "    check size");
@@ -198,7 +203,8 @@ testRun(void)
 
         TEST_ERROR(
             restoreFile(
-                repoFile1, repoFileReferenceFull, true, strNew("normal"), strNew("ffffffffffffffffffffffffffffffffffffffff"),
+                repoFile1, repoFileReferenceFull, compressTypeGzip, NULL, NULL, false, strNew("normal"),
+                strNew("ffffffffffffffffffffffffffffffffffffffff"), NULL,
                 false, 7, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, strNew("badpass")),
             ChecksumError,
             "error restoring 'normal': actual checksum 'd1cd8a7d11daa26814b93eb604e1d49ab4b43770' does not match expected checksum"
@@ -206,7 +212,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, true, strNew("normal"), strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"),
+                repoFile1, repoFileReferenceFull, compressTypeGzip, NULL, NULL, false, strNew("normal"),
+                strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), NULL,
                 false, 7, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, strNew("badpass")),
             true, "copy file");
 
@@ -220,6 +227,25 @@ testRun(void)
         TEST_RESULT_STR(
             strPtr(strNewBuf(storageGetNP(storageNewReadNP(storagePg(), strNew("normal"))))), "acefile", "    check contents");
 
+#ifdef HAVE_LIBLZ4
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Create an lz4 compressed repo file
+        StorageWrite *lz4RepoFile = storageNewWriteNP(
+            storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.lz4", strPtr(repoFileReferenceFull), strPtr(repoFile1)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(lz4RepoFile)), lz4CompressNew(1));
+
+        storagePutNP(lz4RepoFile, BUFSTRDEF("lz4file"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoFileReferenceFull, compressTypeLz4, NULL, NULL, false, strNew("lz4"),
+                strNew("51b95aeecd71c2525404ea3b36820cc20b1277cc"), NULL, false, 7, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, false, NULL),
+            true, "copy lz4 file");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storagePg(), strNew("lz4"))))), "lz4file", "    check contents");
+#endif
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a repo file
         storagePutNP(
@@ -229,7 +255,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             true, "sha1 delta missing");
         TEST_RESULT_STR(
@@ -240,7 +267,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             false, "sha1 delta existing");
 
@@ -248,7 +276,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 1557432155, true, true, NULL),
             false, "sha1 delta force existing");
 
@@ -257,7 +286,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             true, "sha1 delta existing, size differs");
         TEST_RESULT_STR(
@@ -267,7 +297,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 1557432155, true, true, NULL),
             true, "delta force existing, size differs");
         TEST_RESULT_STR(
@@ -278,7 +309,8 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             true, "sha1 delta existing, content differs");
         TEST_RESULT_STR(
@@ -288,33 +320,328 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 1557432155, true, true, NULL),
             true, "delta force existing, timestamp differs");
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 1557432153, true, true, NULL),
             true, "delta force existing, timestamp after copy time");
 
+#ifdef HAVE_LIBXXHASH
+        // Fast checksum is compared instead of the sha1 when present
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("1234567890123456789012345678901234567890"), strNew("12f8c02a0617441f0db078e863be4061"),
+                false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
+            false, "fast delta existing");
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("delta")), BUFSTRDEF("btestfile"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), strNew("12f8c02a0617441f0db078e863be4061"),
+                false, 9, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
+            true, "fast delta existing, content differs");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storagePg(), strNew("delta"))))), "atestfile", "    check contents");
+#endif
+
+        // Update an existing file by writing only the blocks that differ
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *repoFileDelta = strNew("pg_data/delta-block");
+
+        Buffer *deltaBuffer = bufNew(PG_PAGE_SIZE_DEFAULT * 4);
+        bufUsedSet(deltaBuffer, PG_PAGE_SIZE_DEFAULT * 3 + 10);
+        memset(bufPtr(deltaBuffer), 0x01, bufUsed(deltaBuffer));
+        memset(bufPtr(deltaBuffer) + PG_PAGE_SIZE_DEFAULT, 0x02, PG_PAGE_SIZE_DEFAULT);
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strPtr(repoFileReferenceFull), strPtr(repoFileDelta))),
+            deltaBuffer);
+
+        const String *deltaChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, deltaBuffer));
+
+        // Existing file differs in the second block and has an extra block
+        Buffer *existingBuffer = bufNew(PG_PAGE_SIZE_DEFAULT * 4);
+        bufUsedSet(existingBuffer, PG_PAGE_SIZE_DEFAULT * 4);
+        memset(bufPtr(existingBuffer), 0x01, bufUsed(existingBuffer));
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("delta-block")), existingBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileDelta, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta-block"), deltaChecksum,
+                NULL, false, bufUsed(deltaBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
+            true, "block delta existing, size and content differ");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("delta-block"))), deltaBuffer), true, "    check contents");
+        TEST_RESULT_INT(
+            storageInfoNP(storagePg(), strNew("delta-block")).timeModified, 1557432154, "    check time");
+
+        // Existing file is shorter than the repo file
+        bufUsedSet(existingBuffer, PG_PAGE_SIZE_DEFAULT + 1);
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("delta-block")), existingBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileDelta, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta-block"), deltaChecksum,
+                NULL,
+                false, bufUsed(deltaBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 1557432155, true, true,
+                NULL),
+            true, "block delta force existing, size differs");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("delta-block"))), deltaBuffer), true, "    check contents");
+
+        // Checksum of the repo file does not match
+        TEST_ERROR_FMT(
+            restoreFile(
+                repoFileDelta, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta-block"),
+                strNew("ffffffffffffffffffffffffffffffffffffffff"), NULL, false, bufUsed(deltaBuffer), 1557432154, 0600,
+                strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
+            ChecksumError,
+            "error restoring 'delta-block': actual checksum '%s' does not match expected checksum"
+                " 'ffffffffffffffffffffffffffffffffffffffff'",
+            strPtr(deltaChecksum));
+
+        // Zero blocks are left as holes in a new file and punched out of an existing file
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *repoFileHole = strNew("pg_data/hole");
+
+        Buffer *holeBuffer = bufNew(PG_PAGE_SIZE_DEFAULT * 6);
+        bufUsedSet(holeBuffer, PG_PAGE_SIZE_DEFAULT * 6);
+        memset(bufPtr(holeBuffer), 0, bufUsed(holeBuffer));
+        memset(bufPtr(holeBuffer) + PG_PAGE_SIZE_DEFAULT, 0x03, PG_PAGE_SIZE_DEFAULT);
+        memset(bufPtr(holeBuffer) + PG_PAGE_SIZE_DEFAULT * 3, 0x04, PG_PAGE_SIZE_DEFAULT);
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strPtr(repoFileReferenceFull), strPtr(repoFileHole))),
+            holeBuffer);
+
+        const String *holeChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, holeBuffer));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileHole, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("hole"), holeChecksum, NULL, false,
+                bufUsed(holeBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
+            true, "new file with zero blocks");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("hole"))), holeBuffer), true, "    check contents");
+        TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("hole")).size, bufUsed(holeBuffer), "    check size");
+
+        // Blocks are written from unaligned buffers at any offset so direct io must be disabled on the file
+        storagePosixDirectSet(true);
+
+        StorageWrite *holeWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceFull), strPtr(repoFileHole)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(holeWrite)), gzipCompressNew(3, false));
+        storagePutNP(holeWrite, holeBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileHole, repoFileReferenceFull, compressTypeGzip, NULL, NULL, false, strNew("hole-direct"), holeChecksum, NULL,
+                false, bufUsed(holeBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
+            true, "new file with zero blocks and direct io");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("hole-direct"))), holeBuffer), true, "    check contents");
+
+        storagePosixDirectSet(false);
+
+        // Existing file has data where the repo file has zero blocks
+        memset(bufPtr(existingBuffer), 0x05, bufSize(existingBuffer));
+        bufUsedSet(existingBuffer, bufSize(existingBuffer));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("hole")), existingBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileHole, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("hole"), holeChecksum, NULL, false,
+                bufUsed(holeBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
+            true, "block delta existing, zero blocks differ");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("hole"))), holeBuffer), true, "    check contents");
+
         // Change the existing file to zero-length
         storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("delta")), BUFSTRDEF(""));
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoFileReferenceFull, false, strNew("delta"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"),
+                repoFile1, repoFileReferenceFull, compressTypeNone, NULL, NULL, false, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), NULL,
                 false, 0, 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, NULL),
             false, "sha1 delta existing, content differs");
 
+        // Reassemble a file stored as block incrementals
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *repoFileBlockIncr = strNew("pg_data/base/1/1");
+        const String *repoFileReferenceIncr1 = strNew("20190509F_20190510I");
+        const String *repoFileReferenceIncr2 = strNew("20190509F_20190511I");
+
+        // Full backup has two pages
+        Buffer *pgFileBuffer = bufNew(PG_PAGE_SIZE_DEFAULT * 3);
+        bufUsedSet(pgFileBuffer, PG_PAGE_SIZE_DEFAULT * 2);
+        memset(bufPtr(pgFileBuffer), 0x01, PG_PAGE_SIZE_DEFAULT * 2);
+        ((uint32_t *)bufPtr(pgFileBuffer))[0] = 1;
+        ((uint32_t *)(bufPtr(pgFileBuffer) + PG_PAGE_SIZE_DEFAULT))[0] = 1;
+
+        StorageWrite *blockIncrWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceFull), strPtr(repoFileBlockIncr)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), gzipCompressNew(3, false));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
+        storagePutNP(blockIncrWrite, pgFileBuffer);
+
+        // First incremental changes the second page and adds a third page
+        bufUsedSet(pgFileBuffer, PG_PAGE_SIZE_DEFAULT * 3);
+        memset(bufPtr(pgFileBuffer) + PG_PAGE_SIZE_DEFAULT, 0x02, PG_PAGE_SIZE_DEFAULT * 2);
+        ((uint32_t *)(bufPtr(pgFileBuffer) + PG_PAGE_SIZE_DEFAULT))[0] = 2;
+        ((uint32_t *)(bufPtr(pgFileBuffer) + PG_PAGE_SIZE_DEFAULT * 2))[0] = 2;
+
+        blockIncrWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceIncr1), strPtr(repoFileBlockIncr)));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), blockIncrNew(PG_PAGE_SIZE_DEFAULT, (uint64_t)2 << 32));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), gzipCompressNew(3, false));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
+        storagePutNP(blockIncrWrite, pgFileBuffer);
+
+        StringList *blockIncrChain = strLstNew();
+        strLstAdd(blockIncrChain, repoFileReferenceFull);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileBlockIncr, repoFileReferenceIncr1, compressTypeGzip, NULL, blockIncrChain, false, strNew("block-incr"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, pgFileBuffer)), NULL, false, bufUsed(pgFileBuffer), 1557432154,
+                0600, strNew(testUser()), strNew(testGroup()), 0, false, false, strNew("badpass")),
+            true, "restore block incremental");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("block-incr"))), pgFileBuffer), true, "    check contents");
+
+        // Second incremental truncates the file to one unchanged page
+        bufUsedSet(pgFileBuffer, PG_PAGE_SIZE_DEFAULT);
+
+        blockIncrWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceIncr2), strPtr(repoFileBlockIncr)));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), blockIncrNew(PG_PAGE_SIZE_DEFAULT, (uint64_t)3 << 32));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), gzipCompressNew(3, false));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
+        storagePutNP(blockIncrWrite, pgFileBuffer);
+
+        strLstAdd(blockIncrChain, repoFileReferenceIncr1);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileBlockIncr, repoFileReferenceIncr2, compressTypeGzip, NULL, blockIncrChain, false, strNew("block-incr"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, pgFileBuffer)), NULL, false, bufUsed(pgFileBuffer), 1557432154,
+                0600, strNew(testUser()), strNew(testGroup()), 0, false, false, strNew("badpass")),
+            true, "restore truncated block incremental");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("block-incr"))), pgFileBuffer), true, "    check contents");
+
+        TEST_ERROR_FMT(
+            restoreFile(
+                repoFileBlockIncr, repoFileReferenceIncr2, compressTypeGzip, NULL, blockIncrChain, false, strNew("block-incr"),
+                strNew("ffffffffffffffffffffffffffffffffffffffff"), NULL, false, bufUsed(pgFileBuffer), 1557432154, 0600,
+                strNew(testUser()), strNew(testGroup()), 0, false, false, strNew("badpass")),
+            ChecksumError,
+            "error restoring 'block-incr': actual checksum '%s' does not match expected checksum"
+                " 'ffffffffffffffffffffffffffffffffffffffff'",
+            strPtr(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, pgFileBuffer))));
+
+        // Reassemble a file with zero pages elided from the oldest backup
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *repoFileZeroElide = strNew("pg_data/base/1/2");
+
+        // Full backup has a zero page between two pages and two zero pages at the end
+        Buffer *zeroElideBuffer = bufNew(PG_PAGE_SIZE_DEFAULT * 5);
+        bufUsedSet(zeroElideBuffer, PG_PAGE_SIZE_DEFAULT * 5);
+        memset(bufPtr(zeroElideBuffer), 0, bufUsed(zeroElideBuffer));
+        memset(bufPtr(zeroElideBuffer), 0x01, PG_PAGE_SIZE_DEFAULT);
+        memset(bufPtr(zeroElideBuffer) + PG_PAGE_SIZE_DEFAULT * 2, 0x01, PG_PAGE_SIZE_DEFAULT);
+        ((uint32_t *)bufPtr(zeroElideBuffer))[0] = 1;
+        ((uint32_t *)(bufPtr(zeroElideBuffer) + PG_PAGE_SIZE_DEFAULT * 2))[0] = 1;
+
+        blockIncrWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceFull), strPtr(repoFileZeroElide)));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), blockIncrNew(PG_PAGE_SIZE_DEFAULT, 0));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), gzipCompressNew(3, false));
+        storagePutNP(blockIncrWrite, zeroElideBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileZeroElide, repoFileReferenceFull, compressTypeGzip, NULL, NULL, true, strNew("zero-elide"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, zeroElideBuffer)), NULL, false, bufUsed(zeroElideBuffer), 1557432154,
+                0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
+            true, "restore zero elided");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("zero-elide"))), zeroElideBuffer), true, "    check contents");
+
+        // Incremental fills the zero page between the other pages
+        StringList *zeroElideChain = strLstNew();
+        strLstAdd(zeroElideChain, repoFileReferenceFull);
+
+        memset(bufPtr(zeroElideBuffer) + PG_PAGE_SIZE_DEFAULT, 0x03, PG_PAGE_SIZE_DEFAULT);
+
+        blockIncrWrite = storageNewWriteNP(
+            storageRepoWrite(),
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strPtr(repoFileReferenceIncr1), strPtr(repoFileZeroElide)));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), blockIncrNew(PG_PAGE_SIZE_DEFAULT, (uint64_t)2 << 32));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(blockIncrWrite)), gzipCompressNew(3, false));
+        storagePutNP(blockIncrWrite, zeroElideBuffer);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileZeroElide, repoFileReferenceIncr1, compressTypeGzip, NULL, zeroElideChain, true, strNew("zero-elide"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, zeroElideBuffer)), NULL, false, bufUsed(zeroElideBuffer), 1557432154,
+                0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
+            true, "restore block incremental on zero elided");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("zero-elide"))), zeroElideBuffer), true, "    check contents");
+
+        // Pages are written from unaligned buffers so direct io must be disabled on the file
+        storagePosixDirectSet(true);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileZeroElide, repoFileReferenceIncr1, compressTypeGzip, NULL, zeroElideChain, true,
+                strNew("zero-elide-direct"), bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, zeroElideBuffer)), NULL, false,
+                bufUsed(zeroElideBuffer), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, false, false, NULL),
+            true, "restore block incremental on zero elided with direct io");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storagePg(), strNew("zero-elide-direct"))), zeroElideBuffer), true,
+            "    check contents");
+
+        storagePosixDirectSet(false);
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewStr(repoFile1));
         varLstAdd(paramList, varNewStr(repoFileReferenceFull));
+        varLstAdd(paramList, varNewStrZ("none"));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
+        varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewUInt64(9));
         varLstAdd(paramList, varNewUInt64(1557432100));
@@ -325,6 +652,8 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":true}\n", "    check result");
@@ -343,9 +672,11 @@ testRun(void)
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(repoFile1));
         varLstAdd(paramList, varNewStr(repoFileReferenceFull));
+        varLstAdd(paramList, varNewStrZ("none"));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
+        varLstAdd(paramList, NULL);
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewUInt64(9));
         varLstAdd(paramList, varNewUInt64(1557432100));
@@ -356,6 +687,8 @@ testRun(void)
         varLstAdd(paramList, varNewBool(true));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewBool(false));
 
         TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_FILE_STR, paramList, server), true, "protocol restore file");
         TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":false}\n", "    check result");
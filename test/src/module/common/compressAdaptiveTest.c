@@ -0,0 +1,202 @@
+/***********************************************************************************************************************************
+Test Adaptive Compression
+***********************************************************************************************************************************/
+#include "common/compress/gzip/compress.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/io/filter/group.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/io.h"
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Compress data and return the filter result. The time spent compressing is stored in testCompressTime.
+***********************************************************************************************************************************/
+static TimeUSec testCompressTime;
+
+static Buffer *
+testCompress(IoFilter *compress, Buffer *decompressed, size_t inputSize, size_t outputSize, bool *bypass)
+{
+    Buffer *compressed = bufNew(1024 * 1024);
+    size_t inputTotal = 0;
+    ioBufferSizeSet(outputSize);
+
+    IoWrite *write = ioBufferWriteNew(compressed);
+    ioFilterGroupAdd(ioWriteFilterGroup(write), compress);
+    ioWriteOpen(write);
+
+    // Compress input data
+    while (inputTotal < bufSize(decompressed))
+    {
+        // Generate the input buffer based on input size.  This breaks the data up into chunks as it would be in a real scenario.
+        Buffer *input = bufNewC(
+            bufPtr(decompressed) + inputTotal,
+            inputSize > bufSize(decompressed) - inputTotal ? bufSize(decompressed) - inputTotal : inputSize);
+
+        ioWrite(write, input);
+
+        inputTotal += bufUsed(input);
+        bufFree(input);
+    }
+
+    ioWriteClose(write);
+
+    if (bypass != NULL)
+    {
+        const KeyValue *result = varKv(ioFilterGroupResult(ioWriteFilterGroup(write), ioFilterType(compress)));
+        *bypass = varBool(kvGet(result, COMPRESS_ADAPTIVE_RESULT_BYPASS_VAR));
+        testCompressTime = varUInt64(kvGet(result, COMPRESS_ADAPTIVE_RESULT_TIME_VAR));
+    }
+
+    memContextFree(*(MemContext **)ioFilterDriver(compress));
+
+    return compressed;
+}
+
+/***********************************************************************************************************************************
+Decompress data
+***********************************************************************************************************************************/
+static Buffer *
+testDecompress(IoFilter *decompress, Buffer *compressed)
+{
+    Buffer *decompressed = bufNew(1024 * 1024);
+    Buffer *output = bufNew(1024 * 1024);
+    ioBufferSizeSet(65536);
+
+    IoRead *read = ioBufferReadNew(compressed);
+    ioFilterGroupAdd(ioReadFilterGroup(read), decompress);
+    ioReadOpen(read);
+
+    while (!ioReadEof(read))
+    {
+        ioRead(read, output);
+        bufCat(decompressed, output);
+        bufUsedZero(output);
+    }
+
+    ioReadClose(read);
+    bufFree(output);
+
+    return decompressed;
+}
+
+/***********************************************************************************************************************************
+Generate data that cannot be compressed
+***********************************************************************************************************************************/
+static Buffer *
+testIncompressible(size_t size)
+{
+    Buffer *result = bufNew(size);
+    uint32_t seed = 1;
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        seed = seed * 1103515245 + 12345;
+        bufPtr(result)[idx] = (unsigned char)(seed >> 16);
+    }
+
+    bufUsedSet(result, size);
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("CompressAdaptive"))
+    {
+        Buffer *compressed = NULL;
+        Buffer *decompressed = NULL;
+        bool bypass = true;
+
+        // Compressible data
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(COMPRESS_ADAPTIVE_SAMPLE_SIZE * 4 + 77);
+
+        for (size_t idx = 0; idx < bufSize(decompressed); idx++)
+            bufPtr(decompressed)[idx] = (unsigned char)('A' + idx % 13);
+
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewStrZ(COMPRESS_TYPE_GZIP));
+        varLstAdd(paramList, varNewInt(6));
+        varLstAdd(paramList, varNewUInt(1));
+        varLstAdd(paramList, NULL);
+
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNewVar(paramList), decompressed, 65536, 65536, &bypass),
+            "compressible - compress");
+        TEST_RESULT_BOOL(bypass, false, "    compression not bypassed");
+        TEST_RESULT_BOOL(testCompressTime > 0, true, "    compression time measured");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(gzipCompressNew(6, false), decompressed, 65536, 65536, NULL)), true,
+            "    same as compress at requested level");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(compressAdaptiveNew(compressTypeGzip, 6, 1, NULL), decompressed, 1024, 1, NULL)), true,
+            "    same with small in/small out buffer");
+        TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed)), true, "    decompress");
+
+        // Incompressible data
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = testIncompressible(COMPRESS_ADAPTIVE_SAMPLE_SIZE * 2 + 33);
+
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNew(compressTypeGzip, 6, 1, NULL), decompressed, 65536, 65536, &bypass),
+            "incompressible - compress");
+        TEST_RESULT_BOOL(bypass, true, "    compression bypassed");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(gzipCompressNew(0, false), decompressed, 65536, 65536, NULL)), true,
+            "    same as compress at level 0");
+        TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed)), true, "    decompress");
+
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNew(compressTypeGzip, 6, 1, NULL), decompressed, 7777, 1, &bypass),
+            "incompressible - compress odd in/small out buffer");
+        TEST_RESULT_BOOL(bypass, true, "    compression bypassed");
+        TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed)), true, "    decompress");
+
+#ifdef HAVE_LIBLZ4
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNew(compressTypeLz4, 9, 1, NULL), decompressed, 65536, 65536, &bypass),
+            "incompressible - lz4 compress");
+        TEST_RESULT_BOOL(bypass, true, "    compression bypassed");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(decompressFilter(compressTypeLz4, NULL), compressed)), true, "    decompress");
+#endif // HAVE_LIBLZ4
+
+        // Incompressible data smaller than the sample is always compressed
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = testIncompressible(COMPRESS_ADAPTIVE_SAMPLE_SIZE - 1);
+
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNew(compressTypeGzip, 6, 1, NULL), decompressed, 65536, 65536, &bypass),
+            "small incompressible - compress");
+        TEST_RESULT_BOOL(bypass, false, "    compression not bypassed");
+        TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed)), true, "    decompress");
+
+        // Empty data
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(0);
+
+        TEST_ASSIGN(
+            compressed, testCompress(compressAdaptiveNew(compressTypeGzip, 6, 1, NULL), decompressed, 65536, 65536, &bypass),
+            "empty - compress");
+        TEST_RESULT_BOOL(bypass, false, "    compression not bypassed");
+        TEST_RESULT_BOOL(bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed)), true, "    decompress");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        CompressAdaptive *driver = ioFilterDriver(compressAdaptiveNew(compressTypeGzip, 3, 2, NULL));
+
+        TEST_RESULT_STR_Z(
+            compressAdaptiveToLog(driver), "{type: gz, level: 3, thread: 2, bypass: false, inputSame: false}", "format object");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
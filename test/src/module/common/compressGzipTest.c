@@ -172,5 +172,86 @@ testRun(void)
         TEST_RESULT_STR(strPtr(gzipDecompressToLog(decompress)), "{inputSame: true, done: true, availIn: 0}", "format object");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("GzipCompressParallel"))
+    {
+        // Generate data that spans multiple blocks and is somewhat compressible
+        Buffer *decompressed = bufNew(GZIP_COMPRESS_PARALLEL_BLOCK_SIZE * 8 - 1);
+
+        for (size_t dataIdx = 0; dataIdx < bufSize(decompressed); dataIdx++)
+            bufPtr(decompressed)[dataIdx] = (unsigned char)(dataIdx % 251 ^ dataIdx / 4096);
+
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        Buffer *compressed = NULL;
+
+        VariantList *compressParamList = varLstNew();
+        varLstAdd(compressParamList, varNewInt(3));
+        varLstAdd(compressParamList, varNewUInt(4));
+
+        TEST_ASSIGN(
+            compressed, testCompress(gzipCompressParallelNewVar(compressParamList), decompressed, 65536, 65536),
+            "multi-block data - compress with four threads");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed, 65536, 65536)), true,
+            "multi-block data - decompress");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(gzipCompressParallelNew(3, 4), decompressed, 1024, 7)), true,
+            "multi-block data - compress large in/small out buffer gives same result");
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(gzipCompressParallelNew(3, 1), decompressed, 3, 65536)), true,
+            "multi-block data - compress small in/large out buffer with one thread gives same result");
+
+        // Compress when the input is an exact multiple of the block size so the last block is empty
+        // -------------------------------------------------------------------------------------------------------------------------
+        bufUsedSet(decompressed, GZIP_COMPRESS_PARALLEL_BLOCK_SIZE * 2);
+        decompressed = bufDup(decompressed);
+
+        TEST_ASSIGN(
+            compressed, testCompress(gzipCompressParallelNew(0, 2), decompressed, 65536, 65536),
+            "block multiple data - compress at level 0");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed, 65536, 65536)), true,
+            "block multiple data - decompress");
+
+        // Compress empty data
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(0);
+
+        TEST_ASSIGN(compressed, testCompress(gzipCompressParallelNew(6, 2), decompressed, 1024, 1), "empty data - compress");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(gzipDecompressNew(false), compressed, 1024, 1024)), true, "empty data - decompress");
+
+        // Errors are returned from the worker and thrown when the block is written
+        // -------------------------------------------------------------------------------------------------------------------------
+        unsigned char output[1];
+        GzipJob job = {.input = (unsigned char *)"X", .inputSize = 1, .output = output, .last = true};
+
+        TEST_RESULT_VOID(gzipCompressParallelBlock(&job, 99, 0), "invalid level");
+        TEST_RESULT_INT(job.error, Z_STREAM_ERROR, "    check error");
+
+        job.dict = (unsigned char *)"X";
+        job.dictSize = 1;
+
+        TEST_RESULT_VOID(gzipCompressParallelBlock(&job, 3, sizeof(output)), "output too small");
+        TEST_RESULT_INT(job.error, Z_BUF_ERROR, "    check error");
+
+        GzipCompressParallel *driver = (GzipCompressParallel *)ioFilterDriver(gzipCompressParallelNew(3, 1));
+        driver->pendingSize = 0;
+        driver->jobList[0].state = gzipJobStateDone;
+        driver->jobList[0].error = Z_STREAM_ERROR;
+        driver->jobSubmitted = 1;
+
+        TEST_ERROR(
+            gzipCompressParallelWrite(driver, bufNew(1), 0), FormatError, "zlib threw error: [-2] stream error");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        driver = (GzipCompressParallel *)ioFilterDriver(gzipCompressParallelNew(7, 2));
+
+        TEST_RESULT_STR(
+            strPtr(gzipCompressParallelToLog(driver)),
+            "{level: 7, thread: 2, inputSame: false, inputOffset: 0, flushing: false, done: false}", "format object");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -0,0 +1,93 @@
+/***********************************************************************************************************************************
+Test Compression Level Auto-Tuning
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("compressLevelAutoGet() and compressLevelAutoUpdate()"))
+    {
+        const uint64_t size = COMPRESS_LEVEL_AUTO_SIZE_MIN * 4;
+
+        // Starting levels are kept in range
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeGzip, 0), COMPRESS_LEVEL_AUTO_MIN, "gz level 0 raised to minimum");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeGzip, 6), COMPRESS_LEVEL_AUTO_MIN, "gz level already set");
+        TEST_RESULT_INT(
+            compressLevelAutoGet(compressTypeLz4, 13), compressLevelMax(compressTypeLz4), "lz4 level 13 lowered to maximum");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 3, "zst level in range");
+
+        // Small files are not timed
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, COMPRESS_LEVEL_AUTO_SIZE_MIN - 1, 1000, 0), "small file");
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, COMPRESS_LEVEL_AUTO_SIZE_MIN - 1, 1000, 0), "small file");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 3, "    level not changed");
+
+        // Balanced compression and I/O does not change the level
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, size, 1000, 1000), "balanced");
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, size, 1100, 900), "balanced");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 3, "    level not changed");
+
+        // Slow I/O raises the level once enough files have been timed
+        // -------------------------------------------------------------------------------------------------------------------------
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, size, 1000, 9000), "slow io");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 4, "    level raised");
+        harnessLogResult("P00 DETAIL: change zst compression level from 3 to 4 (compress 254us/MiB, io 744us/MiB)");
+
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeZst, size, 1000, 9000), "slow io at new level");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 4, "    level not changed until enough files timed");
+
+        // Slow compression lowers the level
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeGzip, size, 8000, 2000), "slow compress");
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeGzip, size, 8000, 2000), "slow compress");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeGzip, 6), COMPRESS_LEVEL_AUTO_MIN, "    level not lowered below minimum");
+
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeLz4, size, 8000, 2000), "slow compress");
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeLz4, size, 8000, 0), "slow compress, no io time");
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeLz4, 9), compressLevelMax(compressTypeLz4) - 1, "    level lowered");
+        harnessLogResult("P00 DETAIL: change lz4 compression level from 12 to 11 (compress 2000us/MiB, io 375us/MiB)");
+
+        // Slow I/O does not raise the level above maximum
+        // -------------------------------------------------------------------------------------------------------------------------
+        compressLevelAutoLocal[compressTypeLz4].level = compressLevelMax(compressTypeLz4);
+
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeLz4, size, 1000, 9000), "slow io");
+        TEST_RESULT_VOID(compressLevelAutoUpdate(compressTypeLz4, size, 1000, 9000), "slow io");
+        TEST_RESULT_INT(
+            compressLevelAutoGet(compressTypeLz4, 9), compressLevelMax(compressTypeLz4), "    level not raised above maximum");
+
+        // Slow I/O does not raise the level more than the allowed steps above the starting level
+        // -------------------------------------------------------------------------------------------------------------------------
+        compressLevelAutoLocal[compressTypeZst] = (CompressLevelAuto){0};
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 3), 3, "zst starting level");
+
+        for (unsigned int updateIdx = 0; updateIdx < 20; updateIdx++)
+            compressLevelAutoUpdate(compressTypeZst, size, 1000, 9000);
+
+        TEST_RESULT_INT(
+            compressLevelAutoGet(compressTypeZst, 3), 3 + COMPRESS_LEVEL_AUTO_RAISE_MAX, "    level not raised above cap");
+        harnessLogResult(
+            "P00 DETAIL: change zst compression level from 3 to 4 (compress 250us/MiB, io 2250us/MiB)\n"
+            "P00 DETAIL: change zst compression level from 4 to 5 (compress 250us/MiB, io 2250us/MiB)\n"
+            "P00 DETAIL: change zst compression level from 5 to 6 (compress 250us/MiB, io 2250us/MiB)");
+
+        harnessLogLevelReset();
+
+        // Levels above 9 are kept for types that support them
+        // -------------------------------------------------------------------------------------------------------------------------
+        compressLevelAutoLocal[compressTypeZst] = (CompressLevelAuto){0};
+        TEST_RESULT_INT(compressLevelAutoGet(compressTypeZst, 15), 15, "zst level 15 in range");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
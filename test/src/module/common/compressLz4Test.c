@@ -0,0 +1,298 @@
+/***********************************************************************************************************************************
+Test LZ4
+***********************************************************************************************************************************/
+#include "common/io/filter/group.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/io.h"
+
+#ifdef HAVE_LIBLZ4
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static Buffer *
+testCompress(IoFilter *compress, Buffer *decompressed, size_t inputSize, size_t outputSize)
+{
+    Buffer *compressed = bufNew(1024 * 1024);
+    size_t inputTotal = 0;
+    ioBufferSizeSet(outputSize);
+
+    IoWrite *write = ioBufferWriteNew(compressed);
+    ioFilterGroupAdd(ioWriteFilterGroup(write), compress);
+    ioWriteOpen(write);
+
+    // Compress input data
+    while (inputTotal < bufSize(decompressed))
+    {
+        // Generate the input buffer based on input size.  This breaks the data up into chunks as it would be in a real scenario.
+        Buffer *input = bufNewC(
+            bufPtr(decompressed) + inputTotal,
+            inputSize > bufSize(decompressed) - inputTotal ? bufSize(decompressed) - inputTotal : inputSize);
+
+        ioWrite(write, input);
+
+        inputTotal += bufUsed(input);
+        bufFree(input);
+    }
+
+    ioWriteClose(write);
+    memContextFree(((Lz4Compress *)ioFilterDriver(compress))->memContext);
+
+    return compressed;
+}
+
+/***********************************************************************************************************************************
+Decompress data
+***********************************************************************************************************************************/
+static Buffer *
+testDecompress(IoFilter *decompress, Buffer *compressed, size_t inputSize, size_t outputSize)
+{
+    Buffer *decompressed = bufNew(1024 * 1024);
+    Buffer *output = bufNew(outputSize);
+    ioBufferSizeSet(inputSize);
+
+    IoRead *read = ioBufferReadNew(compressed);
+    ioFilterGroupAdd(ioReadFilterGroup(read), decompress);
+    ioReadOpen(read);
+
+    while (!ioReadEof(read))
+    {
+        ioRead(read, output);
+        bufCat(decompressed, output);
+        bufUsedZero(output);
+    }
+
+    ioReadClose(read);
+    bufFree(output);
+    memContextFree(((Lz4Decompress *)ioFilterDriver(decompress))->memContext);
+
+    return decompressed;
+}
+
+#endif // HAVE_LIBLZ4
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("lz4Error()"))
+    {
+#ifdef HAVE_LIBLZ4
+        TEST_RESULT_UINT(lz4Error(0), 0, "check success");
+        TEST_ERROR(lz4Error((size_t)-2), FormatError, "lz4 error: [-2] ERROR_maxBlockSize_invalid");
+#endif // HAVE_LIBLZ4
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("Lz4Compress and Lz4Decompress"))
+    {
+#ifdef HAVE_LIBLZ4
+        const char *simpleData = "A simple string";
+        Buffer *compressed = NULL;
+        Buffer *decompressed = bufNewC(simpleData, strlen(simpleData));
+
+        VariantList *compressParamList = varLstNew();
+        varLstAdd(compressParamList, varNewInt(1));
+
+        TEST_ASSIGN(
+            compressed, testCompress(lz4CompressNewVar(compressParamList), decompressed, 1024, 1024),
+            "simple data - compress large in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(lz4CompressNew(1), decompressed, 1024, 1)), true,
+            "simple data - compress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(lz4CompressNew(1), decompressed, 1, 1024)), true,
+            "simple data - compress small in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(lz4CompressNew(1), decompressed, 1, 1)), true,
+            "simple data - compress small in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, 1024, 1024)), true,
+            "simple data - decompress large in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, 1024, 1)), true,
+            "simple data - decompress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, 1, 1024)), true,
+            "simple data - decompress small in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, 1, 1)), true,
+            "simple data - decompress small in/small out buffer");
+
+        // Compress and decompress an empty buffer
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(0);
+
+        TEST_ASSIGN(compressed, testCompress(lz4CompressNew(1), decompressed, 1024, 1), "empty data - compress");
+        TEST_RESULT_BOOL(bufUsed(compressed) > 0, true, "    check frame was written");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, 1024, 1024)), true, "empty data - decompress");
+
+        // Compress a large zero input buffer into small output buffer
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(1024 * 1024 - 1);
+        memset(bufPtr(decompressed), 0, bufSize(decompressed));
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        TEST_ASSIGN(
+            compressed, testCompress(lz4CompressNew(9), decompressed, bufSize(decompressed), 1024),
+            "zero data - compress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(lz4DecompressNew(), compressed, bufSize(compressed), 1024 * 256)), true,
+            "zero data - decompress large in/small out buffer");
+
+        // Error on truncated compressed data
+        // -------------------------------------------------------------------------------------------------------------------------
+        bufUsedSet(compressed, bufUsed(compressed) - 1);
+
+        TEST_ERROR(
+            testDecompress(lz4DecompressNew(), compressed, 512, 512), FormatError, "unexpected eof in compressed data");
+
+        // Error on invalid compressed data
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR(
+            testDecompress(lz4DecompressNew(), bufDup(BUFSTRDEF("not lz4 data")), 512, 512), FormatError,
+            "lz4 error: [-13] ERROR_frameType_unknown");
+#endif // HAVE_LIBLZ4
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("lz4DecompressToLog() and lz4CompressToLog()"))
+    {
+#ifdef HAVE_LIBLZ4
+        Lz4Compress *compress = (Lz4Compress *)ioFilterDriver(lz4CompressNew(7));
+
+        TEST_RESULT_STR(
+            strPtr(lz4CompressToLog(compress)), "{level: 7, first: true, inputSame: false, flushing: false, done: false}",
+            "format object");
+
+        Lz4Decompress *decompress = (Lz4Decompress *)ioFilterDriver(lz4DecompressNew());
+
+        TEST_RESULT_STR(
+            strPtr(lz4DecompressToLog(decompress)), "{inputSame: false, inputOffset: 0, done: false}", "format object");
+
+        decompress->inputSame = true;
+        decompress->inputOffset = 999;
+        decompress->done = true;
+
+        TEST_RESULT_STR(
+            strPtr(lz4DecompressToLog(decompress)), "{inputSame: true, inputOffset: 999, done: true}", "format object");
+#endif // HAVE_LIBLZ4
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("compressType*()"))
+    {
+        TEST_RESULT_UINT(compressTypeEnum(strNew(COMPRESS_TYPE_NONE)), compressTypeNone, "none enum");
+        TEST_RESULT_UINT(compressTypeEnum(strNew(COMPRESS_TYPE_GZIP)), compressTypeGzip, "gz enum");
+        TEST_RESULT_UINT(compressTypeEnum(strNew(COMPRESS_TYPE_LZ4)), compressTypeLz4, "lz4 enum");
+        TEST_RESULT_UINT(compressTypeEnum(strNew(COMPRESS_TYPE_ZST)), compressTypeZst, "zst enum");
+        TEST_ERROR(compressTypeEnum(strNew("bogus")), AssertError, "invalid compression type 'bogus'");
+
+        TEST_RESULT_STR(strPtr(compressTypeStr(compressTypeNone)), COMPRESS_TYPE_NONE, "none str");
+        TEST_RESULT_STR(strPtr(compressTypeStr(compressTypeGzip)), COMPRESS_TYPE_GZIP, "gz str");
+        TEST_RESULT_STR(strPtr(compressTypeStr(compressTypeLz4)), COMPRESS_TYPE_LZ4, "lz4 str");
+        TEST_RESULT_STR(strPtr(compressTypeStr(compressTypeZst)), COMPRESS_TYPE_ZST, "zst str");
+        TEST_ERROR(compressTypeStr((CompressType)999), AssertError, "invalid compression type 999");
+
+        TEST_RESULT_VOID(compressTypePresent(compressTypeGzip), "gz is present");
+
+#ifdef HAVE_LIBLZ4
+        TEST_RESULT_VOID(compressTypePresent(compressTypeLz4), "lz4 is present");
+#else
+        TEST_ERROR(compressTypePresent(compressTypeLz4), OptionInvalidValueError, PROJECT_NAME " not compiled with lz4 support");
+#endif
+
+#ifdef HAVE_LIBZSTD
+        TEST_RESULT_VOID(compressTypePresent(compressTypeZst), "zst is present");
+#else
+        TEST_ERROR(compressTypePresent(compressTypeZst), OptionInvalidValueError, PROJECT_NAME " not compiled with zst support");
+#endif
+
+        TEST_RESULT_UINT(compressTypeFromName(strNew("file")), compressTypeNone, "none from name");
+        TEST_RESULT_UINT(compressTypeFromName(strNew("file.gz")), compressTypeGzip, "gz from name");
+        TEST_RESULT_UINT(compressTypeFromName(strNew("file.lz4")), compressTypeLz4, "lz4 from name");
+        TEST_RESULT_UINT(compressTypeFromName(strNew("file.zst")), compressTypeZst, "zst from name");
+
+        TEST_RESULT_INT(compressLevelDefault(compressTypeNone), 0, "none default level");
+        TEST_RESULT_INT(compressLevelDefault(compressTypeGzip), 6, "gz default level");
+        TEST_RESULT_INT(compressLevelDefault(compressTypeLz4), 1, "lz4 default level");
+        TEST_RESULT_INT(compressLevelDefault(compressTypeZst), 3, "zst default level");
+
+        TEST_RESULT_INT(compressLevelMin(compressTypeNone), 0, "none min level");
+        TEST_RESULT_INT(compressLevelMin(compressTypeGzip), 0, "gz min level");
+        TEST_RESULT_INT(compressLevelMin(compressTypeLz4), 1, "lz4 min level");
+        TEST_RESULT_INT(compressLevelMin(compressTypeZst), 1, "zst min level");
+
+        TEST_RESULT_INT(compressLevelMax(compressTypeNone), 0, "none max level");
+        TEST_RESULT_INT(compressLevelMax(compressTypeGzip), 9, "gz max level");
+        TEST_RESULT_INT(compressLevelMax(compressTypeLz4), 12, "lz4 max level");
+        TEST_RESULT_INT(compressLevelMax(compressTypeZst), 19, "zst max level");
+
+        TEST_RESULT_STR(compressExtZ(compressTypeNone), "", "none ext");
+        TEST_RESULT_STR(compressExtZ(compressTypeGzip), ".gz", "gz ext");
+        TEST_RESULT_STR(compressExtZ(compressTypeLz4), ".lz4", "lz4 ext");
+        TEST_RESULT_STR(compressExtZ(compressTypeZst), ".zst", "zst ext");
+        TEST_ERROR(compressExtZ((CompressType)999), AssertError, "invalid compression type 999");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("compressFilter() and decompressFilter()"))
+    {
+        TEST_RESULT_PTR(compressFilter(compressTypeNone, 0, 1, NULL), NULL, "no compress filter for none");
+        TEST_RESULT_PTR(decompressFilter(compressTypeNone, NULL), NULL, "no decompress filter for none");
+
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(compressFilter(compressTypeGzip, 6, 1, NULL))), GZIP_COMPRESS_FILTER_TYPE, "gz compress filter");
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(compressFilter(compressTypeGzip, 6, 2, NULL))), GZIP_COMPRESS_PARALLEL_FILTER_TYPE,
+            "gz parallel compress filter");
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(decompressFilter(compressTypeGzip, NULL))), GZIP_DECOMPRESS_FILTER_TYPE, "gz decompress filter");
+
+        TEST_ERROR(compressFilter((CompressType)999, 0, 1, NULL), AssertError, "invalid compression type 999");
+        TEST_ERROR(decompressFilter((CompressType)999, NULL), AssertError, "invalid compression type 999");
+
+#ifdef HAVE_LIBLZ4
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(compressFilter(compressTypeLz4, 1, 1, NULL))), LZ4_COMPRESS_FILTER_TYPE, "lz4 compress filter");
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(decompressFilter(compressTypeLz4, NULL))), LZ4_DECOMPRESS_FILTER_TYPE, "lz4 decompress filter");
+
+        // Round trip through the helper filters
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *decompressed = bufDup(BUFSTRDEF("data to round trip through the helper filters"));
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                decompressed,
+                testDecompress(
+                    decompressFilter(compressTypeLz4, NULL),
+                    testCompress(compressFilter(compressTypeLz4, 1, 1, NULL), decompressed, 8, 8), 8, 8)),
+            true, "lz4 round trip");
+#endif
+
+#ifdef HAVE_LIBZSTD
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(compressFilter(compressTypeZst, 3, 2, NULL))), ZST_COMPRESS_FILTER_TYPE, "zst compress filter");
+        TEST_RESULT_STR(
+            strPtr(ioFilterType(decompressFilter(compressTypeZst, NULL))), ZST_DECOMPRESS_FILTER_TYPE, "zst decompress filter");
+#endif
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -0,0 +1,298 @@
+/***********************************************************************************************************************************
+Test Zstandard
+***********************************************************************************************************************************/
+#include "common/io/filter/group.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/io.h"
+#include "postgres/interface.h"
+
+#ifdef HAVE_LIBZSTD
+
+/***********************************************************************************************************************************
+Compress data
+***********************************************************************************************************************************/
+static Buffer *
+testCompress(IoFilter *compress, Buffer *decompressed, size_t inputSize, size_t outputSize)
+{
+    Buffer *compressed = bufNew(1024 * 1024);
+    size_t inputTotal = 0;
+    ioBufferSizeSet(outputSize);
+
+    IoWrite *write = ioBufferWriteNew(compressed);
+    ioFilterGroupAdd(ioWriteFilterGroup(write), compress);
+    ioWriteOpen(write);
+
+    // Compress input data
+    while (inputTotal < bufSize(decompressed))
+    {
+        // Generate the input buffer based on input size.  This breaks the data up into chunks as it would be in a real scenario.
+        Buffer *input = bufNewC(
+            bufPtr(decompressed) + inputTotal,
+            inputSize > bufSize(decompressed) - inputTotal ? bufSize(decompressed) - inputTotal : inputSize);
+
+        ioWrite(write, input);
+
+        inputTotal += bufUsed(input);
+        bufFree(input);
+    }
+
+    ioWriteClose(write);
+    memContextFree(((ZstCompress *)ioFilterDriver(compress))->memContext);
+
+    return compressed;
+}
+
+/***********************************************************************************************************************************
+Decompress data
+***********************************************************************************************************************************/
+static Buffer *
+testDecompress(IoFilter *decompress, Buffer *compressed, size_t inputSize, size_t outputSize)
+{
+    Buffer *decompressed = bufNew(1024 * 1024);
+    Buffer *output = bufNew(outputSize);
+    ioBufferSizeSet(inputSize);
+
+    IoRead *read = ioBufferReadNew(compressed);
+    ioFilterGroupAdd(ioReadFilterGroup(read), decompress);
+    ioReadOpen(read);
+
+    while (!ioReadEof(read))
+    {
+        ioRead(read, output);
+        bufCat(decompressed, output);
+        bufUsedZero(output);
+    }
+
+    ioReadClose(read);
+    bufFree(output);
+    memContextFree(((ZstDecompress *)ioFilterDriver(decompress))->memContext);
+
+    return decompressed;
+}
+
+#endif // HAVE_LIBZSTD
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("zstError()"))
+    {
+#ifdef HAVE_LIBZSTD
+        TEST_RESULT_UINT(zstError(0), 0, "check success");
+        TEST_ERROR(zstError((size_t)-12), FormatError, "zst error: [-12] Version not supported");
+#endif // HAVE_LIBZSTD
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("ZstCompress and ZstDecompress"))
+    {
+#ifdef HAVE_LIBZSTD
+        const char *simpleData = "A simple string";
+        Buffer *compressed = NULL;
+        Buffer *decompressed = bufNewC(simpleData, strlen(simpleData));
+
+        VariantList *compressParamList = varLstNew();
+        varLstAdd(compressParamList, varNewInt(3));
+        varLstAdd(compressParamList, varNewUInt(1));
+        varLstAdd(compressParamList, NULL);
+
+        TEST_ASSIGN(
+            compressed, testCompress(zstCompressNewVar(compressParamList), decompressed, 1024, 1024),
+            "simple data - compress large in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(zstCompressNew(3, 1, NULL), decompressed, 1024, 1)), true,
+            "simple data - compress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(zstCompressNew(3, 1, NULL), decompressed, 1, 1024)), true,
+            "simple data - compress small in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(compressed, testCompress(zstCompressNew(3, 1, NULL), decompressed, 1, 1)), true,
+            "simple data - compress small in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1024, 1024)), true,
+            "simple data - decompress large in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1024, 1)), true,
+            "simple data - decompress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1, 1024)), true,
+            "simple data - decompress small in/large out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1, 1)), true,
+            "simple data - decompress small in/small out buffer");
+
+        // Compress and decompress an empty buffer
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(0);
+
+        TEST_ASSIGN(compressed, testCompress(zstCompressNew(3, 1, NULL), decompressed, 1024, 1), "empty data - compress");
+        TEST_RESULT_BOOL(bufUsed(compressed) > 0, true, "    check frame was written");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1024, 1024)), true, "empty data - decompress");
+
+        // Compress a large zero input buffer into small output buffer
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(1024 * 1024 - 1);
+        memset(bufPtr(decompressed), 0, bufSize(decompressed));
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        TEST_ASSIGN(
+            compressed, testCompress(zstCompressNew(9, 1, NULL), decompressed, bufSize(decompressed), 1024),
+            "zero data - compress large in/small out buffer");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, bufSize(compressed), 1024 * 256)), true,
+            "zero data - decompress large in/small out buffer");
+
+        // Compress with multiple threads
+        // -------------------------------------------------------------------------------------------------------------------------
+        decompressed = bufNew(1024 * 1024 - 1);
+
+        for (size_t dataIdx = 0; dataIdx < bufSize(decompressed); dataIdx++)
+            bufPtr(decompressed)[dataIdx] = (unsigned char)(dataIdx % 251 ^ dataIdx / 4096);
+
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        TEST_ASSIGN(
+            compressed, testCompress(zstCompressNew(3, 4, NULL), decompressed, 65536, 1024),
+            "threaded data - compress with four threads");
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNew(NULL), compressed, 1024, 65536)), true,
+            "threaded data - decompress");
+
+        // Error on truncated compressed data
+        // -------------------------------------------------------------------------------------------------------------------------
+        bufUsedSet(compressed, bufUsed(compressed) - 1);
+
+        TEST_ERROR(
+            testDecompress(zstDecompressNew(NULL), compressed, 512, 512), FormatError, "unexpected eof in compressed data");
+
+        // Error on invalid compressed data
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR(
+            testDecompress(zstDecompressNew(NULL), bufDup(BUFSTRDEF("not zst data")), 512, 512), FormatError,
+            "zst error: [-10] Unknown frame descriptor");
+#endif // HAVE_LIBZSTD
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("zstDictTrain(), zstDictToVar(), and zstDictFromVar()"))
+    {
+        TEST_RESULT_PTR(zstDictToVar(NULL), NULL, "null dict to variant");
+        TEST_RESULT_PTR(zstDictFromVar(NULL), NULL, "null variant to dict");
+
+        Buffer *dict = bufDup(BUFSTRDEF("dictionary"));
+
+        TEST_RESULT_BOOL(bufEq(zstDictFromVar(zstDictToVar(dict)), dict), true, "dict variant round trip");
+
+#ifdef HAVE_LIBZSTD
+        // Build pages from a shared vocabulary so there is little repetition within a page but a lot across pages, similar to a
+        // relation
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *sample = bufNew(PG_PAGE_SIZE_DEFAULT * 128);
+        uint32_t random = 1;
+
+        while (bufUsed(sample) < bufSize(sample))
+        {
+            random = random * 1103515245 + 12345;
+
+            // Each word is deterministic for its index in the vocabulary
+            unsigned char word[8];
+            uint32_t wordRandom = (random >> 16) % 2048 + 1;
+
+            for (unsigned int charIdx = 0; charIdx < sizeof(word); charIdx++)
+            {
+                wordRandom = wordRandom * 1103515245 + 12345;
+                word[charIdx] = (unsigned char)('a' + (wordRandom >> 16) % 26);
+            }
+
+            bufCatC(sample, word, 0, sizeof(word));
+        }
+
+        TEST_RESULT_PTR(
+            zstDictTrain(BUFSTRDEF("too small"), PG_PAGE_SIZE_DEFAULT, ZST_DICT_SIZE_DEFAULT), NULL, "too few chunks to train");
+
+        harnessLogLevelSet(logLevelDebug);
+        TEST_RESULT_PTR(zstDictTrain(sample, PG_PAGE_SIZE_DEFAULT, 64), NULL, "dictionary size too small");
+        harnessLogResultRegExp("P00  DEBUG\\: .*unable to train zst dictionary\\: .*");
+        harnessLogLevelReset();
+
+        TEST_ASSIGN(dict, zstDictTrain(sample, PG_PAGE_SIZE_DEFAULT, ZST_DICT_SIZE_DEFAULT), "train dictionary");
+        TEST_RESULT_BOOL(bufUsed(dict) > 0 && bufUsed(dict) <= ZST_DICT_SIZE_DEFAULT, true, "    check dictionary size");
+
+        // Compress and decompress with the dictionary
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *decompressed = bufNewC(bufPtr(sample), PG_PAGE_SIZE_DEFAULT);
+        Buffer *compressed = NULL;
+
+        VariantList *compressParamList = varLstNew();
+        varLstAdd(compressParamList, varNewInt(3));
+        varLstAdd(compressParamList, varNewUInt(1));
+        varLstAdd(compressParamList, zstDictToVar(dict));
+
+        TEST_ASSIGN(
+            compressed, testCompress(zstCompressNewVar(compressParamList), decompressed, 1024, 1024), "compress with dictionary");
+        TEST_RESULT_BOOL(
+            bufUsed(compressed) < bufUsed(testCompress(zstCompressNew(3, 1, NULL), decompressed, 1024, 1024)), true,
+            "    check dictionary improves compression");
+
+        VariantList *decompressParamList = varLstNew();
+        varLstAdd(decompressParamList, zstDictToVar(dict));
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(zstDecompressNewVar(decompressParamList), compressed, 1024, 1024)), true,
+            "decompress with dictionary");
+        TEST_RESULT_BOOL(
+            bufEq(
+                decompressed,
+                testDecompress(
+                    zstDecompressNewVar(NULL), testCompress(zstCompressNew(3, 1, NULL), decompressed, 1024, 1024), 1024, 1024)),
+            true, "decompress without dictionary");
+
+        TEST_ERROR(
+            testDecompress(zstDecompressNew(NULL), compressed, 1024, 1024), FormatError,
+            "zst error: [-32] Dictionary mismatch");
+#endif // HAVE_LIBZSTD
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("zstDecompressToLog() and zstCompressToLog()"))
+    {
+#ifdef HAVE_LIBZSTD
+        ZstCompress *compress = (ZstCompress *)ioFilterDriver(zstCompressNew(7, 2, NULL));
+
+        TEST_RESULT_STR(
+            strPtr(zstCompressToLog(compress)),
+            "{level: 7, thread: 2, dict: false, inputSame: false, inputOffset: 0, flushing: false, done: false}", "format object");
+
+        ZstDecompress *decompress = (ZstDecompress *)ioFilterDriver(zstDecompressNew(NULL));
+
+        TEST_RESULT_STR(
+            strPtr(zstDecompressToLog(decompress)), "{inputSame: false, inputOffset: 0, done: false}", "format object");
+
+        decompress->inputSame = true;
+        decompress->inputOffset = 999;
+        decompress->done = true;
+
+        TEST_RESULT_STR(
+            strPtr(zstDecompressToLog(decompress)), "{inputSame: true, inputOffset: 999, done: true}", "format object");
+#endif // HAVE_LIBZSTD
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -49,10 +49,12 @@ testRun(void)
         TEST_ERROR(cipherType(strNew(BOGUS_STR)), AssertError, "invalid cipher name 'BOGUS'");
         TEST_RESULT_UINT(cipherType(strNew("none")), cipherTypeNone, "none type");
         TEST_RESULT_UINT(cipherType(strNew("aes-256-cbc")), cipherTypeAes256Cbc, "aes-256-cbc type");
+        TEST_RESULT_UINT(cipherType(strNew("aes-256-gcm")), cipherTypeAes256Gcm, "aes-256-gcm type");
 
-        TEST_ERROR(cipherTypeName((CipherType)2), AssertError, "invalid cipher type 2");
+        TEST_ERROR(cipherTypeName((CipherType)3), AssertError, "invalid cipher type 3");
         TEST_RESULT_STR(strPtr(cipherTypeName(cipherTypeNone)), "none", "none name");
         TEST_RESULT_STR(strPtr(cipherTypeName(cipherTypeAes256Cbc)), "aes-256-cbc", "aes-256-cbc name");
+        TEST_RESULT_STR(strPtr(cipherTypeName(cipherTypeAes256Gcm)), "aes-256-gcm", "aes-256-gcm name");
 
         // Test if the buffer was overrun
         // -------------------------------------------------------------------------------------------------------------------------
@@ -286,6 +288,172 @@ testRun(void)
 
         ioFilterFree(blockDecryptFilter);
 
+        // Encrypt chunked
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *chunkPlainText = bufNew(CIPHER_BLOCK_CHUNK_SIZE * 2 + 100);
+
+        for (size_t byteIdx = 0; byteIdx < bufSize(chunkPlainText); byteIdx++)
+            bufPtr(chunkPlainText)[byteIdx] = (unsigned char)(byteIdx % 251);
+
+        bufUsedSet(chunkPlainText, bufSize(chunkPlainText));
+
+        Buffer *chunkEncryptBuffer = bufNew(bufUsed(chunkPlainText) * 2);
+
+        blockEncryptFilter = cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, testPass, NULL);
+        blockEncryptFilter = cipherBlockNewVar(ioFilterParamList(blockEncryptFilter));
+        blockEncrypt = (CipherBlock *)ioFilterDriver(blockEncryptFilter);
+
+        TEST_RESULT_BOOL(blockEncrypt->chunked, true, "cipher is chunked");
+        TEST_RESULT_INT(
+            cipherBlockProcessSize(blockEncrypt, CIPHER_BLOCK_CHUNK_SIZE),
+            CIPHER_BLOCK_CHUNK_SIZE * 2 + CIPHER_BLOCK_CHUNK_TAG_SIZE * 2 + CIPHER_BLOCK_HEADER_SIZE, "check process size");
+
+        ioFilterProcessInOut(blockEncryptFilter, chunkPlainText, chunkEncryptBuffer);
+        TEST_RESULT_INT(
+            bufUsed(chunkEncryptBuffer), CIPHER_BLOCK_HEADER_SIZE + (CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE) * 2,
+            "two chunks encrypted");
+        TEST_RESULT_BOOL(
+            memcmp(bufPtr(chunkEncryptBuffer), CIPHER_BLOCK_CHUNK_MAGIC, CIPHER_BLOCK_MAGIC_SIZE) == 0, true, "check header magic");
+
+        ioFilterProcessInOut(blockEncryptFilter, NULL, chunkEncryptBuffer);
+        TEST_RESULT_INT(
+            bufUsed(chunkEncryptBuffer),
+            CIPHER_BLOCK_HEADER_SIZE + bufUsed(chunkPlainText) + CIPHER_BLOCK_CHUNK_TAG_SIZE * 3, "last chunk encrypted on flush");
+        TEST_RESULT_BOOL(ioFilterDone(blockEncryptFilter), true,  "filter is done");
+
+        ioFilterFree(blockEncryptFilter);
+
+        // Decrypt chunked with the cipher detected from the header
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *chunkDecryptBuffer = bufNew(bufUsed(chunkPlainText) * 2);
+
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, testPass, NULL);
+        blockDecrypt = (CipherBlock *)ioFilterDriver(blockDecryptFilter);
+
+        ioFilterProcessInOut(blockDecryptFilter, chunkEncryptBuffer, chunkDecryptBuffer);
+        TEST_RESULT_BOOL(blockDecrypt->chunked, true, "cipher is chunked");
+        TEST_RESULT_INT(bufUsed(chunkDecryptBuffer), CIPHER_BLOCK_CHUNK_SIZE * 2, "two chunks decrypted");
+
+        ioFilterProcessInOut(blockDecryptFilter, NULL, chunkDecryptBuffer);
+        TEST_RESULT_BOOL(bufEq(chunkDecryptBuffer, chunkPlainText), true, "check decrypt buffer");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // Unchunked file cannot be decrypted when the cipher type is chunked
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *unchunkedEncryptBuffer = bufNew(TEST_BUFFER_SIZE);
+
+        blockEncryptFilter = cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, testPass, NULL);
+        ioFilterProcessInOut(blockEncryptFilter, testPlainText, unchunkedEncryptBuffer);
+        ioFilterProcessInOut(blockEncryptFilter, NULL, unchunkedEncryptBuffer);
+        ioFilterFree(blockEncryptFilter);
+
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        TEST_ERROR(
+            ioFilterProcessInOut(blockDecryptFilter, unchunkedEncryptBuffer, chunkDecryptBuffer), CryptoError,
+            "cipher header is for 'aes-256-cbc' but cipher type is 'aes-256-gcm'");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // Decrypt a chunk independently
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+        blockDecrypt = (CipherBlock *)ioFilterDriver(blockDecryptFilter);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        ioFilterProcessInOut(blockDecryptFilter, bufNewC(bufPtr(chunkEncryptBuffer), CIPHER_BLOCK_HEADER_SIZE), chunkDecryptBuffer);
+        blockDecrypt->chunkIdx = 1;
+
+        TEST_RESULT_INT(
+            cipherBlockChunk(
+                blockDecrypt, bufPtr(chunkEncryptBuffer) + CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_SIZE +
+                    CIPHER_BLOCK_CHUNK_TAG_SIZE,
+                CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE, false, bufPtr(chunkDecryptBuffer)),
+            CIPHER_BLOCK_CHUNK_SIZE, "decrypt second chunk");
+        TEST_RESULT_BOOL(
+            memcmp(bufPtr(chunkDecryptBuffer), bufPtr(chunkPlainText) + CIPHER_BLOCK_CHUNK_SIZE, CIPHER_BLOCK_CHUNK_SIZE) == 0,
+            true, "check second chunk");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // Modified chunk fails authentication
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+        bufPtr(chunkEncryptBuffer)[CIPHER_BLOCK_HEADER_SIZE + 1] ^= 0xFF;
+
+        TEST_ERROR(
+            ioFilterProcessInOut(blockDecryptFilter, chunkEncryptBuffer, chunkDecryptBuffer), CryptoError,
+            "cipher chunk authentication failed");
+
+        bufPtr(chunkEncryptBuffer)[CIPHER_BLOCK_HEADER_SIZE + 1] ^= 0xFF;
+        ioFilterFree(blockDecryptFilter);
+
+        // Invalid passphrase fails authentication
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, BUFSTRDEF(BOGUS_STR), NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        TEST_ERROR(
+            ioFilterProcessInOut(blockDecryptFilter, chunkEncryptBuffer, chunkDecryptBuffer), CryptoError,
+            "cipher chunk authentication failed");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // File truncated on a chunk boundary fails authentication
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        ioFilterProcessInOut(
+            blockDecryptFilter,
+            bufNewC(bufPtr(chunkEncryptBuffer), CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE),
+            chunkDecryptBuffer);
+        TEST_ERROR(
+            ioFilterProcessInOut(blockDecryptFilter, NULL, chunkDecryptBuffer), CryptoError, "cipher chunk authentication failed");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // File truncated in the tag errors
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        ioFilterProcessInOut(
+            blockDecryptFilter, bufNewC(bufPtr(chunkEncryptBuffer), CIPHER_BLOCK_HEADER_SIZE + 1), chunkDecryptBuffer);
+        TEST_ERROR(ioFilterProcessInOut(blockDecryptFilter, NULL, chunkDecryptBuffer), CryptoError, "cipher chunk truncated");
+
+        ioFilterFree(blockDecryptFilter);
+
+        // Encrypt zero byte file chunked and decrypt it
+        // -------------------------------------------------------------------------------------------------------------------------
+        blockEncryptFilter = cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkEncryptBuffer);
+
+        ioFilterProcessInOut(blockEncryptFilter, NULL, chunkEncryptBuffer);
+        TEST_RESULT_INT(bufUsed(chunkEncryptBuffer), CIPHER_BLOCK_HEADER_SIZE + CIPHER_BLOCK_CHUNK_TAG_SIZE, "check size");
+
+        ioFilterFree(blockEncryptFilter);
+
+        blockDecryptFilter = cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Gcm, testPass, NULL);
+
+        bufUsedZero(chunkDecryptBuffer);
+
+        ioFilterProcessInOut(blockDecryptFilter, chunkEncryptBuffer, chunkDecryptBuffer);
+        ioFilterProcessInOut(blockDecryptFilter, NULL, chunkDecryptBuffer);
+        TEST_RESULT_INT(bufUsed(chunkDecryptBuffer), 0, "0 bytes on flush");
+
+        ioFilterFree(blockDecryptFilter);
+
         // Helper function
         // -------------------------------------------------------------------------------------------------------------------------
         IoFilterGroup *filterGroup = ioFilterGroupNew();
@@ -359,5 +527,31 @@ testRun(void)
             "    check hmac");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("XxHash"))
+    {
+#ifdef HAVE_LIBXXHASH
+        IoFilter *hash = NULL;
+
+        TEST_RESULT_BOOL(xxHashPresent(), true, "xxhash is present");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ASSIGN(hash, xxHashNew(), "create xxhash");
+        TEST_RESULT_STR(strPtr(varStr(ioFilterResult(hash))), XXHASH_ZERO, "    check empty hash");
+        TEST_RESULT_VOID(ioFilterFree(hash), "    free hash");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ASSIGN(hash, xxHashNew(), "create xxhash");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("a")), "    add a");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("bc")), "    add bc");
+        TEST_RESULT_STR(strPtr(varStr(ioFilterResult(hash))), "06b05ab6733a618578af5f94892f3950", "    check small hash");
+        TEST_RESULT_UINT(strSize(varStr(ioFilterResult(hash))), XXHASH_SIZE_HEX, "    check hash size");
+        TEST_RESULT_VOID(ioFilterFree(hash), "    free hash");
+#else
+        TEST_RESULT_BOOL(xxHashPresent(), false, "xxhash is not present");
+        TEST_ERROR(xxHashNew(), AssertError, PROJECT_NAME " not compiled with xxhash support");
+#endif
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -2,7 +2,9 @@
 Test Exit Routines
 ***********************************************************************************************************************************/
 #include "common/error.h"
+#include "common/io/stat.h"
 #include "common/log.h"
+#include "common/type/json.h"
 #include "config/config.h"
 
 #include "common/harnessFork.h"
@@ -57,6 +59,29 @@ testRun(void)
         TEST_RESULT_INT(exitSafe(1, false, signalTypeNone), 1, "exit with no error")
         harnessLogResult("P00   INFO: archive-push command end: completed successfully");
 
+        // Log IO statistics on success
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioStatEnabledSet(true);
+        ioStatTotalAdd(jsonToVar(strNew("{\"size\":{\"cpu\":0,\"wall\":1000,\"in\":1024,\"out\":1024}}")));
+
+        TEST_RESULT_INT(exitSafe(0, false, signalTypeNone), 0, "exit and log io stats")
+        harnessLogResult(
+            "P00   INFO: filter stat size: cpu 0.000s, wall 0.001s, in 1KB, out 1KB\n"
+            "P00   INFO: archive-push command end: completed successfully");
+
+        // Local and remote processes do not log IO statistics
+        cfgCommandSet(cfgCmdLocal);
+        TEST_RESULT_INT(exitSafe(0, false, signalTypeNone), 0, "exit local without io stats")
+
+        cfgCommandSet(cfgCmdRemote);
+        TEST_RESULT_INT(exitSafe(0, false, signalTypeNone), 0, "exit remote without io stats")
+        harnessLogResult(
+            "P00   INFO: local command end: completed successfully\n"
+            "P00   INFO: remote command end: completed successfully");
+
+        ioStatEnabledSet(false);
+        cfgCommandSet(cfgCmdArchivePush);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TRY_BEGIN()
         {
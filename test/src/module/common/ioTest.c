@@ -51,11 +51,14 @@ testIoWriteOpen(void *driver)
     testIoWriteOpenCalled = true;
 }
 
+static const Buffer *testIoWriteBuffer = NULL;
+
 static void
 testIoWrite(void *driver, const Buffer *buffer)
 {
     ASSERT(driver == (void *)999);
     ASSERT(strEq(strNewBuf(buffer), strNew("ABC")));
+    testIoWriteBuffer = buffer;
 }
 
 static bool testIoWriteCloseCalled = false;
@@ -232,6 +235,40 @@ ioTestFilterMultiplyNew(const char *type, unsigned int multiplier, unsigned int
     return this;
 }
 
+/***********************************************************************************************************************************
+Test filter that throws an error on input
+***********************************************************************************************************************************/
+static void
+ioTestFilterErrorProcess(THIS_VOID, const Buffer *buffer)
+{
+    (void)thisVoid;
+    (void)buffer;
+
+    THROW(FormatError, "invalid input");
+}
+
+static Variant *
+ioTestFilterErrorResult(THIS_VOID)
+{
+    (void)thisVoid;
+
+    return NULL;
+}
+
+static IoFilter *
+ioTestFilterErrorNew(void)
+{
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("IoTestFilterError")
+    {
+        this = ioFilterNewP(strNew("error"), (void *)1, NULL, .in = ioTestFilterErrorProcess, .result = ioTestFilterErrorResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    return this;
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -246,6 +283,129 @@ testRun(void)
         TEST_RESULT_SIZE(ioBufferSize(), 65536, "check initial buffer size");
         TEST_RESULT_VOID(ioBufferSizeSet(16384), "set buffer size");
         TEST_RESULT_SIZE(ioBufferSize(), 16384, "check buffer size");
+
+        TEST_RESULT_SIZE(ioBufferSizeGrow(4096), 8192, "grow buffer size");
+        TEST_RESULT_SIZE(ioBufferSizeGrow(12288), 16384, "grow buffer size to max");
+        TEST_RESULT_SIZE(ioBufferSizeGrow(32768), 32768, "do not shrink buffer size");
+
+        // Driver buffers start at the driver size and grow to the buffer size when they keep filling up
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(16);
+
+        IoRead *bufferRead = ioBufferReadNew(BUFSTRDEF("0123456789012345678901234567890123456789"));
+        IoReadInterface readInterface = *ioReadInterface(bufferRead);
+        readInterface.bufferSize = 4;
+
+        IoRead *read = ioReadNew(ioReadDriver(bufferRead), readInterface);
+        ioFilterGroupAdd(ioReadFilterGroup(read), ioTestFilterMultiplyNew("single", 1, 1, 'Y'));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_RESULT_SIZE(bufSize(read->input), 4, "    input buffer size from driver");
+
+        Buffer *buffer = bufNew(32);
+
+        TEST_RESULT_SIZE(ioRead(read, buffer), 32, "    read");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "01234567890123456789012345678901", "    check read");
+        TEST_RESULT_SIZE(bufSize(read->input), 16, "    input buffer grew");
+
+        readInterface.bufferSize = 32;
+        TEST_RESULT_SIZE(bufSize(ioReadNew(ioReadDriver(bufferRead), readInterface)->input), 16, "    driver size over max");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        buffer = bufNew(0);
+        IoWrite *bufferWrite = ioBufferWriteNew(buffer);
+        IoWriteInterface writeInterface = *ioWriteInterface(bufferWrite);
+        writeInterface.bufferSize = 4;
+
+        IoWrite *write = ioWriteNew(ioWriteDriver(bufferWrite), writeInterface);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), ioTestFilterMultiplyNew("single", 1, 1, 'Y'));
+
+        TEST_RESULT_VOID(ioWriteOpen(write), "open write");
+        TEST_RESULT_SIZE(bufSize(write->output), 4, "    output buffer size from driver");
+        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("0123456789012345678901234567890123456789")), "    write");
+        TEST_RESULT_SIZE(bufSize(write->output), 16, "    output buffer grew");
+        TEST_RESULT_VOID(ioWriteClose(write), "    close");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(buffer)), "0123456789012345678901234567890123456789Y", "    check write");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("ioFilterThread() and ioFilterThreadSet()"))
+    {
+        TEST_RESULT_BOOL(ioFilterThread(), false, "check initial filter thread");
+        TEST_RESULT_VOID(ioFilterThreadSet(true), "set filter thread");
+        TEST_RESULT_BOOL(ioFilterThread(), true, "check filter thread");
+
+        // Read through input and output filters in threads
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(4);
+        IoRead *read = ioBufferReadNew(BUFSTRDEF("0123456789"));
+        IoFilterGroup *filterGroup = ioReadFilterGroup(read);
+
+        ioFilterGroupAdd(filterGroup, ioSizeNew());
+        ioFilterGroupAdd(filterGroup, ioTestFilterMultiplyNew("double", 2, 3, 'X'));
+        ioFilterGroupAdd(filterGroup, ioTestFilterSizeNew("size2"));
+        ioFilterGroupAdd(filterGroup, ioTestFilterMultiplyNew("single", 1, 1, 'Y'));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_RESULT_UINT(filterGroup->thread->threadTotal, 4, "    one thread per filter");
+        TEST_RESULT_STR(strPtr(strNewBuf(ioReadBuf(read))), "00112233445566778899XXXY", "    read through filters");
+        TEST_RESULT_BOOL(ioReadEof(read), true, "    eof");
+        TEST_RESULT_VOID(ioReadClose(read), "    close read");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(ioFilterGroupResultAll(filterGroup))), "{\"double\":null,\"single\":null,\"size\":10,\"size2\":23}",
+            "    check filter results");
+
+        // Write through input filters only so the last filter passes its input on to the output
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *buffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(buffer);
+        filterGroup = ioWriteFilterGroup(write);
+
+        ioFilterGroupAdd(filterGroup, ioSizeNew());
+        ioFilterGroupAdd(filterGroup, ioTestFilterSizeNew("size2"));
+
+        TEST_RESULT_VOID(ioWriteOpen(write), "open write");
+        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("ABC")), "    write");
+        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("DEFGHIJKLM")), "    write more than the buffer size");
+        TEST_RESULT_VOID(ioWriteClose(write), "    close write");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "ABCDEFGHIJKLM", "    check write");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(ioFilterGroupResultAll(filterGroup))), "{\"buffer\":null,\"size\":13,\"size2\":13}",
+            "    check filter results");
+
+        // Close before all the output has been read
+        // -------------------------------------------------------------------------------------------------------------------------
+        read = ioBufferReadNew(BUFSTRDEF("0123456789"));
+        filterGroup = ioReadFilterGroup(read);
+        ioFilterGroupAdd(filterGroup, ioTestFilterMultiplyNew("double", 2, 3, 'X'));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        buffer = bufNew(2);
+        TEST_RESULT_UINT(ioRead(read, buffer), 2, "    read");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "00", "    check read");
+        TEST_RESULT_VOID(ioReadClose(read), "    close read");
+        TEST_RESULT_UINT(filterGroup->thread->threadTotal, 0, "    threads stopped");
+
+        // Error in a filter thread is thrown by the caller
+        // -------------------------------------------------------------------------------------------------------------------------
+        read = ioBufferReadNew(BUFSTRDEF("0123456789"));
+        ioFilterGroupAdd(ioReadFilterGroup(read), ioTestFilterMultiplyNew("double", 2, 3, 'X'));
+        ioFilterGroupAdd(ioReadFilterGroup(read), ioTestFilterErrorNew());
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_ERROR(ioReadBuf(read), FormatError, "invalid input");
+        TEST_RESULT_VOID(ioReadFree(read), "    free read and stop threads");
+
+        // No threads without filters
+        // -------------------------------------------------------------------------------------------------------------------------
+        read = ioBufferReadNew(BUFSTRDEF("0123"));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_RESULT_PTR(ioReadFilterGroup(read)->thread, NULL, "    no threads");
+        TEST_RESULT_STR(strPtr(strNewBuf(ioReadBuf(read))), "0123", "    read");
+
+        ioFilterThreadSet(false);
     }
 
     // *****************************************************************************************************************************
@@ -313,6 +473,7 @@ testRun(void)
             "[{\"size\":null},{\"double\":[\"double\",2,3]},{\"size\":null},{\"buffer\":null}]", "    check filter params");
 
         TEST_RESULT_BOOL(ioReadOpen(bufferRead), true, "    open");
+        TEST_RESULT_BOOL(ioFilterGroupInPlace(ioReadFilterGroup(bufferRead)), false, "    not in place");
         TEST_RESULT_INT(ioReadHandle(bufferRead), -1, "    handle invalid");
         TEST_RESULT_BOOL(ioReadEof(bufferRead), false, "    not eof");
         TEST_RESULT_SIZE(ioRead(bufferRead, buffer), 2, "    read 2 bytes");
@@ -453,6 +614,35 @@ testRun(void)
         TEST_RESULT_BOOL(ioReadDrain(bufferRead), true, "drain read io");
         TEST_RESULT_UINT(varUInt64(ioFilterGroupResult(ioReadFilterGroup(bufferRead), SIZE_FILTER_TYPE_STR)), 20, "check length");
 
+        // Read directly into the caller's buffer when no filter produces output
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(2);
+        buffer = bufNew(8);
+
+        bufferRead = ioBufferReadNew(BUFSTRDEF("read in place"));
+        ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioSizeNew());
+
+        TEST_RESULT_BOOL(ioReadOpen(bufferRead), true, "open");
+        TEST_RESULT_BOOL(ioFilterGroupInPlace(ioReadFilterGroup(bufferRead)), true, "    in place");
+
+        bufLimitSet(buffer, 6);
+        TEST_RESULT_UINT(ioRead(bufferRead, buffer), 6, "    read to caller's limit");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "read i", "    check buffer");
+        TEST_RESULT_UINT(bufSize(buffer), 6, "    limit is unchanged");
+
+        bufLimitClear(buffer);
+        TEST_RESULT_UINT(ioRead(bufferRead, buffer), 2, "    read to end of buffer");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "read in ", "    check buffer");
+
+        bufUsedZero(buffer);
+        TEST_RESULT_UINT(ioRead(bufferRead, buffer), 5, "    read to eof");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "place", "    check buffer");
+        TEST_RESULT_BOOL(ioReadEof(bufferRead), true, "    eof");
+        TEST_RESULT_VOID(ioReadClose(bufferRead), "    close");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(ioFilterGroupResultAll(ioReadFilterGroup(bufferRead)))), "{\"buffer\":null,\"size\":13}",
+            "    check filter result all");
+
         // Cannot open file
         TEST_ASSIGN(
             read, ioReadNewP((void *)998, .close = testIoReadClose, .open = testIoReadOpen, .read = testIoRead),
@@ -472,7 +662,11 @@ testRun(void)
 
         TEST_RESULT_VOID(ioWriteOpen(write), "    open io object");
         TEST_RESULT_BOOL(testIoWriteOpenCalled, true, "    check io object open");
-        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("ABC")), "    write 3 bytes");
+        TEST_RESULT_BOOL(ioFilterGroupInPlace(ioWriteFilterGroup(write)), true, "    in place");
+
+        const Buffer *bufferABC = BUFSTRDEF("ABC");
+        TEST_RESULT_VOID(ioWrite(write, bufferABC), "    write 3 bytes");
+        TEST_RESULT_PTR(testIoWriteBuffer, bufferABC, "    buffer written without copying");
         TEST_RESULT_VOID(ioWriteClose(write), "    close io object");
         TEST_RESULT_BOOL(testIoWriteCloseCalled, true, "    check io object closed");
 
@@ -513,6 +707,25 @@ testRun(void)
         TEST_RESULT_UINT(
             varUInt64(ioFilterGroupResult(filterGroup, ioFilterType(sizeFilter))), 9, "    check filter result");
         TEST_RESULT_UINT(varUInt64(ioFilterGroupResult(filterGroup, strNew("size2"))), 22, "    check filter result");
+
+        // Write in place when no filter produces output
+        // -------------------------------------------------------------------------------------------------------------------------
+        buffer = bufNew(0);
+
+        TEST_ASSIGN(bufferWrite, ioBufferWriteNew(buffer), "create buffer write object");
+        ioFilterGroupAdd(ioWriteFilterGroup(bufferWrite), ioSizeNew());
+
+        TEST_RESULT_VOID(ioWriteOpen(bufferWrite), "    open");
+        TEST_RESULT_BOOL(ioFilterGroupInPlace(ioWriteFilterGroup(bufferWrite)), true, "    in place");
+        TEST_RESULT_VOID(ioWriteStr(bufferWrite, STRDEF("1234")), "    write directly");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "1234", "    check write");
+        TEST_RESULT_VOID(ioWriteStr(bufferWrite, STRDEF("5")), "    write is collected");
+        TEST_RESULT_VOID(ioWriteStr(bufferWrite, STRDEF("678")), "    write is collected since output is not empty");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "1234567", "    check write");
+        TEST_RESULT_VOID(ioWriteClose(bufferWrite), "    close");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "12345678", "    check write after close");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(bufferWrite), SIZE_FILTER_TYPE_STR)), 8, "    check filter result");
     }
 
     // *****************************************************************************************************************************
@@ -600,5 +813,116 @@ testRun(void)
         TEST_RESULT_VOID(ioHandleWriteOneStr(fileHandle, strNew("test1\ntest2")), "write string to file");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("ioStatEnabled(), ioStatEnabledSet(), ioStatTotalAdd(), and ioStatTotalLog()"))
+    {
+        TEST_RESULT_BOOL(ioStatEnabled(), false, "check initial stat enabled");
+        TEST_RESULT_PTR(ioStatTotal(), NULL, "no totals");
+        TEST_RESULT_VOID(ioStatTotalLog(), "nothing to log");
+
+        // Totals with the same name are summed
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(
+            ioStatTotalAdd(jsonToVar(strNew("{\"size\":{\"cpu\":1000000,\"wall\":1500000,\"in\":512,\"out\":512}}"))),
+            "add totals");
+        TEST_RESULT_VOID(ioStatTotalAdd(NULL), "add no totals");
+        TEST_RESULT_VOID(
+            ioStatTotalAdd(
+                jsonToVar(
+                    strNew(
+                        "{\"size\":{\"cpu\":500000,\"wall\":500000,\"in\":512,\"out\":512},"
+                        "\"read\":{\"cpu\":250,\"wall\":3000000,\"in\":1024,\"out\":0}}"))),
+            "add more totals");
+        TEST_RESULT_STR(
+            strPtr(jsonFromVar(ioStatTotal())),
+            "{\"read\":{\"cpu\":250,\"in\":1024,\"out\":0,\"wall\":3000000},"
+                "\"size\":{\"cpu\":1500000,\"in\":1024,\"out\":1024,\"wall\":2000000}}",
+            "check totals");
+
+        TEST_RESULT_VOID(ioStatTotalLog(), "log totals");
+        harnessLogResult(
+            "P00   INFO: filter stat size: cpu 1.500s, wall 2.000s, in 1KB, out 1KB\n"
+            "P00   INFO: filter stat read: cpu 0.000s, wall 3.000s, in 1KB, out 0B");
+        TEST_RESULT_PTR(ioStatTotal(), NULL, "totals reset");
+
+        // Gather statistics for read filters
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(ioStatEnabledSet(true), "enable stats");
+        TEST_RESULT_BOOL(ioStatEnabled(), true, "check stat enabled");
+
+        ioBufferSizeSet(4);
+        IoRead *read = ioBufferReadNew(BUFSTRDEF("0123456789"));
+        ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+        ioFilterGroupAdd(ioReadFilterGroup(read), ioTestFilterMultiplyNew("double", 2, 3, 'X'));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_RESULT_STR(strPtr(strNewBuf(ioReadBuf(read))), "00112233445566778899XXX", "    read through filters");
+        TEST_RESULT_VOID(ioReadClose(read), "    close read");
+
+        const KeyValue *stat = varKv(ioFilterGroupResult(ioReadFilterGroup(read), IO_STAT_RESULT_STR));
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstNewVarLst(kvKeyList(stat)), ",")), "size,double,read", "    check stat names");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("size"))), VARSTRDEF("in"))), 10, "    check size in");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("size"))), VARSTRDEF("out"))), 10, "    check size out");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("double"))), VARSTRDEF("in"))), 10, "    check double in");
+        TEST_RESULT_UINT(
+            varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("double"))), VARSTRDEF("out"))), 23, "    check double out");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("read"))), VARSTRDEF("in"))), 10, "    check read in");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("read"))), VARSTRDEF("out"))), 23, "    check read out");
+
+        // Gather statistics for write filters. The buffer filter added by the filter group is skipped.
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *buffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(buffer);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), ioSizeNew());
+
+        TEST_RESULT_VOID(ioWriteOpen(write), "open write");
+        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("ABCDEFGH")), "    write");
+        TEST_RESULT_VOID(ioWriteClose(write), "    close write");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "ABCDEFGH", "    check write");
+
+        stat = varKv(ioFilterGroupResult(ioWriteFilterGroup(write), IO_STAT_RESULT_STR));
+
+        TEST_RESULT_STR(strPtr(strLstJoin(strLstNewVarLst(kvKeyList(stat)), ",")), "size,write", "    check stat names");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("write"))), VARSTRDEF("in"))), 8, "    check write in");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(stat, VARSTRDEF("write"))), VARSTRDEF("out"))), 8, "    check write out");
+
+        // Totals include read and write
+        // -------------------------------------------------------------------------------------------------------------------------
+        const KeyValue *total = varKv(ioStatTotal());
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstNewVarLst(kvKeyList(total)), ",")), "size,double,read,write", "check total names");
+        TEST_RESULT_UINT(varUInt64(kvGet(varKv(kvGet(total, VARSTRDEF("size"))), VARSTRDEF("in"))), 18, "    check size in");
+
+        TEST_RESULT_VOID(ioStatTotalLog(), "log totals");
+        harnessLogResultRegExp(
+            "P00   INFO: filter stat size: cpu [0-9]+\\.[0-9]{3}s, wall [0-9]+\\.[0-9]{3}s, in 18B, out 18B\n"
+            "P00   INFO: filter stat double: cpu [0-9]+\\.[0-9]{3}s, wall [0-9]+\\.[0-9]{3}s, in 10B, out 23B\n"
+            "P00   INFO: filter stat read: cpu [0-9]+\\.[0-9]{3}s, wall [0-9]+\\.[0-9]{3}s, in 10B, out 23B\n"
+            "P00   INFO: filter stat write: cpu [0-9]+\\.[0-9]{3}s, wall [0-9]+\\.[0-9]{3}s, in 8B, out 8B");
+
+        ioStatEnabledSet(false);
+
+        // Driver statistics are gathered without CPU time when statistics are disabled
+        // -------------------------------------------------------------------------------------------------------------------------
+        read = ioBufferReadNew(BUFSTRDEF("0123456789"));
+
+        TEST_RESULT_BOOL(ioReadOpen(read), true, "open read");
+        TEST_RESULT_STR(strPtr(strNewBuf(ioReadBuf(read))), "0123456789", "    read");
+        TEST_RESULT_VOID(ioReadClose(read), "    close read");
+        TEST_RESULT_UINT(ioReadStat(read)->sizeIn, 10, "    check read in");
+        TEST_RESULT_UINT(ioReadStat(read)->timeCpu, 0, "    check read cpu");
+
+        write = ioBufferWriteNew(bufNew(0));
+
+        TEST_RESULT_VOID(ioWriteOpen(write), "open write");
+        TEST_RESULT_VOID(ioWriteStr(write, STRDEF("ABCDEFGH")), "    write");
+        TEST_RESULT_VOID(ioWriteClose(write), "    close write");
+        TEST_RESULT_UINT(ioWriteStat(write)->sizeOut, 8, "    check write out");
+        TEST_RESULT_UINT(ioWriteStat(write)->timeCpu, 0, "    check write cpu");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -11,11 +11,14 @@ testRun(void)
     FUNCTION_HARNESS_VOID();
 
     // *****************************************************************************************************************************
-    if (testBegin("timeMSec()"))
+    if (testBegin("timeMSec() and timeUSec()"))
     {
         // Make sure the time returned is between 2017 and 2100
         TEST_RESULT_BOOL(timeMSec() > (TimeMSec)1483228800000, true, "lower range check");
         TEST_RESULT_BOOL(timeMSec() < (TimeMSec)4102444800000, true, "upper range check");
+
+        TEST_RESULT_BOOL(timeUSec() > (TimeUSec)1483228800000000, true, "usec lower range check");
+        TEST_RESULT_BOOL(timeUSec() < (TimeUSec)4102444800000000, true, "usec upper range check");
     }
 
     // *****************************************************************************************************************************
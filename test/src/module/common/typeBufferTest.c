@@ -116,11 +116,27 @@ testRun(void)
     }
 
     // *****************************************************************************************************************************
-    if (testBegin("bufDup() and bufEq()"))
+    if (testBegin("bufDup(), bufEq(), and bufZero()"))
     {
         TEST_RESULT_BOOL(bufEq(BUFSTRDEF("123"), bufDup(BUFSTRDEF("1234"))), false, "buffer sizes not equal");
         TEST_RESULT_BOOL(bufEq(BUFSTR(STRDEF("321")), BUFSTRDEF("123")), false, "buffer sizes equal");
         TEST_RESULT_BOOL(bufEq(bufDup(BUFSTRZ("123")), BUF("123", 3)), true, "buffers equal");
+
+        Buffer *buffer = bufNew(8192 + 3);
+        bufUsedSet(buffer, bufSize(buffer));
+        memset(bufPtr(buffer), 0, bufSize(buffer));
+
+        TEST_RESULT_BOOL(bufZero(bufNew(0)), true, "empty buffer is zero");
+        TEST_RESULT_BOOL(bufZero(buffer), true, "buffer is zero");
+        TEST_RESULT_BOOL(bufZero(BUF(bufPtr(buffer) + 1, 8192)), true, "unaligned buffer is zero");
+
+        bufPtr(buffer)[4097] = 1;
+        TEST_RESULT_BOOL(bufZero(buffer), false, "buffer is not zero in a block");
+        TEST_RESULT_BOOL(bufZero(BUF(bufPtr(buffer), 4097)), true, "    buffer before the non-zero byte is zero");
+
+        bufPtr(buffer)[4097] = 0;
+        bufPtr(buffer)[8194] = 1;
+        TEST_RESULT_BOOL(bufZero(buffer), false, "buffer is not zero after the last block");
     }
 
     // *****************************************************************************************************************************
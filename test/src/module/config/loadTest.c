@@ -297,6 +297,78 @@ testRun(void)
 
         unsetenv("PGBACKREST_REPO1_S3_KEY");
         unsetenv("PGBACKREST_REPO1_S3_KEY_SECRET");
+
+        // Compress level defaults depend on compress type
+        // -------------------------------------------------------------------------------------------------------------------------
+        argList = strLstNew();
+        strLstAdd(argList, strNew("--stanza=db"));
+        strLstAdd(argList, strNew("--pg1-path=/path/to/db"));
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argList), "load config with default compress type");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 6, "    check gz default compress level");
+
+        // The allowed range covers all types so the level is checked against the type after parsing
+        StringList *argListLevel = strLstDup(argList);
+        strLstAdd(argListLevel, strNew("--compress-level=10"));
+
+        TEST_ERROR(
+            harnessCfgLoad(cfgCmdArchivePush, argListLevel), OptionInvalidValueError,
+            "'10' is out of range for 'compress-level' option when 'compress-type' is 'gz'\n"
+            "HINT: allowed levels for 'gz' are 0-9.");
+
+        argListLevel = strLstDup(argList);
+        strLstAdd(argListLevel, strNew("--compress-level=0"));
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argListLevel), "load config with gz compress level 0");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 0, "    check gz compress level");
+
+        strLstAdd(argList, strNew("--compress-type=lz4"));
+
+#ifndef HAVE_LIBLZ4
+        TEST_ERROR(
+            harnessCfgLoad(cfgCmdArchivePush, argList), OptionInvalidValueError, PROJECT_NAME " not compiled with lz4 support");
+#else
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argList), "load config with lz4 compress type");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 1, "    check lz4 default compress level");
+
+        argListLevel = strLstDup(argList);
+        strLstAdd(argListLevel, strNew("--compress-level=9"));
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argListLevel), "load config with lz4 compress type and level");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 9, "    check lz4 compress level");
+
+        argListLevel = strLstDup(argList);
+        strLstAdd(argListLevel, strNew("--compress-level=12"));
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argListLevel), "load config with lz4 maximum compress level");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 12, "    check lz4 compress level");
+
+        strLstAdd(argList, strNew("--compress-level=0"));
+
+        TEST_ERROR(
+            harnessCfgLoad(cfgCmdArchivePush, argList), OptionInvalidValueError,
+            "'0' is out of range for 'compress-level' option when 'compress-type' is 'lz4'\n"
+            "HINT: allowed levels for 'lz4' are 1-12.");
+#endif
+
+        argList = strLstNew();
+        strLstAdd(argList, strNew("--stanza=db"));
+        strLstAdd(argList, strNew("--pg1-path=/path/to/db"));
+        strLstAdd(argList, strNew("--compress-type=zst"));
+
+#ifndef HAVE_LIBZSTD
+        TEST_ERROR(
+            harnessCfgLoad(cfgCmdArchivePush, argList), OptionInvalidValueError, PROJECT_NAME " not compiled with zst support");
+#else
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argList), "load config with zst compress type");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 3, "    check zst default compress level");
+        TEST_RESULT_UINT(cfgOptionUInt(cfgOptCompressThread), 1, "    check default compress threads");
+
+        strLstAdd(argList, strNew("--compress-level=19"));
+
+        TEST_RESULT_VOID(harnessCfgLoad(cfgCmdArchivePush, argList), "load config with zst maximum compress level");
+        TEST_RESULT_INT(cfgOptionInt(cfgOptCompressLevel), 19, "    check zst compress level");
+#endif
     }
 
     // *****************************************************************************************************************************
@@ -24,7 +24,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_UINT(sizeof(ManifestLoadFound), TEST_64BIT() ? 1 : 1, "check size of ManifestLoadFound");
         TEST_RESULT_UINT(sizeof(ManifestPath), TEST_64BIT() ? 32 : 16, "check size of ManifestPath");
-        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 120 : 92, "check size of ManifestFile");
+        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 160 : 128, "check size of ManifestFile");
     }
 
     // *****************************************************************************************************************************
@@ -132,8 +132,10 @@ testRun(void)
             "option-buffer-size=16384\n"                                                                                           \
             "option-checksum-page=true\n"                                                                                          \
             "option-compress=false\n"                                                                                              \
+            "option-compress-dict=true\n"                                                                                          \
             "option-compress-level=3\n"                                                                                            \
             "option-compress-level-network=3\n"                                                                                    \
+            "option-compress-type=\"lz4\"\n"                                                                                       \
             "option-delta=false\n"                                                                                                 \
             "option-hardlink=false\n"                                                                                              \
             "option-online=false\n"                                                                                                \
@@ -162,14 +164,16 @@ testRun(void)
             "[target:file]\n"                                                                                                      \
             "pg_data/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"master\":true"                        \
                 ",\"reference\":\"20190818-084502F_20190819-084506D\",\"size\":4,\"timestamp\":1565282114}\n"                      \
-            "pg_data/base/16384/17000={\"checksum\":\"e0101dd8ffb910c9c202ca35b5f828bcb9697bed\",\"checksum-page\":false"          \
-                ",\"checksum-page-error\":[1],\"repo-size\":4096,\"size\":8192,\"timestamp\":1565282114}\n"                        \
+            "pg_data/base/16384/17000={\"checksum\":\"e0101dd8ffb910c9c202ca35b5f828bcb9697bed\""                                  \
+                ",\"checksum-fast\":\"12f8c02a0617441f0db078e863be4061\",\"checksum-page\":false"                                  \
+                ",\"checksum-page-error\":[1],\"compress-bypass\":true,\"repo-size\":4096,\"size\":8192"                           \
+                ",\"timestamp\":1565282114}\n"                                                                                     \
             "pg_data/base/16384/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"group\":false,\"size\":4"  \
                 ",\"timestamp\":1565282115}\n"                                                                                     \
             "pg_data/base/32768/33000={\"checksum\":\"7a16d165e4775f7c92e8cdf60c0af57313f0bf90\",\"checksum-page\":true"           \
-                ",\"reference\":\"20190818-084502F\",\"size\":1073741824,\"timestamp\":1565282116}\n"                              \
+                ",\"compress-dict\":true,\"reference\":\"20190818-084502F\",\"size\":1073741824,\"timestamp\":1565282116}\n"       \
             "pg_data/base/32768/33000.32767={\"checksum\":\"6e99b589e550e68e934fd235ccba59fe5b592a9e\",\"checksum-page\":true"     \
-                ",\"reference\":\"20190818-084502F\",\"size\":32768,\"timestamp\":1565282114}\n"                                   \
+                ",\"reference\":\"20190818-084502F\",\"size\":32768,\"timestamp\":1565282114,\"zero-elide\":true}\n"               \
             "pg_data/postgresql.conf={\"checksum\":\"6721d92c9fcdf4248acff1f9a1377127d9064807\",\"master\":true,\"size\":4457"     \
                 ",\"timestamp\":1565282114}\n"                                                                                     \
             "pg_data/special={\"master\":true,\"mode\":\"0640\",\"size\":0,\"timestamp\":1565282120,\"user\":false}\n"
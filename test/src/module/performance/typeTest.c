@@ -14,6 +14,7 @@ running out of memory on the test systems or taking an undue amount of time.  It
 #include "common/time.h"
 #include "common/type/list.h"
 #include "info/manifest.h"
+#include "postgres/interface.h"
 
 #include "common/harnessInfo.h"
 
@@ -266,5 +267,50 @@ testRun(void)
         TEST_LOG_FMT("completed in %ums", (unsigned int)(timeMSec() - timeBegin));
     }
 
+    // Checksum pages with each block checksum implementation supported by the cpu. The default scale checksums 1GB of pages, i.e. a
+    // full relation segment.
+    // *****************************************************************************************************************************
+    if (testBegin("pageChecksumBlock()"))
+    {
+        CHECK(testScale() <= 1000);
+
+        unsigned int pageTotal = 131072 * (unsigned int)testScale();
+        unsigned int pageBufferTotal = 1024;
+
+        // Fill a buffer with pseudo-random pages that will be checksummed repeatedly
+        Buffer *pageBuffer = bufNew(pageBufferTotal * PG_PAGE_SIZE_DEFAULT);
+        unsigned char *pagePtr = bufPtr(pageBuffer);
+        uint32_t seed = 0xFACEFACE;
+
+        for (size_t byteIdx = 0; byteIdx < bufSize(pageBuffer); byteIdx++)
+        {
+            seed = seed * 1103515245 + 12345;
+            pagePtr[byteIdx] = (unsigned char)(seed >> 16);
+        }
+
+        TEST_LOG_FMT(
+            "checksum %s in %s pages",
+            strPtr(strSizeFormat((uint64_t)pageTotal * PG_PAGE_SIZE_DEFAULT)), strPtr(strSizeFormat(PG_PAGE_SIZE_DEFAULT)));
+
+        for (unsigned int implIdx = 0; implIdx < sizeof(pageChecksumBlockImplList) / sizeof(PageChecksumBlockImpl); implIdx++)
+        {
+            const PageChecksumBlockImpl *impl = &pageChecksumBlockImplList[implIdx];
+
+            if (!pageChecksumBlockImplSupported(impl))
+            {
+                TEST_LOG_FMT("%s not supported by cpu", impl->name);
+                continue;
+            }
+
+            TimeMSec timeBegin = timeMSec();
+            uint32_t result = 0;
+
+            for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)
+                result += impl->block(pagePtr + (pageIdx % pageBufferTotal) * PG_PAGE_SIZE_DEFAULT, PG_PAGE_SIZE_DEFAULT);
+
+            TEST_LOG_FMT("%s completed in %ums (result %08x)", impl->name, (unsigned int)(timeMSec() - timeBegin), result);
+        }
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
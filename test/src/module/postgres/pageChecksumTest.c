@@ -124,5 +124,71 @@ testRun(void)
             false, "invalid page buffer");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("pageChecksumBlock()"))
+    {
+        TEST_TITLE("fill pages with pseudo-random data");
+
+        uint32_t seed = 0xFACEFACE;
+
+        for (unsigned int byteIdx = 0; byteIdx < TEST_PAGE_TOTAL * TEST_PAGE_SIZE; byteIdx++)
+        {
+            seed = seed * 1103515245 + 12345;
+            testPage(0)[byteIdx] = (unsigned char)(seed >> 16);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("scalar implementation is always supported and is last in the list");
+
+        const PageChecksumBlockImpl *implScalar =
+            &pageChecksumBlockImplList[sizeof(pageChecksumBlockImplList) / sizeof(PageChecksumBlockImpl) - 1];
+
+        TEST_RESULT_STR(implScalar->name, "scalar", "    check name");
+        TEST_RESULT_BOOL(pageChecksumBlockImplSupported(implScalar), true, "    check supported");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("all supported implementations match the scalar implementation");
+
+        for (unsigned int implIdx = 0; implIdx < sizeof(pageChecksumBlockImplList) / sizeof(PageChecksumBlockImpl); implIdx++)
+        {
+            const PageChecksumBlockImpl *impl = &pageChecksumBlockImplList[implIdx];
+
+            if (!pageChecksumBlockImplSupported(impl))
+            {
+                TEST_LOG_FMT("%s not supported by cpu", impl->name);
+                continue;
+            }
+
+            // Check all valid page sizes on pages with varied alignment
+            for (unsigned int pageSize = 1024; pageSize <= 32768; pageSize *= 2)
+            {
+                for (unsigned int pageIdx = 0; pageIdx < TEST_PAGE_TOTAL * TEST_PAGE_SIZE / pageSize; pageIdx++)
+                {
+                    if (impl->block(testPage(0) + pageIdx * pageSize, pageSize) !=
+                        implScalar->block(testPage(0) + pageIdx * pageSize, pageSize))
+                    {
+                        THROW_FMT(AssertError, "%s checksum does not match scalar for page size %u", impl->name, pageSize);
+                    }
+                }
+            }
+
+            TEST_LOG_FMT("%s matches scalar", impl->name);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("first supported implementation is selected");
+
+        const PageChecksumBlockImpl *implFirst = pageChecksumBlockImplList;
+
+        while (!pageChecksumBlockImplSupported(implFirst))
+            implFirst++;
+
+        pageChecksumBlockImpl = NULL;
+
+        TEST_RESULT_UINT(
+            pageChecksumBlock(testPage(0), TEST_PAGE_SIZE), implScalar->block(testPage(0), TEST_PAGE_SIZE), "checksum block");
+        TEST_RESULT_STR(pageChecksumBlockImpl->name, implFirst->name, "    check first supported implementation");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -510,6 +510,11 @@ testRun(void)
                 TEST_RESULT_VOID(ioWriteFlush(write), "flush noop");
                 TEST_RESULT_STR(strPtr(ioReadLine(read)), "{}", "noop result");
 
+                // IO statistics are empty when no IO has been done
+                TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"ioStat\"}")), "write io stat");
+                TEST_RESULT_VOID(ioWriteFlush(write), "flush io stat");
+                TEST_RESULT_STR(strPtr(ioReadLine(read)), "{}", "io stat result");
+
                 // Invalid command
                 KeyValue *result = NULL;
 
@@ -800,6 +805,7 @@ testRun(void)
         ProtocolClient *client = NULL;
 
         TEST_RESULT_VOID(protocolFree(), "free protocol objects before anything has been created");
+        TEST_RESULT_VOID(protocolLocalIoStat(), "io stats before anything has been created");
 
         TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypeRepo, 1), "get remote protocol");
         TEST_RESULT_PTR(protocolRemoteGet(protocolStorageTypeRepo, 1), client, "get remote cached protocol");
@@ -885,6 +891,7 @@ testRun(void)
         TEST_ASSIGN(client, protocolLocalGet(protocolStorageTypeRepo, 1), "get local protocol");
         TEST_RESULT_PTR(protocolLocalGet(protocolStorageTypeRepo, 1), client, "get local cached protocol");
         TEST_RESULT_PTR(protocolHelper.clientLocal[0].client, client, "check location in cache");
+        TEST_RESULT_VOID(protocolLocalIoStat(), "get io stats from local");
 
         TEST_RESULT_VOID(protocolFree(), "free local and remote protocol objects");
     }
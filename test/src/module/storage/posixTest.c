@@ -1,9 +1,17 @@
 /***********************************************************************************************************************************
 Test Posix Storage
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
 #include <unistd.h>
 #include <utime.h>
 
+#include "common/compress/gzip/compress.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/io/bufferRead.h"
+#include "common/io/filter/size.h"
+#include "common/io/handleRead.h"
 #include "common/io/io.h"
 #include "common/time.h"
 #include "storage/read.h"
@@ -418,8 +426,138 @@ testRun(void)
         TEST_RESULT_BOOL(storageCopyNP(source, destination), true, "copy file");
         TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetNP(storageNewReadNP(storageTest, destinationFile))), true, "check file");
 
+        // Copy in the kernel and read the destination back for the size filters
+        // -------------------------------------------------------------------------------------------------------------------------
+        source = storageNewReadNP(storageTest, sourceFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), ioSizeNew());
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), ioSizeNew());
+
+        TEST_RESULT_BOOL(storageCopyNP(source, destination), true, "copy file with size filters");
+        TEST_RESULT_BOOL(
+            bufEq(expectedBuffer, storageGetNP(storageNewReadNP(storageTest, destinationFile))), true, "    check file");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(source)), SIZE_FILTER_TYPE_STR)), 9,
+            "    check read size");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(destination)), SIZE_FILTER_TYPE_STR)), 9,
+            "    check write size");
+
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), ioSizeNew());
+
+        TEST_RESULT_BOOL(
+            storageCopyNP(storageNewReadNP(storageTest, sourceFile), destination), true, "copy file with write filter");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(destination)), SIZE_FILTER_TYPE_STR)), 9,
+            "    check write size");
+
+        // Copy through user space when a filter changes the data
+        // -------------------------------------------------------------------------------------------------------------------------
+        source = storageNewReadNP(storageTest, sourceFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), gzipCompressNew(3, false));
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), gzipDecompressNew(false));
+
+        TEST_RESULT_BOOL(storageCopyNP(source, destination), true, "copy file with read filter");
+        TEST_RESULT_BOOL(
+            bufEq(expectedBuffer, storageGetNP(storageNewReadNP(storageTest, destinationFile))), true, "    check file");
+
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), gzipCompressNew(3, false));
+
+        TEST_RESULT_BOOL(
+            storageCopyNP(storageNewReadNP(storageTest, sourceFile), destination), true, "copy file with write filter");
+
+        StorageRead *readGz = storageNewReadNP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(readGz)), gzipDecompressNew(false));
+        TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetNP(readGz)), true, "    check file");
+
+        // Copy through user space when the driver cannot copy
+        // -------------------------------------------------------------------------------------------------------------------------
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ((StorageWritePosix *)destination->driver)->interface.copy = NULL;
+
+        TEST_RESULT_BOOL(
+            storageCopyNP(storageNewReadNP(storageTest, sourceFile), destination), true, "copy file without driver copy");
+        TEST_RESULT_BOOL(
+            bufEq(expectedBuffer, storageGetNP(storageNewReadNP(storageTest, destinationFile))), true, "    check file");
+
+        // Copy an empty file with a size filter so the read back ends with an empty buffer
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, sourceFile), NULL), "write empty source file");
+
+        source = storageNewReadNP(storageTest, sourceFile);
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), ioSizeNew());
+
+        TEST_RESULT_BOOL(storageCopyNP(source, storageNewWriteNP(storageTest, destinationFile)), true, "copy empty file");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(source)), SIZE_FILTER_TYPE_STR)), 0,
+            "    check read size");
+        TEST_RESULT_UINT(storageInfoNP(storageTest, destinationFile).size, 0, "    check file size");
+
+        // Sources that the kernel cannot copy from are not copied
+        // -------------------------------------------------------------------------------------------------------------------------
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioWriteOpen(storageWriteIo(destination));
+
+        IoRead *read = ioBufferReadNew(expectedBuffer);
+        ioReadOpen(read);
+        TEST_RESULT_BOOL(storageWriteCopy(destination, read), false, "source without handle");
+
+        int pipeHandle[2];
+        TEST_RESULT_INT(pipe(pipeHandle), 0, "create pipe");
+
+        read = ioHandleReadNew(strNew("pipe"), pipeHandle[0], 1000);
+        ioReadOpen(read);
+        TEST_RESULT_BOOL(storageWriteCopy(destination, read), false, "source is a pipe");
+
+        close(pipeHandle[0]);
+        close(pipeHandle[1]);
+
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(destination)), "    close destination");
+        TEST_RESULT_UINT(storageInfoNP(storageTest, destinationFile).size, 0, "    check file size");
+
+        // Read ahead is not started when the file is copied in the kernel
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, sourceFile), expectedBuffer), "write source file");
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(3), "set queue depth");
+
+        source = storageNewReadNP(storageTest, sourceFile);
+        ioReadOpen(storageReadIo(source));
+        destination = storageNewWriteNP(storageTest, destinationFile);
+        ioWriteOpen(storageWriteIo(destination));
+
+        TEST_RESULT_BOOL(storageWriteCopy(destination, storageReadIo(source)), true, "copy file in kernel");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->readAheadBegin, true, "    read ahead not started");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->readAhead == NULL, true, "    no read ahead thread");
+
+        ioReadClose(storageReadIo(source));
+        ioWriteClose(storageWriteIo(destination));
+
+        TEST_RESULT_BOOL(
+            bufEq(expectedBuffer, storageGetNP(storageNewReadNP(storageTest, destinationFile))), true, "    check file");
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(1), "reset queue depth");
+
+        // Error after part of the file has been copied
+        // -------------------------------------------------------------------------------------------------------------------------
+
+        struct rlimit limitSave;
+        TEST_RESULT_INT(getrlimit(RLIMIT_FSIZE, &limitSave), 0, "get file size limit");
+        TEST_RESULT_INT(
+            setrlimit(RLIMIT_FSIZE, &(struct rlimit){.rlim_cur = 1, .rlim_max = limitSave.rlim_max}), 0, "limit file size");
+        signal(SIGXFSZ, SIG_IGN);
+
+        TEST_ERROR_FMT(
+            storageCopyNP(storageNewReadNP(storageTest, sourceFile), storageNewWriteNP(storageTest, destinationFile)),
+            FileWriteError, "unable to copy to '%s." STORAGE_FILE_TEMP_EXT "': [27] File too large", strPtr(destinationFile));
+
+        signal(SIGXFSZ, SIG_DFL);
+        TEST_RESULT_INT(setrlimit(RLIMIT_FSIZE, &limitSave), 0, "restore file size limit");
+
         storageRemoveP(storageTest, sourceFile, .errorOnMissing = true);
         storageRemoveP(storageTest, destinationFile, .errorOnMissing = true);
+        storageRemoveP(storageTest, strNewFmt("%s." STORAGE_FILE_TEMP_EXT, strPtr(destinationFile)), .errorOnMissing = true);
     }
 
     // *****************************************************************************************************************************
@@ -903,6 +1041,303 @@ testRun(void)
         TEST_RESULT_VOID(storageReadFree(storageNewReadNP(storageTest, fileName)), "   free file");
 
         TEST_RESULT_VOID(storageReadMove(NULL, memContextTop()), "   move null file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(storagePosixCacheDrop(), false, "cache drop disabled by default");
+        TEST_RESULT_VOID(storagePosixCacheDropSet(true), "enable cache drop");
+        TEST_RESULT_BOOL(storagePosixCacheDrop(), true, "    cache drop enabled");
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), expectedBuffer), "write test file and drop cache");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(bufEq(storageGetNP(file), expectedBuffer), true, "    check file contents");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->offset, bufUsed(expectedBuffer), "    check offset");
+        TEST_RESULT_UINT(bufUsed(((StorageReadPosix *)file->driver)->cacheResident), 1, "    check residency");
+
+        // Drop only the pages that were not resident when the file was opened
+        // -------------------------------------------------------------------------------------------------------------------------
+        const uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+        Buffer *resident = bufNew(4);
+        memcpy(bufPtr(resident), (unsigned char []){0, 1, 0, 1}, 4);
+        bufUsedSet(resident, 4);
+
+        int residentHandle = open(strPtr(fileName), O_RDONLY, 0);
+        TEST_RESULT_BOOL(residentHandle != -1, true, "open file");
+
+        TEST_RESULT_VOID(storagePosixCacheDropRead(residentHandle, resident, 0, pageSize * 6), "drop pages not resident");
+        TEST_RESULT_VOID(
+            storagePosixCacheDropRead(residentHandle, resident, pageSize + 1, pageSize), "drop pages after resident page");
+        TEST_RESULT_VOID(storagePosixCacheDropRead(residentHandle, NULL, 0, pageSize), "drop all pages when residency is unknown");
+
+        close(residentHandle);
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), NULL), "write empty file");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(storageGetNP(file) == NULL, false, "    read empty file");
+        TEST_RESULT_PTR(((StorageReadPosix *)file->driver)->cacheResident, NULL, "    no residency for empty file");
+
+        TEST_RESULT_VOID(storagePosixCacheDropSet(false), "disable cache drop");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(storageGetNP(file) == NULL, false, "    read file");
+        TEST_RESULT_PTR(((StorageReadPosix *)file->driver)->cacheResident, NULL, "    no residency when cache drop is disabled");
+        TEST_RESULT_VOID(storagePosixCacheDropRead(0, resident, 0, pageSize), "no drop when cache drop is disabled");
+
+        storagePutNP(storageNewWriteNP(storageTest, fileName), expectedBuffer);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(storagePosixDirect(), false, "direct io disabled by default");
+        TEST_RESULT_VOID(storagePosixDirectSet(true), "enable direct io");
+        TEST_RESULT_BOOL(storagePosixDirect(), true, "    direct io enabled");
+
+        ioBufferSizeSet(STORAGE_POSIX_DIRECT_ALIGN * 2);
+
+        Buffer *directBuffer = bufNew(STORAGE_POSIX_DIRECT_ALIGN * 3 + 1);
+        memset(bufPtr(directBuffer), 'X', bufSize(directBuffer));
+        bufUsedSet(directBuffer, bufSize(directBuffer));
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), directBuffer), "write file with direct io");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+        TEST_RESULT_BOOL(
+            ((uintptr_t)bufPtr(((StorageReadPosix *)file->driver)->directBuffer) % STORAGE_POSIX_DIRECT_ALIGN) == 0, true,
+            "    check buffer is aligned");
+
+        // Read one byte at a time from the start of the file
+        outBuffer = bufNew(1);
+
+        TEST_RESULT_UINT(storageReadPosix(storageRead(file), outBuffer, true), 1, "    read one byte");
+        TEST_RESULT_UINT(
+            bufUsed(((StorageReadPosix *)file->driver)->directBuffer), STORAGE_POSIX_DIRECT_ALIGN * 2, "    check aligned read");
+
+        // Read the rest
+        buffer = bufNew(STORAGE_POSIX_DIRECT_ALIGN * 4);
+        bufCat(buffer, outBuffer);
+
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), buffer), STORAGE_POSIX_DIRECT_ALIGN * 3, "    read rest");
+        TEST_RESULT_BOOL(ioReadEof(storageReadIo(file)), true, "    eof");
+
+        TEST_RESULT_BOOL(bufEq(buffer, directBuffer), true, "    check file contents");
+
+        // Read a file that is an exact multiple of the buffer size
+        bufUsedSet(directBuffer, STORAGE_POSIX_DIRECT_ALIGN * 2);
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), directBuffer), "write aligned file with direct io");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), directBuffer), true, "    check file contents");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+
+        // Close the file handle so operations will fail
+        close(((StorageReadPosix *)file->driver)->handle);
+        bufUsedZero(outBuffer);
+
+        TEST_ERROR_FMT(
+            ioRead(storageReadIo(file), outBuffer), FileReadError,
+            "unable to read '%s': [9] Bad file descriptor", strPtr(fileName));
+
+        // Set file handle to -1 so the close on free will not fail
+        ((StorageReadPosix *)file->driver)->handle = -1;
+
+        ioBufferSizeSet(2);
+
+        TEST_RESULT_VOID(storagePosixDirectSet(false), "disable direct io");
+
+#ifdef HAVE_LIBURING
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_UINT(storagePosixQueueDepth(), 1, "queue depth is 1 by default");
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(4), "set queue depth");
+        TEST_RESULT_UINT(storagePosixQueueDepth(), 4, "    check queue depth");
+
+        ioBufferSizeSet(STORAGE_POSIX_DIRECT_ALIGN);
+
+        // Use a different byte for each block so blocks returned out of order will be detected
+        Buffer *uringBuffer = bufNew(STORAGE_POSIX_DIRECT_ALIGN * 6 + 1);
+
+        for (size_t uringIdx = 0; uringIdx < bufSize(uringBuffer); uringIdx++)
+            bufPtr(uringBuffer)[uringIdx] = (unsigned char)('A' + uringIdx / STORAGE_POSIX_DIRECT_ALIGN);
+
+        bufUsedSet(uringBuffer, bufSize(uringBuffer));
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), uringBuffer), "write file with io_uring");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), uringBuffer), true, "    check file contents");
+
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(1), "disable io_uring");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), uringBuffer), true, "    check file contents");
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(4), "enable io_uring");
+
+        // Read a file that is an exact multiple of the buffer size and free it before all the reads have completed
+        bufUsedSet(uringBuffer, STORAGE_POSIX_DIRECT_ALIGN * 2);
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), uringBuffer), "write aligned file with io_uring");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), uringBuffer), true, "    check file contents");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+
+        outBuffer = bufNew(1);
+
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1, "    read one byte");
+        TEST_RESULT_VOID(storageReadFree(file), "    free file");
+
+        // Read the remainder of a short block until no data is returned when the file is truncated after it is opened
+        bufUsedSet(uringBuffer, STORAGE_POSIX_DIRECT_ALIGN * 3);
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), uringBuffer), "write file with io_uring");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+
+        bufUsedSet(uringBuffer, STORAGE_POSIX_DIRECT_ALIGN + STORAGE_POSIX_DIRECT_ALIGN / 2);
+        TEST_RESULT_INT(truncate(strPtr(fileName), (off_t)bufUsed(uringBuffer)), 0, "    truncate file");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), uringBuffer), true, "    check file contents");
+
+        // Read and write with direct io
+        TEST_RESULT_VOID(storagePosixDirectSet(true), "enable direct io");
+
+        bufUsedSet(uringBuffer, bufSize(uringBuffer));
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), uringBuffer), "write file with direct io");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), uringBuffer), true, "    check file contents");
+
+        TEST_RESULT_VOID(storagePosixDirectSet(false), "disable direct io");
+
+        // Read errors are returned when the block is read. Read first so read ahead has started before the handle is closed.
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1, "    read one byte");
+
+        close(((StorageReadPosix *)file->driver)->handle);
+        buffer = bufNew(bufUsed(uringBuffer));
+
+        TEST_ERROR_FMT(
+            ioRead(storageReadIo(file), buffer), FileReadError, "unable to read '%s': [9] Bad file descriptor", strPtr(fileName));
+
+        ((StorageReadPosix *)file->driver)->handle = -1;
+
+        // Write errors are returned when the write completes
+        StorageWrite *fileWrite = NULL;
+
+        TEST_ASSIGN(
+            fileWrite, storageNewWriteP(storageTest, fileName, .noAtomic = true, .noSyncFile = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(fileWrite)), "    open file");
+
+        close(((StorageWritePosix *)fileWrite->driver)->handle);
+
+        TEST_RESULT_VOID(storageWritePosix(storageWriteDriver(fileWrite), BUFSTRDEF("X")), "    write");
+        TEST_ERROR_FMT(
+            storageWritePosixClose(storageWriteDriver(fileWrite)), FileWriteError,
+            "unable to write '%s': [9] Bad file descriptor", strPtr(fileName));
+        TEST_ERROR_FMT(
+            storageWritePosixClose(storageWriteDriver(fileWrite)), FileCloseError,
+            STORAGE_ERROR_WRITE_CLOSE ": [9] Bad file descriptor", strPtr(fileName));
+
+        // Limit the file size so the write is short. Ignore the signal so the write fails instead.
+        signal(SIGXFSZ, SIG_IGN);
+
+        struct rlimit limitSave;
+        TEST_RESULT_INT(getrlimit(RLIMIT_FSIZE, &limitSave), 0, "get file size limit");
+        TEST_RESULT_INT(
+            setrlimit(RLIMIT_FSIZE, &(struct rlimit){.rlim_cur = 1, .rlim_max = limitSave.rlim_max}), 0, "limit file size");
+
+        TEST_ASSIGN(fileWrite, storageNewWriteP(storageTest, fileName, .noAtomic = true), "new write file");
+        TEST_ERROR_FMT(
+            storagePutNP(fileWrite, BUFSTRDEF("XX")), FileWriteError, "unable to write '%s'", strPtr(fileName));
+
+        TEST_RESULT_INT(setrlimit(RLIMIT_FSIZE, &limitSave), 0, "restore file size limit");
+
+        signal(SIGXFSZ, SIG_DFL);
+
+        // Error when the size of the file to read cannot be found
+        TEST_ERROR_FMT(
+            storagePosixUringNew(999, fileName, false, 2, 1), FileReadError, "unable to get info for '%s': [9] Bad file descriptor",
+            strPtr(fileName));
+
+        // Fall back to synchronous io when io_uring is not available
+        TEST_RESULT_PTR(storagePosixUringNew(0, fileName, false, 65536, 1), NULL, "ring too large");
+        TEST_RESULT_BOOL(uringUnavailable, true, "    io_uring unavailable");
+        TEST_RESULT_PTR(storagePosixUringNew(0, fileName, false, 2, 1), NULL, "    ring not created again");
+
+        uringUnavailable = false;
+        ioBufferSizeSet(2);
+
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(1), "reset queue depth");
+#endif // HAVE_LIBURING
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(3), "set queue depth");
+
+#ifdef HAVE_LIBURING
+        // Read ahead with a thread when io_uring is not available
+        uringUnavailable = true;
+#endif
+
+        ioBufferSizeSet(STORAGE_POSIX_DIRECT_ALIGN);
+
+        // Use a different byte for each block so blocks returned out of order will be detected
+        Buffer *readAheadBuffer = bufNew(STORAGE_POSIX_DIRECT_ALIGN * 7 + 1);
+
+        for (size_t readAheadIdx = 0; readAheadIdx < bufSize(readAheadBuffer); readAheadIdx++)
+            bufPtr(readAheadBuffer)[readAheadIdx] = (unsigned char)('A' + readAheadIdx / STORAGE_POSIX_DIRECT_ALIGN);
+
+        bufUsedSet(readAheadBuffer, bufSize(readAheadBuffer));
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), readAheadBuffer), "write file");
+
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->readAhead == NULL, true, "    read ahead starts on first read");
+
+        buffer = bufNew(bufSize(readAheadBuffer) + 1);
+
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), buffer), bufSize(readAheadBuffer), "    read file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->readAhead != NULL, true, "    check read ahead");
+        TEST_RESULT_BOOL(ioReadEof(storageReadIo(file)), true, "    eof");
+        TEST_RESULT_BOOL(bufEq(buffer, readAheadBuffer), true, "    check file contents");
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "    close file");
+
+        // Free the file while the thread is waiting for blocks to be released
+        TEST_ASSIGN(file, storageNewReadNP(storageTest, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "    open file");
+
+        outBuffer = bufNew(1);
+
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1, "    read one byte");
+        TEST_RESULT_VOID(storageReadFree(file), "    free file");
+
+        // Read a file that is an exact multiple of the buffer size with direct io
+        TEST_RESULT_VOID(storagePosixDirectSet(true), "enable direct io");
+
+        bufUsedSet(readAheadBuffer, STORAGE_POSIX_DIRECT_ALIGN * 2);
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storageTest, fileName), readAheadBuffer), "write aligned file");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetNP(storageNewReadNP(storageTest, fileName)), readAheadBuffer), true, "    check file contents");
+
+        TEST_RESULT_VOID(storagePosixDirectSet(false), "disable direct io");
+
+        // Read errors are returned when the block is read
+        int handle = open(strPtr(fileName), O_WRONLY);
+        StoragePosixReadAhead *readAhead = NULL;
+
+        TEST_ASSIGN(readAhead, storagePosixReadAheadNew(handle, fileName, 2, 1), "new read ahead on write only handle");
+        TEST_ERROR_FMT(
+            storagePosixReadAheadRead(readAhead), FileReadError, "unable to read '%s': [9] Bad file descriptor", strPtr(fileName));
+        TEST_RESULT_VOID(storagePosixReadAheadFree(readAhead), "    free read ahead");
+
+        close(handle);
+
+#ifdef HAVE_LIBURING
+        uringUnavailable = false;
+#endif
+
+        ioBufferSizeSet(2);
+
+        TEST_RESULT_VOID(storagePosixQueueDepthSet(1), "reset queue depth");
     }
 
     // *****************************************************************************************************************************